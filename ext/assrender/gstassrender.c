@@ -710,7 +710,14 @@ blit_bgra_premultiplied (GstAssRender * render, ASS_Image * ass_image,
       for (x = 0; x < w; x++) {
         if (src[0]) {
           k = src[0] * alpha / 255;
-          if (dst[3] == 0) {
+          if (k == 255) {
+            /* opaque pixels of the glyph just replace whatever was below,
+             * which covers most of the area of typical subtitles */
+            dst[3] = 255;
+            dst[2] = r;
+            dst[1] = g;
+            dst[0] = b;
+          } else if (dst[3] == 0) {
             dst[3] = k;
             dst[2] = (k * r) / 255;
             dst[1] = (k * g) / 255;
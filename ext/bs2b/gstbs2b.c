@@ -37,6 +37,8 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include <gst/gst.h>
 #include <gst/audio/audio.h>
 #include <gst/audio/gstaudiofilter.h>
@@ -319,6 +321,13 @@ gst_bs2b_setup (GstAudioFilter * filter, const GstAudioInfo * audio_info)
   element->bytes_per_sample =
       (GST_AUDIO_INFO_WIDTH (audio_info) * channels) / 8;
 
+  /* digital silence is mid-scale rather than zero for the unsigned
+   * formats, so the all-zero shortcut only applies to the others */
+  element->silence_is_zero = GST_AUDIO_INFO_IS_FLOAT (audio_info)
+      || GST_AUDIO_FORMAT_INFO_IS_SIGNED (audio_info->finfo);
+  element->silent_samples = 0;
+  element->tail_flushed = FALSE;
+
   GST_BS2B_DP_LOCK (element);
   bs2b_set_srate (element->bs2bdp, GST_AUDIO_INFO_RATE (audio_info));
   GST_BS2B_DP_UNLOCK (element);
@@ -343,15 +352,38 @@ gst_bs2b_transform_inplace (GstBaseTransform * base_transform,
 {
   GstBs2b *element = GST_BS2B (base_transform);
   GstMapInfo map_info;
+  guint samples;
 
   if (!gst_buffer_map (buffer, &map_info, GST_MAP_READ | GST_MAP_WRITE))
     return GST_FLOW_ERROR;
 
+  samples = map_info.size / element->bytes_per_sample;
+
   GST_BS2B_DP_LOCK (element);
-  if (GST_BUFFER_IS_DISCONT (buffer))
+  if (GST_BUFFER_IS_DISCONT (buffer)) {
     bs2b_clear (element->bs2bdp);
-  element->func (element->bs2bdp, map_info.data,
-      map_info.size / element->bytes_per_sample);
+    element->silent_samples = 0;
+    element->tail_flushed = FALSE;
+  }
+
+  if (element->silence_is_zero && map_info.size > 0 && map_info.data[0] == 0
+      && memcmp (map_info.data, map_info.data + 1, map_info.size - 1) == 0) {
+    /* silent input: let the filter ring out into the first bit of the
+     * silence, then drop the state and pass silence through untouched
+     * until audio comes back */
+    if (!element->tail_flushed) {
+      element->func (element->bs2bdp, map_info.data, samples);
+      element->silent_samples += samples;
+      if (element->silent_samples >= GST_AUDIO_FILTER_RATE (element) / 10) {
+        bs2b_clear (element->bs2bdp);
+        element->tail_flushed = TRUE;
+      }
+    }
+  } else {
+    element->silent_samples = 0;
+    element->tail_flushed = FALSE;
+    element->func (element->bs2bdp, map_info.data, samples);
+  }
   GST_BS2B_DP_UNLOCK (element);
 
   gst_buffer_unmap (buffer, &map_info);
@@ -50,6 +50,12 @@ struct _GstBs2b
   t_bs2bdp bs2bdp;
   void (*func) ();
   guint bytes_per_sample;
+
+  /* silence bypass; only usable for formats where digital silence
+   * is all-zero bytes */
+  gboolean silence_is_zero;
+  guint64 silent_samples;
+  gboolean tail_flushed;
 };
 
 struct _GstBs2bClass
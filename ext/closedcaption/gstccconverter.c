@@ -53,20 +53,38 @@ static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
 G_DEFINE_TYPE (GstCCConverter, gst_cc_converter, GST_TYPE_BASE_TRANSFORM);
 #define parent_class gst_cc_converter_parent_class
 
+static GstCCConverterConvertFunc
+gst_cc_converter_get_convert_func (GstVideoCaptionType input_caption_type,
+    GstVideoCaptionType output_caption_type);
+
 static gboolean
 gst_cc_converter_transform_size (GstBaseTransform * base,
     GstPadDirection direction,
     GstCaps * caps, gsize size, GstCaps * othercaps, gsize * othersize)
 {
+  GstCCConverter *self = GST_CCCONVERTER (base);
+
   /* We can't really convert from an output size to an input size */
   if (direction != GST_PAD_SINK)
     return FALSE;
 
-  /* Assume worst-case here and over-allocate, and in ::transform() we then
-   * downsize the buffer as needed. The worst-case is one CDP packet, which
-   * can be up to 256 bytes large */
-
-  *othersize = 256;
+  /* Over-allocate, and in ::transform() we then downsize the buffer as
+   * needed. For CDP in either direction assume the worst-case of one CDP
+   * packet, which can be up to 256 bytes large; for the other pairs the
+   * output size follows from the input size */
+  if (self->input_caption_type == GST_VIDEO_CAPTION_TYPE_CEA708_CDP ||
+      self->output_caption_type == GST_VIDEO_CAPTION_TYPE_CEA708_CDP) {
+    *othersize = 256;
+  } else if (self->input_caption_type == GST_VIDEO_CAPTION_TYPE_CEA608_RAW) {
+    /* 2 byte pairs to 3 byte triples */
+    *othersize = size / 2 * 3;
+  } else if (self->output_caption_type == GST_VIDEO_CAPTION_TYPE_CEA608_RAW) {
+    /* 3 byte triples to 2 byte pairs */
+    *othersize = size / 3 * 2;
+  } else {
+    /* 3 byte triples to 3 byte triples, at most */
+    *othersize = size;
+  }
 
   return TRUE;
 }
@@ -419,6 +437,11 @@ gst_cc_converter_set_caps (GstBaseTransform * base, GstCaps * incaps,
       self->output_caption_type == GST_VIDEO_CAPTION_TYPE_UNKNOWN)
     goto invalid_caps;
 
+  /* resolve the conversion function once here instead of per buffer */
+  self->convert =
+      gst_cc_converter_get_convert_func (self->input_caption_type,
+      self->output_caption_type);
+
   s = gst_caps_get_structure (incaps, 0);
   if (!gst_structure_get_fraction (s, "framerate", &self->fps_n, &self->fps_d))
     self->fps_n = self->fps_d = 0;
@@ -1191,99 +1214,91 @@ convert_cea708_cdp_cea708_cc_data (GstCCConverter * self, GstBuffer * inbuf,
   return GST_FLOW_OK;
 }
 
-static GstFlowReturn
-gst_cc_converter_transform (GstBaseTransform * base, GstBuffer * inbuf,
-    GstBuffer * outbuf)
+/* Resolves the conversion function for a format pair. Returns %NULL for
+ * identical formats, those are handled in passthrough mode. */
+static GstCCConverterConvertFunc
+gst_cc_converter_get_convert_func (GstVideoCaptionType input_caption_type,
+    GstVideoCaptionType output_caption_type)
 {
-  GstCCConverter *self = GST_CCCONVERTER (base);
-  GstVideoTimeCodeMeta *tc_meta = gst_buffer_get_video_time_code_meta (inbuf);
-  GstFlowReturn ret = GST_FLOW_OK;
-
-  GST_DEBUG_OBJECT (base, "Converting %" GST_PTR_FORMAT " from %u to %u", inbuf,
-      self->input_caption_type, self->output_caption_type);
-
-  switch (self->input_caption_type) {
+  switch (input_caption_type) {
     case GST_VIDEO_CAPTION_TYPE_CEA608_RAW:
 
-      switch (self->output_caption_type) {
+      switch (output_caption_type) {
         case GST_VIDEO_CAPTION_TYPE_CEA608_S334_1A:
-          ret = convert_cea608_raw_cea608_s334_1a (self, inbuf, outbuf);
-          break;
+          return convert_cea608_raw_cea608_s334_1a;
         case GST_VIDEO_CAPTION_TYPE_CEA708_RAW:
-          ret = convert_cea608_raw_cea708_cc_data (self, inbuf, outbuf);
-          break;
+          return convert_cea608_raw_cea708_cc_data;
         case GST_VIDEO_CAPTION_TYPE_CEA708_CDP:
-          ret = convert_cea608_raw_cea708_cdp (self, inbuf, outbuf);
-          break;
-        case GST_VIDEO_CAPTION_TYPE_CEA608_RAW:
+          return convert_cea608_raw_cea708_cdp;
         default:
-          g_assert_not_reached ();
           break;
       }
 
       break;
     case GST_VIDEO_CAPTION_TYPE_CEA608_S334_1A:
 
-      switch (self->output_caption_type) {
+      switch (output_caption_type) {
         case GST_VIDEO_CAPTION_TYPE_CEA608_RAW:
-          ret = convert_cea608_s334_1a_cea608_raw (self, inbuf, outbuf);
-          break;
+          return convert_cea608_s334_1a_cea608_raw;
         case GST_VIDEO_CAPTION_TYPE_CEA708_RAW:
-          ret = convert_cea608_s334_1a_cea708_cc_data (self, inbuf, outbuf);
-          break;
+          return convert_cea608_s334_1a_cea708_cc_data;
         case GST_VIDEO_CAPTION_TYPE_CEA708_CDP:
-          ret = convert_cea608_s334_1a_cea708_cdp (self, inbuf, outbuf);
-          break;
-        case GST_VIDEO_CAPTION_TYPE_CEA608_S334_1A:
+          return convert_cea608_s334_1a_cea708_cdp;
         default:
-          g_assert_not_reached ();
           break;
       }
 
       break;
     case GST_VIDEO_CAPTION_TYPE_CEA708_RAW:
 
-      switch (self->output_caption_type) {
+      switch (output_caption_type) {
         case GST_VIDEO_CAPTION_TYPE_CEA608_RAW:
-          ret = convert_cea708_cc_data_cea608_raw (self, inbuf, outbuf);
-          break;
+          return convert_cea708_cc_data_cea608_raw;
         case GST_VIDEO_CAPTION_TYPE_CEA608_S334_1A:
-          ret = convert_cea708_cc_data_cea608_s334_1a (self, inbuf, outbuf);
-          break;
+          return convert_cea708_cc_data_cea608_s334_1a;
         case GST_VIDEO_CAPTION_TYPE_CEA708_CDP:
-          ret = convert_cea708_cc_data_cea708_cdp (self, inbuf, outbuf);
-          break;
-        case GST_VIDEO_CAPTION_TYPE_CEA708_RAW:
+          return convert_cea708_cc_data_cea708_cdp;
         default:
-          g_assert_not_reached ();
           break;
       }
 
       break;
     case GST_VIDEO_CAPTION_TYPE_CEA708_CDP:
 
-      switch (self->output_caption_type) {
+      switch (output_caption_type) {
         case GST_VIDEO_CAPTION_TYPE_CEA608_RAW:
-          ret = convert_cea708_cdp_cea608_raw (self, inbuf, outbuf);
-          break;
+          return convert_cea708_cdp_cea608_raw;
         case GST_VIDEO_CAPTION_TYPE_CEA608_S334_1A:
-          ret = convert_cea708_cdp_cea608_s334_1a (self, inbuf, outbuf);
-          break;
+          return convert_cea708_cdp_cea608_s334_1a;
         case GST_VIDEO_CAPTION_TYPE_CEA708_RAW:
-          ret = convert_cea708_cdp_cea708_cc_data (self, inbuf, outbuf);
-          break;
-        case GST_VIDEO_CAPTION_TYPE_CEA708_CDP:
+          return convert_cea708_cdp_cea708_cc_data;
         default:
-          g_assert_not_reached ();
           break;
       }
 
       break;
     default:
-      g_assert_not_reached ();
       break;
   }
 
+  return NULL;
+}
+
+static GstFlowReturn
+gst_cc_converter_transform (GstBaseTransform * base, GstBuffer * inbuf,
+    GstBuffer * outbuf)
+{
+  GstCCConverter *self = GST_CCCONVERTER (base);
+  GstVideoTimeCodeMeta *tc_meta = gst_buffer_get_video_time_code_meta (inbuf);
+  GstFlowReturn ret;
+
+  GST_DEBUG_OBJECT (base, "Converting %" GST_PTR_FORMAT " from %u to %u", inbuf,
+      self->input_caption_type, self->output_caption_type);
+
+  if (G_UNLIKELY (self->convert == NULL))
+    return GST_FLOW_NOT_NEGOTIATED;
+
+  ret = self->convert (self, inbuf, outbuf);
   if (ret != GST_FLOW_OK)
     return ret;
 
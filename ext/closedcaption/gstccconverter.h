@@ -40,6 +40,9 @@ G_BEGIN_DECLS
 typedef struct _GstCCConverter GstCCConverter;
 typedef struct _GstCCConverterClass GstCCConverterClass;
 
+typedef GstFlowReturn (*GstCCConverterConvertFunc) (GstCCConverter * self,
+    GstBuffer * inbuf, GstBuffer * outbuf);
+
 struct _GstCCConverter
 {
   GstBaseTransform parent;
@@ -47,6 +50,9 @@ struct _GstCCConverter
   GstVideoCaptionType input_caption_type;
   GstVideoCaptionType output_caption_type;
 
+  /* conversion function for the negotiated format pair */
+  GstCCConverterConvertFunc convert;
+
   /* CDP sequence numbers when outputting CDP */
   guint16 cdp_hdr_sequence_cntr;
 
@@ -1259,7 +1259,6 @@ gst_cea_cc_overlay_create_and_push_buffer (GstCeaCcOverlay * overlay)
   GstBuffer *outbuf;
   GstMapInfo map;
   guint8 *window_image;
-  gint n;
   guint window_id;
   cea708Window *window;
   guint v_anchor = 0;
@@ -1281,17 +1280,13 @@ gst_cea_cc_overlay_create_and_push_buffer (GstCeaCcOverlay * overlay)
           window->image_height * 4);
       gst_buffer_map (outbuf, &map, GST_MAP_WRITE);
       window_image = map.data;
+      /* No need to clear the buffer first, the conversion below writes
+       * every pixel of the rectangle */
       if (decoder->use_ARGB) {
-        memset (window_image, 0,
-            window->image_width * window->image_height * 4);
         gst_buffer_add_video_meta (outbuf, GST_VIDEO_FRAME_FLAG_NONE,
             GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_RGB, window->image_width,
             window->image_height);
       } else {
-        for (n = 0; n < window->image_width * window->image_height; n++) {
-          window_image[n * 4] = window_image[n * 4 + 1] = 0;
-          window_image[n * 4 + 2] = window_image[n * 4 + 3] = 128;
-        }
         gst_buffer_add_video_meta (outbuf, GST_VIDEO_FRAME_FLAG_NONE,
             GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_YUV, window->image_width,
             window->image_height);
@@ -326,11 +326,11 @@ convert_line_v210_luma (const guint8 * orig, guint8 * dest, guint width)
   guint32 a, b, c, d;
   guint8 *y = dest;
 
-  for (i = 0; i < width - 5; i += 6) {
-    a = GST_READ_UINT32_LE (orig + (i / 6) * 16 + 0);
-    b = GST_READ_UINT32_LE (orig + (i / 6) * 16 + 4);
-    c = GST_READ_UINT32_LE (orig + (i / 6) * 16 + 8);
-    d = GST_READ_UINT32_LE (orig + (i / 6) * 16 + 12);
+  for (i = 0; i < width - 5; i += 6, orig += 16) {
+    a = GST_READ_UINT32_LE (orig + 0);
+    b = GST_READ_UINT32_LE (orig + 4);
+    c = GST_READ_UINT32_LE (orig + 8);
+    d = GST_READ_UINT32_LE (orig + 12);
 
     *y++ = (a >> 12) & 0xff;
     *y++ = (b >> 2) & 0xff;
@@ -800,6 +800,12 @@ gst_curl_base_sink_transfer_data_buffer (GstCurlBaseSink * sink,
   return transfer_data_buffer (curl_ptr, buffer, block_size, last_chunk);
 }
 
+/* Blocks inside libcurl's read callback until the streaming thread has made
+ * the next buffer available. This is what makes render zero-copy: curl reads
+ * straight out of the mapped buffer while render waits for the data-sent
+ * notification before unmapping. It also means the transfer loop must stay
+ * per-element; a process-wide multi handle would let one element's stalled
+ * source block every other transfer sharing the loop. */
 static size_t
 gst_curl_base_sink_transfer_read_cb (void *curl_ptr, size_t size, size_t nmemb,
     void *stream)
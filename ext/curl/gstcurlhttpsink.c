@@ -400,6 +400,14 @@ gst_curl_http_sink_set_options_unlocked (GstCurlBaseSink * bcsink)
     return FALSE;
   }
 
+#ifdef CURL_HTTP_VERSION_2TLS
+  /* talk HTTP/2 when the origin negotiates it over ALPN, transparently
+   * falling back to HTTP/1.1 otherwise; a failure here just means an old
+   * libcurl without HTTP/2 support, which is fine too */
+  curl_easy_setopt (bcsink->curl, CURLOPT_HTTP_VERSION,
+      CURL_HTTP_VERSION_2TLS);
+#endif
+
   parent_class = GST_CURL_TLS_SINK_GET_CLASS (sink);
 
   if (g_str_has_prefix (bcsink->url, "https://")) {
@@ -1036,6 +1036,10 @@ gst_dash_demux_process_manifest (GstAdaptiveDemux * demux, GstBuffer * buf)
 
   if (gst_buffer_map (buf, &mapinfo, GST_MAP_READ)) {
     manifest = (gchar *) mapinfo.data;
+    g_free (dashdemux->last_manifest_checksum);
+    dashdemux->last_manifest_checksum =
+        g_compute_checksum_for_data (G_CHECKSUM_SHA1, mapinfo.data,
+        mapinfo.size);
     if (gst_mpd_parse (dashdemux->client, manifest, mapinfo.size)) {
       if (gst_mpd_client_setup_media_presentation (dashdemux->client, 0, 0,
               NULL)) {
@@ -1110,6 +1114,8 @@ gst_dash_demux_reset (GstAdaptiveDemux * ademux)
     gst_mpd_client_free (demux->client);
     demux->client = NULL;
   }
+  g_free (demux->last_manifest_checksum);
+  demux->last_manifest_checksum = NULL;
   gst_dash_demux_clock_drift_free (demux->clock_drift);
   demux->clock_drift = NULL;
   demux->client = gst_mpd_client_new ();
@@ -2394,9 +2400,27 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
   GstDashDemux *dashdemux = GST_DASH_DEMUX_CAST (demux);
   GstMpdClient *new_client = NULL;
   GstMapInfo mapinfo;
+  gchar *checksum;
 
   GST_DEBUG_OBJECT (demux, "Updating manifest file from URL");
 
+  /* If the manifest did not change at all (common when polling a live
+   * stream faster than the segment duration), skip the expensive
+   * re-parse and stream setup entirely */
+  if (gst_buffer_map (buffer, &mapinfo, GST_MAP_READ)) {
+    checksum = g_compute_checksum_for_data (G_CHECKSUM_SHA1, mapinfo.data,
+        mapinfo.size);
+    gst_buffer_unmap (buffer, &mapinfo);
+
+    if (g_strcmp0 (checksum, dashdemux->last_manifest_checksum) == 0) {
+      GST_DEBUG_OBJECT (demux, "Manifest is unchanged, skipping update");
+      g_free (checksum);
+      return GST_FLOW_OK;
+    }
+    g_free (dashdemux->last_manifest_checksum);
+    dashdemux->last_manifest_checksum = checksum;
+  }
+
   /* parse the manifest file */
   new_client = gst_mpd_client_new ();
   gst_mpd_client_set_uri_downloader (new_client, demux->downloader);
@@ -2816,6 +2840,33 @@ gst_dash_demux_parse_isobmff (GstAdaptiveDemux * demux,
       GST_ISOFF_FOURCC_MDAT);
 
   available = gst_adapter_available (dash_stream->adapter);
+
+  /* Peek the header of the box at the head of the adapter first. If that
+   * box is not complete yet there is nothing we can do, and taking and
+   * re-parsing all accumulated data on every received chunk would make
+   * waiting for a large moof or sidx quadratic in the number of chunks.
+   * 32 bytes covers the largest possible header (64-bit size + uuid). */
+  {
+    gsize peek_size = MIN (available, 32);
+    const guint8 *peek_data;
+    GstByteReader peek;
+
+    if (available < 8)
+      return GST_FLOW_OK;
+
+    peek_data = gst_adapter_map (dash_stream->adapter, peek_size);
+    gst_byte_reader_init (&peek, peek_data, peek_size);
+    if (!gst_isoff_parse_box_header (&peek, &fourcc, NULL, &header_size,
+            &size)) {
+      gst_adapter_unmap (dash_stream->adapter);
+      return GST_FLOW_OK;
+    }
+    gst_adapter_unmap (dash_stream->adapter);
+
+    if (fourcc != GST_ISOFF_FOURCC_MDAT && size != 0 && available < size)
+      return GST_FLOW_OK;
+  }
+
   buffer = gst_adapter_take_buffer (dash_stream->adapter, available);
   buffer_offset = dash_stream->current_offset;
 
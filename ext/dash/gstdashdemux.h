@@ -128,6 +128,9 @@ struct _GstDashDemux
   GstMpdClient *client;         /* MPD client */
   GMutex client_lock;
 
+  /* checksum of the last manifest data, used to skip no-op live updates */
+  gchar *last_manifest_checksum;
+
   GstDashDemuxClockDrift *clock_drift;
 
   gboolean end_of_period;
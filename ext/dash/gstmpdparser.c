@@ -4821,17 +4821,24 @@ gst_mpd_client_stream_seek (GstMpdClient * client, GstActiveStream * stream,
   g_return_val_if_fail (stream != NULL, 0);
 
   if (stream->segments) {
-    for (index = 0; index < stream->segments->len; index++) {
-      gboolean in_segment = FALSE;
-      GstMediaSegment *segment = g_ptr_array_index (stream->segments, index);
+    gint low = 0, high = (gint) stream->segments->len - 1;
+
+    /* Segments are ordered by start time, so we can binary search for
+     * the first segment that ends after the target timestamp instead of
+     * scanning the whole list; DVR windows can hold thousands of
+     * segments */
+    while (low <= high) {
+      gint mid = low + (high - low) / 2;
+      GstMediaSegment *segment = g_ptr_array_index (stream->segments, mid);
+      gboolean in_segment;
       GstClockTime end_time;
 
-      GST_DEBUG ("Looking at fragment sequence chunk %d / %d", index,
+      GST_DEBUG ("Looking at fragment sequence chunk %d / %d", mid,
           stream->segments->len);
 
       end_time =
           gst_mpdparser_get_segment_end_time (client, stream->segments,
-          segment, index);
+          segment, mid);
 
       /* avoid downloading another fragment just for 1ns in reverse mode */
       if (forward)
@@ -4839,49 +4846,55 @@ gst_mpd_client_stream_seek (GstMpdClient * client, GstActiveStream * stream,
       else
         in_segment = ts <= end_time;
 
-      if (in_segment) {
-        GstClockTime chunk_time;
+      if (in_segment)
+        high = mid - 1;
+      else
+        low = mid + 1;
+    }
 
-        selectedChunk = segment;
-        repeat_index = (ts - segment->start) / segment->duration;
+    index = low;
+    if (index < stream->segments->len) {
+      GstMediaSegment *segment = g_ptr_array_index (stream->segments, index);
+      GstClockTime chunk_time;
 
-        chunk_time = segment->start + segment->duration * repeat_index;
+      selectedChunk = segment;
+      repeat_index = (ts - segment->start) / segment->duration;
 
-        /* At the end of a segment in reverse mode, start from the previous fragment */
-        if (!forward && repeat_index > 0
-            && ((ts - segment->start) % segment->duration == 0))
-          repeat_index--;
+      chunk_time = segment->start + segment->duration * repeat_index;
 
-        if ((flags & GST_SEEK_FLAG_SNAP_NEAREST) == GST_SEEK_FLAG_SNAP_NEAREST) {
-          if (repeat_index + 1 < segment->repeat) {
-            if (ts - chunk_time > chunk_time + segment->duration - ts)
-              repeat_index++;
-          } else if (index + 1 < stream->segments->len) {
-            GstMediaSegment *next_segment =
-                g_ptr_array_index (stream->segments, index + 1);
+      /* At the end of a segment in reverse mode, start from the previous fragment */
+      if (!forward && repeat_index > 0
+          && ((ts - segment->start) % segment->duration == 0))
+        repeat_index--;
 
-            if (ts - chunk_time > next_segment->start - ts) {
-              repeat_index = 0;
-              selectedChunk = next_segment;
-              index++;
-            }
+      if ((flags & GST_SEEK_FLAG_SNAP_NEAREST) == GST_SEEK_FLAG_SNAP_NEAREST) {
+        if (repeat_index + 1 < segment->repeat) {
+          if (ts - chunk_time > chunk_time + segment->duration - ts)
+            repeat_index++;
+        } else if (index + 1 < stream->segments->len) {
+          GstMediaSegment *next_segment =
+              g_ptr_array_index (stream->segments, index + 1);
+
+          if (ts - chunk_time > next_segment->start - ts) {
+            repeat_index = 0;
+            selectedChunk = next_segment;
+            index++;
           }
-        } else if (((forward && flags & GST_SEEK_FLAG_SNAP_AFTER) ||
-                (!forward && flags & GST_SEEK_FLAG_SNAP_BEFORE)) &&
-            ts != chunk_time) {
+        }
+      } else if (((forward && flags & GST_SEEK_FLAG_SNAP_AFTER) ||
+              (!forward && flags & GST_SEEK_FLAG_SNAP_BEFORE)) &&
+          ts != chunk_time) {
 
-          if (repeat_index + 1 < segment->repeat) {
-            repeat_index++;
+        if (repeat_index + 1 < segment->repeat) {
+          repeat_index++;
+        } else {
+          repeat_index = 0;
+          if (index + 1 >= stream->segments->len) {
+            selectedChunk = NULL;
           } else {
-            repeat_index = 0;
-            if (index + 1 >= stream->segments->len) {
-              selectedChunk = NULL;
-            } else {
-              selectedChunk = g_ptr_array_index (stream->segments, ++index);
-            }
+            selectedChunk = g_ptr_array_index (stream->segments, ++index);
           }
         }
-        break;
       }
     }
 
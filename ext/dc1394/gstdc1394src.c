@@ -93,6 +93,7 @@ static void gst_dc1394_src_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_dc1394_src_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
+static void gst_dc1394_src_finalize (GObject * object);
 static gboolean gst_dc1394_src_start (GstBaseSrc * bsrc);
 static gboolean gst_dc1394_src_stop (GstBaseSrc * bsrc);
 static gboolean gst_dc1394_src_set_caps (GstBaseSrc * bsrc, GstCaps * caps);
@@ -142,6 +143,7 @@ gst_dc1394_src_class_init (GstDC1394SrcClass * klass)
 
   gobject_class->set_property = gst_dc1394_src_set_property;
   gobject_class->get_property = gst_dc1394_src_get_property;
+  gobject_class->finalize = gst_dc1394_src_finalize;
   g_object_class_install_property (gobject_class, PROP_CAMERA_GUID,
       g_param_spec_string ("guid", "Camera GUID",
           "The hexadecimal representation of the GUID of the camera"
@@ -195,6 +197,10 @@ gst_dc1394_src_init (GstDC1394Src * src)
   src->dc1394 = NULL;
   src->camera = NULL;
   src->caps = NULL;
+  g_mutex_init (&src->frame_lock);
+  g_cond_init (&src->frame_cond);
+  src->frames_in_use = 0;
+  src->capture_active = FALSE;
 
   gst_base_src_set_live (GST_BASE_SRC (src), TRUE);
   gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
@@ -202,6 +208,19 @@ gst_dc1394_src_init (GstDC1394Src * src)
 }
 
 
+static void
+gst_dc1394_src_finalize (GObject * object)
+{
+  GstDC1394Src *src;
+
+  src = GST_DC1394_SRC (object);
+  g_mutex_clear (&src->frame_lock);
+  g_cond_clear (&src->frame_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+
 static void
 gst_dc1394_src_get_property (GObject * object, guint prop_id, GValue * value,
     GParamSpec * pspec)
@@ -313,11 +332,42 @@ gst_dc1394_src_set_caps (GstBaseSrc * bsrc, GstCaps * caps)
 }
 
 
+typedef struct
+{
+  GstDC1394Src *src;
+  dc1394video_frame_t *frame;
+} GstDC1394SrcFrame;
+
+
+static void
+gst_dc1394_src_release_frame (gpointer data)
+{
+  GstDC1394SrcFrame *src_frame = data;
+  GstDC1394Src *src = src_frame->src;
+  dc1394error_t ret = DC1394_SUCCESS;
+
+  g_mutex_lock (&src->frame_lock);
+  /* once capture is cleared the frame memory is gone, do not touch it */
+  if (src->capture_active)
+    ret = dc1394_capture_enqueue (src->camera, src_frame->frame);
+  src->frames_in_use--;
+  g_cond_signal (&src->frame_cond);
+  g_mutex_unlock (&src->frame_lock);
+  if (ret != DC1394_SUCCESS) {
+    GST_ELEMENT_WARNING (src, RESOURCE, READ, (NULL),
+        ("Could not enqueue frame: %s.", dc1394_error_get_string (ret)));
+  }
+  gst_object_unref (src);
+  g_free (src_frame);
+}
+
+
 static GstFlowReturn
 gst_dc1394_src_create (GstPushSrc * psrc, GstBuffer ** obuf)
 {
   GstDC1394Src *src;
   GstBuffer *buffer = NULL;
+  GstDC1394SrcFrame *src_frame;
   dc1394video_frame_t *frame;
   dc1394error_t ret;
 
@@ -330,24 +380,26 @@ gst_dc1394_src_create (GstPushSrc * psrc, GstBuffer ** obuf)
     return GST_FLOW_ERROR;
   }
   /*
-   * TODO: We could create the buffer by wrapping the image bytes in the frame
-   * (enqueing the frame in the notify function) to save the copy operation.
-   * It will only work if all the buffers are disposed before closing the camera
-   * when state changes from PAUSED to READY.
+   * Wrap the image bytes of the DMA frame in the buffer without copying,
+   * the frame is enqueued back into the capture ring when the buffer is
+   * disposed. Stopping capture waits for the wrapped frames to be disposed,
+   * so the ring is never unmapped while buffers are downstream.
    */
-  buffer = gst_buffer_new_allocate (NULL, frame->image_bytes, NULL);
-  gst_buffer_fill (buffer, 0, frame->image, frame->image_bytes);
+  src_frame = g_new (GstDC1394SrcFrame, 1);
+  src_frame->src = gst_object_ref (src);
+  src_frame->frame = frame;
+  g_mutex_lock (&src->frame_lock);
+  src->frames_in_use++;
+  g_mutex_unlock (&src->frame_lock);
+  buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+      frame->image, frame->image_bytes, 0, frame->image_bytes,
+      src_frame, gst_dc1394_src_release_frame);
   /*
    * TODO: There is a field timestamp in the frame structure,
    * It is not sure if it could be used as PTS or DTS:
    * we are not sure if it comes from a monotonic clock,
    * and it seems to be left undefined under MS Windows.
    */
-  ret = dc1394_capture_enqueue (src->camera, frame);
-  if (ret != DC1394_SUCCESS) {
-    GST_ELEMENT_WARNING (src, RESOURCE, READ, (NULL),
-        ("Could not enqueue frame: %s.", dc1394_error_get_string (ret)));
-  }
   *obuf = buffer;
   return GST_FLOW_OK;
 }
@@ -603,6 +655,10 @@ gst_dc1394_src_start_cam (GstDC1394Src * src)
         ("Could not setup capture: %s", dc1394_error_get_string (ret)));
     goto error_capture;
   }
+  g_mutex_lock (&src->frame_lock);
+  src->capture_active = TRUE;
+  src->frames_in_use = 0;
+  g_mutex_unlock (&src->frame_lock);
 
   /*
    * TODO: dc1394_capture_setup/stop can start/stop the transmission
@@ -684,6 +740,30 @@ gst_dc1394_src_stop_cam (GstDC1394Src * src)
         dc1394_error_get_string (ret));
   }
 
+  /*
+   * Buffers wrap the DMA frames without a copy, so the ring must not be
+   * unmapped while any of them is still in use downstream.
+   */
+  g_mutex_lock (&src->frame_lock);
+  src->capture_active = FALSE;
+  for (trials = 10; (trials > 0) && (src->frames_in_use > 0); trials--) {
+    GST_DEBUG_OBJECT (src,
+        "Wait for %d frames in use downstream (%d trials left).",
+        src->frames_in_use, trials);
+    g_cond_wait_until (&src->frame_cond, &src->frame_lock,
+        g_get_monotonic_time () + 50 * G_TIME_SPAN_MILLISECOND);
+  }
+  if (src->frames_in_use > 0) {
+    /* leak the ring rather than unmap memory which is still mapped in
+     * buffers downstream */
+    GST_ELEMENT_WARNING (src, RESOURCE, CLOSE, (NULL),
+        ("Not clearing capture, %d frames are still in use downstream.",
+            src->frames_in_use));
+    g_mutex_unlock (&src->frame_lock);
+    return TRUE;
+  }
+  g_mutex_unlock (&src->frame_lock);
+
   GST_DEBUG_OBJECT (src, "Clear capture resources.");
   ret = dc1394_capture_stop (src->camera);
   if (ret != DC1394_SUCCESS && ret != DC1394_CAPTURE_IS_NOT_SET) {
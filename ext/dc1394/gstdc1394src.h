@@ -47,6 +47,12 @@ struct _GstDC1394Src {
   uint32_t dma_buffer_size;
   dc1394camera_t * camera;
   dc1394_t * dc1394;
+
+  /* DMA frames wrapped in buffers and not yet returned by downstream */
+  GMutex frame_lock;
+  GCond frame_cond;
+  guint frames_in_use;
+  gboolean capture_active;
 };
 
 struct _GstDC1394SrcClass {
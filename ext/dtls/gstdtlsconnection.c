@@ -96,9 +96,14 @@ struct _GstDtlsConnectionPrivate
   GClosure *send_closure;
 
   gboolean timeout_pending;
-  GThreadPool *thread_pool;
 };
 
+/* Shared thread pool handling timeouts for all connections, so that a
+ * connection storm does not cost one pool per connection. The pool is
+ * non-exclusive, threads are shared with all other thread pools around
+ * there as timeouts are not going to happen very often */
+static GThreadPool *timeout_thread_pool;
+
 G_DEFINE_TYPE_WITH_CODE (GstDtlsConnection, gst_dtls_connection, G_TYPE_OBJECT,
     G_ADD_PRIVATE (GstDtlsConnection)
     GST_DEBUG_CATEGORY_INIT (gst_dtls_connection_debug, "dtlsconnection", 0,
@@ -160,6 +165,10 @@ gst_dtls_connection_class_init (GstDtlsConnectionClass * klass)
 
   _gst_dtls_init_openssl ();
 
+  timeout_thread_pool = g_thread_pool_new (handle_timeout, NULL, 4, FALSE,
+      NULL);
+  g_assert (timeout_thread_pool);
+
   gobject_class->finalize = gst_dtls_connection_finalize;
 }
 
@@ -186,11 +195,6 @@ gst_dtls_connection_init (GstDtlsConnection * self)
   g_mutex_init (&priv->mutex);
   g_cond_init (&priv->condition);
 
-  /* Thread pool for handling timeouts, we only need one thread for that
-   * really and share threads with all other thread pools around there as
-   * this is not going to happen very often */
-  priv->thread_pool = g_thread_pool_new (handle_timeout, self, 1, FALSE, NULL);
-  g_assert (priv->thread_pool);
   priv->timeout_pending = FALSE;
 }
 
@@ -200,9 +204,6 @@ gst_dtls_connection_finalize (GObject * gobject)
   GstDtlsConnection *self = GST_DTLS_CONNECTION (gobject);
   GstDtlsConnectionPrivate *priv = self->priv;
 
-  g_thread_pool_free (priv->thread_pool, TRUE, TRUE);
-  priv->thread_pool = NULL;
-
   SSL_free (priv->ssl);
   priv->ssl = NULL;
 
@@ -329,7 +330,9 @@ gst_dtls_connection_start (GstDtlsConnection * self, gboolean is_client)
 static void
 handle_timeout (gpointer data, gpointer user_data)
 {
-  GstDtlsConnection *self = user_data;
+  /* The pool is shared between all connections, each task carries a
+   * reference on the connection it is for */
+  GstDtlsConnection *self = data;
   GstDtlsConnectionPrivate *priv;
   gint ret;
 
@@ -352,6 +355,8 @@ handle_timeout (gpointer data, gpointer user_data)
     }
   }
   g_mutex_unlock (&priv->mutex);
+
+  g_object_unref (self);
 }
 
 static gboolean
@@ -365,8 +370,7 @@ schedule_timeout_handling (GstClock * clock, GstClockTime time, GstClockID id,
     self->priv->timeout_pending = TRUE;
 
     GST_TRACE_OBJECT (self, "Schedule timeout now");
-    g_thread_pool_push (self->priv->thread_pool, GINT_TO_POINTER (0xc0ffee),
-        NULL);
+    g_thread_pool_push (timeout_thread_pool, g_object_ref (self), NULL);
   }
   g_mutex_unlock (&self->priv->mutex);
 
@@ -413,8 +417,7 @@ gst_dtls_connection_check_timeout_locked (GstDtlsConnection * self)
         self->priv->timeout_pending = TRUE;
         GST_TRACE_OBJECT (self, "Schedule timeout now");
 
-        g_thread_pool_push (self->priv->thread_pool, GINT_TO_POINTER (0xc0ffee),
-            NULL);
+        g_thread_pool_push (timeout_thread_pool, g_object_ref (self), NULL);
       }
     }
   } else {
@@ -81,6 +81,7 @@ static gboolean
 gst_hls_demux_stream_decrypt_start (GstHLSDemuxStream * stream,
     const guint8 * key_data, const guint8 * iv_data);
 static void gst_hls_demux_stream_decrypt_end (GstHLSDemuxStream * stream);
+static void gst_hls_demux_stream_decrypt_free (GstHLSDemuxStream * stream);
 
 static gboolean gst_hls_demux_is_live (GstAdaptiveDemux * demux);
 static GstClockTime gst_hls_demux_get_duration (GstAdaptiveDemux * demux);
@@ -1027,7 +1028,7 @@ gst_hls_demux_stream_free (GstAdaptiveDemuxStream * stream)
     g_free (hls_stream->current_iv);
     hls_stream->current_iv = NULL;
   }
-  gst_hls_demux_stream_decrypt_end (hls_stream);
+  gst_hls_demux_stream_decrypt_free (hls_stream);
 }
 
 static GstM3U8 *
@@ -1372,6 +1373,19 @@ gst_hls_demux_update_playlist (GstHLSDemux * demux, gboolean update,
 
 retry:
   uri = gst_m3u8_get_uri (demux->current_variant->m3u8);
+
+  /* If the server announced delta update support (CAN-SKIP-UNTIL), add
+   * the delivery directive asking it to skip the segments we already
+   * know about */
+  if (update && demux->current_variant->m3u8->can_skip_until > 0
+      && strstr (uri, "_HLS_skip=") == NULL) {
+    gchar *skip_uri = g_strdup_printf ("%s%c_HLS_skip=YES", uri,
+        strchr (uri, '?') ? '&' : '?');
+
+    g_free (uri);
+    uri = skip_uri;
+  }
+
   main_uri = gst_adaptive_demux_get_manifest_ref_uri (adaptive_demux);
   download =
       gst_uri_downloader_fetch_uri (adaptive_demux->downloader, uri, main_uri,
@@ -1657,15 +1671,25 @@ gst_hls_demux_stream_decrypt_start (GstHLSDemuxStream * stream,
 {
   EVP_CIPHER_CTX *ctx;
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX_init (&stream->aes_ctx);
+  if (!stream->decrypt_started)
+    EVP_CIPHER_CTX_init (&stream->aes_ctx);
   ctx = &stream->aes_ctx;
 #else
-  stream->aes_ctx = EVP_CIPHER_CTX_new ();
+  if (!stream->aes_ctx)
+    stream->aes_ctx = EVP_CIPHER_CTX_new ();
   ctx = stream->aes_ctx;
 #endif
+  if (stream->decrypt_started
+      && memcmp (stream->decrypt_key, key_data, 16) == 0) {
+    /* same key as the previous fragment, just re-arm the IV and keep
+     * the expanded key schedule */
+    return EVP_DecryptInit_ex (ctx, NULL, NULL, NULL, iv_data) != 0;
+  }
   if (!EVP_DecryptInit_ex (ctx, EVP_aes_128_cbc (), NULL, key_data, iv_data))
     return FALSE;
   EVP_CIPHER_CTX_set_padding (ctx, 0);
+  memcpy (stream->decrypt_key, key_data, 16);
+  stream->decrypt_started = TRUE;
   return TRUE;
 }
 
@@ -1696,12 +1720,22 @@ decrypt_fragment (GstHLSDemuxStream * stream, gsize length,
 static void
 gst_hls_demux_stream_decrypt_end (GstHLSDemuxStream * stream)
 {
+  /* the context is kept around so the next fragment with the same key
+   * only needs a new IV */
+}
+
+static void
+gst_hls_demux_stream_decrypt_free (GstHLSDemuxStream * stream)
+{
+  if (!stream->decrypt_started)
+    return;
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup (&stream->aes_ctx);
 #else
   EVP_CIPHER_CTX_free (stream->aes_ctx);
   stream->aes_ctx = NULL;
 #endif
+  stream->decrypt_started = FALSE;
 }
 
 #elif defined(HAVE_NETTLE)
@@ -1709,7 +1743,12 @@ static gboolean
 gst_hls_demux_stream_decrypt_start (GstHLSDemuxStream * stream,
     const guint8 * key_data, const guint8 * iv_data)
 {
-  aes_set_decrypt_key (&stream->aes_ctx.ctx, 16, key_data);
+  if (!stream->decrypt_started
+      || memcmp (stream->decrypt_key, key_data, 16) != 0) {
+    aes_set_decrypt_key (&stream->aes_ctx.ctx, 16, key_data);
+    memcpy (stream->decrypt_key, key_data, 16);
+    stream->decrypt_started = TRUE;
+  }
   CBC_SET_IV (&stream->aes_ctx, iv_data);
 
   return TRUE;
@@ -1731,7 +1770,13 @@ decrypt_fragment (GstHLSDemuxStream * stream, gsize length,
 static void
 gst_hls_demux_stream_decrypt_end (GstHLSDemuxStream * stream)
 {
-  /* NOP */
+  /* NOP, the key schedule stays valid for the next fragment */
+}
+
+static void
+gst_hls_demux_stream_decrypt_free (GstHLSDemuxStream * stream)
+{
+  stream->decrypt_started = FALSE;
 }
 
 #else
@@ -1742,6 +1787,20 @@ gst_hls_demux_stream_decrypt_start (GstHLSDemuxStream * stream,
   gcry_error_t err = 0;
   gboolean ret = FALSE;
 
+  if (stream->decrypt_started) {
+    /* reuse the open cipher handle; reset restores the state right
+     * after setkey, so only a changed key needs a new key schedule */
+    gcry_cipher_reset (stream->aes_ctx);
+    if (memcmp (stream->decrypt_key, key_data, 16) != 0) {
+      err = gcry_cipher_setkey (stream->aes_ctx, key_data, 16);
+      if (err)
+        goto out;
+      memcpy (stream->decrypt_key, key_data, 16);
+    }
+    err = gcry_cipher_setiv (stream->aes_ctx, iv_data, 16);
+    return err == 0;
+  }
+
   err =
       gcry_cipher_open (&stream->aes_ctx, GCRY_CIPHER_AES128,
       GCRY_CIPHER_MODE_CBC, 0);
@@ -1751,8 +1810,11 @@ gst_hls_demux_stream_decrypt_start (GstHLSDemuxStream * stream,
   if (err)
     goto out;
   err = gcry_cipher_setiv (stream->aes_ctx, iv_data, 16);
-  if (!err)
+  if (!err) {
+    memcpy (stream->decrypt_key, key_data, 16);
+    stream->decrypt_started = TRUE;
     ret = TRUE;
+  }
 
 out:
   if (!ret)
@@ -1776,11 +1838,18 @@ decrypt_fragment (GstHLSDemuxStream * stream, gsize length,
 
 static void
 gst_hls_demux_stream_decrypt_end (GstHLSDemuxStream * stream)
+{
+  /* NOP, the open cipher handle is kept for the next fragment */
+}
+
+static void
+gst_hls_demux_stream_decrypt_free (GstHLSDemuxStream * stream)
 {
   if (stream->aes_ctx) {
     gcry_cipher_close (stream->aes_ctx);
     stream->aes_ctx = NULL;
   }
+  stream->decrypt_started = FALSE;
 }
 #endif
 
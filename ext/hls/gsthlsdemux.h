@@ -111,6 +111,8 @@ struct _GstHLSDemuxStream
 #else
   gcry_cipher_hd_t aes_ctx;
 #endif
+  gboolean   decrypt_started;   /* aes_ctx is set up and can be reused */
+  guint8     decrypt_key[16];   /* key the cipher context is set up with */
 
   gchar     *current_key;
   guint8    *current_iv;
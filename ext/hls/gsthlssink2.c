@@ -64,6 +64,14 @@ enum
   PROP_PLAYLIST_LENGTH
 };
 
+enum
+{
+  SIGNAL_SPLIT_AT_RUNNING_TIME,
+  LAST_SIGNAL
+};
+
+static guint signals[LAST_SIGNAL];
+
 static GstStaticPadTemplate video_template = GST_STATIC_PAD_TEMPLATE ("video",
     GST_PAD_SINK,
     GST_PAD_REQUEST,
@@ -88,6 +96,23 @@ static GstPad *gst_hls_sink2_request_new_pad (GstElement * element,
     GstPadTemplate * templ, const gchar * name, const GstCaps * caps);
 static void gst_hls_sink2_release_pad (GstElement * element, GstPad * pad);
 
+static void
+gst_hls_sink2_split_at_running_time (GstHlsSink2 * sink, GstClockTime time)
+{
+  /* splitmuxsink snaps the split to the first keyframe at or after the
+   * requested running time */
+  if (sink->splitmuxsink == NULL)
+    return;
+
+  if (g_signal_lookup ("split-at-running-time",
+          G_OBJECT_TYPE (sink->splitmuxsink)) != 0) {
+    g_signal_emit_by_name (sink->splitmuxsink, "split-at-running-time", time);
+  } else {
+    GST_WARNING_OBJECT (sink,
+        "splitmuxsink does not support split-at-running-time");
+  }
+}
+
 static void
 gst_hls_sink2_dispose (GObject * object)
 {
@@ -96,11 +121,49 @@ gst_hls_sink2_dispose (GObject * object)
   G_OBJECT_CLASS (parent_class)->dispose ((GObject *) sink);
 }
 
+typedef struct
+{
+  gchar *playlist_content;
+  gchar *playlist_location;
+  GList *old_locations;
+} GstHlsSink2PlaylistWrite;
+
+static void
+gst_hls_sink2_playlist_write_func (gpointer data, gpointer user_data)
+{
+  GstHlsSink2PlaylistWrite *write = data;
+  GstHlsSink2 *sink = GST_HLS_SINK2_CAST (user_data);
+  GError *error = NULL;
+  GList *l;
+
+  /* g_file_set_contents() writes to a temporary file and renames it over
+   * the old playlist, so readers always see a complete playlist */
+  if (!g_file_set_contents (write->playlist_location,
+          write->playlist_content, -1, &error)) {
+    GST_ERROR ("Failed to write playlist: %s", error->message);
+    GST_ELEMENT_ERROR (sink, RESOURCE, OPEN_WRITE,
+        (("Failed to write playlist '%s'."), error->message), (NULL));
+    g_error_free (error);
+    error = NULL;
+  }
+
+  for (l = write->old_locations; l != NULL; l = l->next)
+    g_remove (l->data);
+
+  g_list_free_full (write->old_locations, g_free);
+  g_free (write->playlist_content);
+  g_free (write->playlist_location);
+  g_free (write);
+}
+
 static void
 gst_hls_sink2_finalize (GObject * object)
 {
   GstHlsSink2 *sink = GST_HLS_SINK2_CAST (object);
 
+  if (sink->writer_pool)
+    g_thread_pool_free (sink->writer_pool, FALSE, TRUE);
+
   g_free (sink->location);
   g_free (sink->playlist_location);
   g_free (sink->playlist_root);
@@ -177,6 +240,27 @@ gst_hls_sink2_class_init (GstHlsSink2Class * klass)
           "the playlist will be infinite.",
           0, G_MAXUINT, DEFAULT_PLAYLIST_LENGTH,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstHlsSink2::split-at-running-time:
+   * @sink: the #GstHlsSink2
+   * @time: the running time to start a new segment at
+   *
+   * Schedule the current segment to end and a new one to start at the
+   * first keyframe with a running time of at least @time. Emitting this
+   * on several hlssink2 instances with the same times keeps the segment
+   * boundaries of an ABR ladder aligned, so players can switch renditions
+   * at any segment boundary.
+   *
+   * Since: 1.16
+   */
+  signals[SIGNAL_SPLIT_AT_RUNNING_TIME] =
+      g_signal_new ("split-at-running-time", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_STRUCT_OFFSET (GstHlsSink2Class, split_at_running_time), NULL, NULL,
+      NULL, G_TYPE_NONE, 1, G_TYPE_UINT64);
+
+  klass->split_at_running_time = gst_hls_sink2_split_at_running_time;
 }
 
 static void
@@ -192,6 +276,10 @@ gst_hls_sink2_init (GstHlsSink2 * sink)
   sink->target_duration = DEFAULT_TARGET_DURATION;
   g_queue_init (&sink->old_locations);
 
+  /* a single exclusive thread keeps the writes in playlist order */
+  sink->writer_pool = g_thread_pool_new (gst_hls_sink2_playlist_write_func,
+      sink, 1, TRUE, NULL);
+
   sink->splitmuxsink = gst_element_factory_make ("splitmuxsink", NULL);
   gst_bin_add (GST_BIN (sink), sink->splitmuxsink);
 
@@ -208,6 +296,13 @@ gst_hls_sink2_init (GstHlsSink2 * sink)
 static void
 gst_hls_sink2_reset (GstHlsSink2 * sink)
 {
+  /* let in-flight playlist writes finish before dropping their state */
+  if (sink->writer_pool) {
+    g_thread_pool_free (sink->writer_pool, FALSE, TRUE);
+    sink->writer_pool = g_thread_pool_new (gst_hls_sink2_playlist_write_func,
+        sink, 1, TRUE, NULL);
+  }
+
   sink->index = 0;
 
   if (sink->playlist)
@@ -220,23 +315,19 @@ gst_hls_sink2_reset (GstHlsSink2 * sink)
   g_queue_clear (&sink->old_locations);
 }
 
+/* Renders the playlist and queues the write, and the removal of
+ * @old_locations (transfer full), on the writer thread */
 static void
-gst_hls_sink2_write_playlist (GstHlsSink2 * sink)
+gst_hls_sink2_write_playlist (GstHlsSink2 * sink, GList * old_locations)
 {
-  char *playlist_content;
-  GError *error = NULL;
+  GstHlsSink2PlaylistWrite *write;
 
-  playlist_content = gst_m3u8_playlist_render (sink->playlist);
-  if (!g_file_set_contents (sink->playlist_location,
-          playlist_content, -1, &error)) {
-    GST_ERROR ("Failed to write playlist: %s", error->message);
-    GST_ELEMENT_ERROR (sink, RESOURCE, OPEN_WRITE,
-        (("Failed to write playlist '%s'."), error->message), (NULL));
-    g_error_free (error);
-    error = NULL;
-  }
-  g_free (playlist_content);
+  write = g_new0 (GstHlsSink2PlaylistWrite, 1);
+  write->playlist_content = gst_m3u8_playlist_render (sink->playlist);
+  write->playlist_location = g_strdup (sink->playlist_location);
+  write->old_locations = old_locations;
 
+  g_thread_pool_push (sink->writer_pool, write, NULL);
 }
 
 static void
@@ -258,6 +349,7 @@ gst_hls_sink2_handle_message (GstBin * bin, GstMessage * message)
         } else if (gst_structure_has_name (s, "splitmuxsink-fragment-closed")) {
           GstClockTime running_time;
           gchar *entry_location;
+          GList *old_locations = NULL;
 
           g_assert (strcmp (sink->current_location, gst_structure_get_string (s,
                       "location")) == 0);
@@ -278,24 +370,23 @@ gst_hls_sink2_handle_message (GstBin * bin, GstMessage * message)
               sink->index++, FALSE);
           g_free (entry_location);
 
-          gst_hls_sink2_write_playlist (sink);
-
           g_queue_push_tail (&sink->old_locations,
               g_strdup (sink->current_location));
 
           while (g_queue_get_length (&sink->old_locations) >
               g_queue_get_length (sink->playlist->entries)) {
-            gchar *old_location = g_queue_pop_head (&sink->old_locations);
-            g_remove (old_location);
-            g_free (old_location);
+            old_locations = g_list_append (old_locations,
+                g_queue_pop_head (&sink->old_locations));
           }
+
+          gst_hls_sink2_write_playlist (sink, old_locations);
         }
       }
       break;
     }
     case GST_MESSAGE_EOS:{
       sink->playlist->end_list = TRUE;
-      gst_hls_sink2_write_playlist (sink);
+      gst_hls_sink2_write_playlist (sink, NULL);
       break;
     }
     default:
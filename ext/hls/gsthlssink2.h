@@ -54,11 +54,18 @@ struct _GstHlsSink2
   gchar *current_location;
   GstClockTime current_running_time_start;
   GQueue old_locations;
+
+  /* writer thread performing playlist writes and old segment removal, so
+   * slow storage does not stall the thread closing the fragments */
+  GThreadPool *writer_pool;
 };
 
 struct _GstHlsSink2Class
 {
   GstBinClass bin_class;
+
+  /* action signals */
+  void (*split_at_running_time) (GstHlsSink2 * sink, GstClockTime time);
 };
 
 GType gst_hls_sink2_get_type (void);
@@ -40,6 +40,9 @@ struct _GstM3U8Entry
   gchar *title;
   gchar *url;
   gboolean discontinuous;
+  /* entry as it appears in the playlist, rendered on first use; with a
+   * sliding window each entry is written out window_size times */
+  gchar *rendered;
 };
 
 static GstM3U8Entry *
@@ -65,6 +68,7 @@ gst_m3u8_entry_free (GstM3U8Entry * entry)
 
   g_free (entry->url);
   g_free (entry->title);
+  g_free (entry->rendered);
   g_free (entry);
 }
 
@@ -167,23 +171,25 @@ gst_m3u8_playlist_render (GstM3U8Playlist * playlist)
 
   /* Entries */
   for (l = playlist->entries->head; l != NULL; l = l->next) {
-    gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
     GstM3U8Entry *entry = l->data;
 
-    if (entry->discontinuous)
-      g_string_append (playlist_str, "#EXT-X-DISCONTINUITY\n");
-
-    if (playlist->version < 3) {
-      g_string_append_printf (playlist_str, "#EXTINF:%d,%s\n",
-          (gint) ((entry->duration + 500 * GST_MSECOND) / GST_SECOND),
-          entry->title ? entry->title : "");
-    } else {
-      g_string_append_printf (playlist_str, "#EXTINF:%s,%s\n",
-          g_ascii_dtostr (buf, sizeof (buf), entry->duration / GST_SECOND),
-          entry->title ? entry->title : "");
+    if (entry->rendered == NULL) {
+      gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
+
+      if (playlist->version < 3) {
+        entry->rendered = g_strdup_printf ("%s#EXTINF:%d,%s\n%s\n",
+            entry->discontinuous ? "#EXT-X-DISCONTINUITY\n" : "",
+            (gint) ((entry->duration + 500 * GST_MSECOND) / GST_SECOND),
+            entry->title ? entry->title : "", entry->url);
+      } else {
+        entry->rendered = g_strdup_printf ("%s#EXTINF:%s,%s\n%s\n",
+            entry->discontinuous ? "#EXT-X-DISCONTINUITY\n" : "",
+            g_ascii_dtostr (buf, sizeof (buf), entry->duration / GST_SECOND),
+            entry->title ? entry->title : "", entry->url);
+      }
     }
 
-    g_string_append_printf (playlist_str, "%s\n", entry->url);
+    g_string_append (playlist_str, entry->rendered);
   }
 
   if (playlist->end_list)
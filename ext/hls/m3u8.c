@@ -458,6 +458,8 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
   gint64 mediasequence;
   GList *previous_files = NULL;
   gboolean have_mediasequence = FALSE;
+  gint64 skipped_segments = 0;
+  gint64 skip_first_sequence = -1;
 
   g_return_val_if_fail (self != NULL, FALSE);
   g_return_val_if_fail (data != NULL, FALSE);
@@ -663,6 +665,38 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
             }
           }
         }
+      } else if (g_str_has_prefix (data_ext_x, "SERVER-CONTROL:")) {
+        gchar *v, *a;
+
+        data = data + 22;
+
+        while (data && parse_attributes (&data, &a, &v)) {
+          if (g_str_equal (a, "CAN-SKIP-UNTIL")) {
+            gdouble fval;
+
+            if (double_from_string (v, &v, &fval))
+              self->can_skip_until = fval * (gdouble) GST_SECOND;
+          }
+        }
+      } else if (g_str_has_prefix (data_ext_x, "SKIP:")) {
+        gchar *v, *a;
+
+        data = data + 12;
+
+        while (data && parse_attributes (&data, &a, &v)) {
+          if (g_str_equal (a, "SKIPPED-SEGMENTS")) {
+            gint64 val64;
+
+            if (int64_from_string (v, &v, &val64) && val64 > 0) {
+              /* This is a delta playlist; the first val64 segments were
+               * omitted and will be re-used from the previous playlist.
+               * Media files that follow start val64 segments further on */
+              skip_first_sequence = mediasequence;
+              skipped_segments = val64;
+              mediasequence += skipped_segments;
+            }
+          }
+        }
       } else if (g_str_has_prefix (data_ext_x, "BYTERANGE:")) {
         gchar *v = data + 17;
 
@@ -690,6 +724,27 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
 
   self->files = g_list_reverse (self->files);
 
+  if (skipped_segments > 0) {
+    /* Delta playlist update (EXT-X-SKIP): re-use the segments the
+     * server omitted from our previous playlist */
+    GList *l, *skipped = NULL;
+
+    for (l = previous_files; l != NULL; l = l->next) {
+      GstM3U8MediaFile *file = l->data;
+
+      if (file->sequence >= skip_first_sequence
+          && file->sequence < skip_first_sequence + skipped_segments)
+        skipped = g_list_prepend (skipped, gst_m3u8_media_file_ref (file));
+    }
+
+    if ((gint64) g_list_length (skipped) != skipped_segments)
+      GST_WARNING ("Delta playlist skipped %" G_GINT64_FORMAT " segments "
+          "but only %u were found in the previous playlist",
+          skipped_segments, g_list_length (skipped));
+
+    self->files = g_list_concat (g_list_reverse (skipped), self->files);
+  }
+
   if (previous_files) {
     gboolean consistent = TRUE;
 
@@ -75,6 +75,9 @@ struct _GstM3U8
   GstClockTime last_file_end;         /* timecode of the end of the last fragment in the current media playlist */
   GstClockTime duration;              /* cached total duration */
   gint discont_sequence;              /* currently expected EXT-X-DISCONTINUITY-SEQUENCE */
+  GstClockTime can_skip_until;        /* EXT-X-SERVER-CONTROL CAN-SKIP-UNTIL,
+                                       * 0 if the server does not support
+                                       * delta playlist updates */
 
   /*< private > */
   gchar *last_data;
@@ -229,7 +229,7 @@ gst_libde265_dec_release_frame_ref (struct GstLibde265FrameRef *ref)
   }
   gst_video_codec_frame_unref (ref->frame);
   gst_buffer_replace (&ref->buffer, NULL);
-  g_free (ref);
+  g_slice_free (struct GstLibde265FrameRef, ref);
 }
 
 static int
@@ -282,8 +282,7 @@ gst_libde265_dec_get_buffer (de265_decoder_context * ctx,
     goto fallback;
   }
 
-  ref = (struct GstLibde265FrameRef *) g_malloc0 (sizeof (*ref));
-  g_assert (ref != NULL);
+  ref = g_slice_new0 (struct GstLibde265FrameRef);
   ref->decoder = base;
   ref->frame = frame;
 
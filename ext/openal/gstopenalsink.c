@@ -1002,9 +1002,12 @@ gst_openal_sink_write (GstAudioSink * audiosink, gpointer data, guint length)
   }
 
   queued -= processed;
-  while (processed-- > 0) {
-    ALuint bid;
-    alSourceUnqueueBuffers (sink->default_source, 1, &bid);
+  if (processed > 0) {
+    ALuint *bids = g_newa (ALuint, processed);
+
+    /* unqueue all processed buffers with a single call instead of one
+     * round trip into the library per buffer */
+    alSourceUnqueueBuffers (sink->default_source, processed, bids);
   }
   if (state == AL_STOPPED) {
     /* "Restore" from underruns (not actually needed, but it keeps delay
@@ -145,6 +145,8 @@ static void gst_cv_smooth_get_property (GObject * object, guint prop_id,
 
 static GstFlowReturn gst_cv_smooth_transform_ip (GstOpencvVideoFilter *
     filter, GstBuffer * buf, Mat img);
+static GstFlowReturn gst_cv_smooth_transform_ip_umat (GstOpencvVideoFilter *
+    filter, GstBuffer * buf, UMat & img);
 
 /* initialize the cvsmooth's class */
 static void
@@ -163,6 +165,8 @@ gst_cv_smooth_class_init (GstCvSmoothClass * klass)
   gobject_class->get_property = gst_cv_smooth_get_property;
 
   gstopencvbasefilter_class->cv_trans_ip_func = gst_cv_smooth_transform_ip;
+  gstopencvbasefilter_class->cv_trans_ip_umat_func =
+      gst_cv_smooth_transform_ip_umat;
 
   g_object_class_install_property (gobject_class, PROP_SMOOTH_TYPE,
       g_param_spec_enum ("type",
@@ -423,6 +427,58 @@ gst_cv_smooth_transform_ip (GstOpencvVideoFilter * base, GstBuffer * buf,
   return GST_FLOW_OK;
 }
 
+/* Same as gst_cv_smooth_transform_ip but operating on cv::UMat, so the
+ * filtering runs through the transparent API on the OpenCL device the
+ * base class uploaded the frame to */
+static GstFlowReturn
+gst_cv_smooth_transform_ip_umat (GstOpencvVideoFilter * base, GstBuffer * buf,
+    UMat & full_img)
+{
+  GstCvSmooth *filter = GST_CV_SMOOTH (base);
+  UMat img = full_img;
+
+  if (filter->positionx != 0 || filter->positiony != 0 ||
+      filter->width != G_MAXINT || filter->height != G_MAXINT) {
+    Size mat_size = img.size ();
+
+    /* if the effect would start outside the image, just skip it */
+    if (filter->positionx >= mat_size.width
+        || filter->positiony >= mat_size.height)
+      return GST_FLOW_OK;
+    /* explicitly account for empty area */
+    if (filter->width <= 0 || filter->height <= 0)
+      return GST_FLOW_OK;
+
+    Rect mat_rect (filter->positionx,
+        filter->positiony,
+        MIN (filter->width, mat_size.width - filter->positionx),
+        MIN (filter->height, mat_size.height - filter->positiony));
+
+    img = img (mat_rect);
+  }
+
+  switch (filter->type) {
+    case GST_SMOOTH_BLUR:
+      blur (img, img, Size (filter->kernelwidth, filter->kernelheight),
+          Point (-1, -1));
+      break;
+    case GST_SMOOTH_GAUSSIAN:
+      GaussianBlur (img, img, Size (filter->kernelwidth, filter->kernelheight),
+          filter->colorsigma, filter->colorsigma);
+      break;
+    case GST_SMOOTH_MEDIAN:
+      medianBlur (img, img, filter->kernelwidth);
+      break;
+    case GST_SMOOTH_BILATERAL:
+      bilateralFilter (img, img, -1, filter->colorsigma, 0.0);
+      break;
+    default:
+      break;
+  }
+
+  return GST_FLOW_OK;
+}
+
 gboolean
 gst_cv_smooth_plugin_init (GstPlugin * plugin)
 {
@@ -104,6 +104,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_face_detect_debug);
 #define DEFAULT_MIN_SIZE_WIDTH 30
 #define DEFAULT_MIN_SIZE_HEIGHT 30
 #define DEFAULT_MIN_STDDEV 0
+#define DEFAULT_DETECT_INTERVAL 1
 
 using namespace cv;
 /* Filter signals and args */
@@ -127,7 +128,8 @@ enum
   PROP_MIN_SIZE_WIDTH,
   PROP_MIN_SIZE_HEIGHT,
   PROP_UPDATES,
-  PROP_MIN_STDDEV
+  PROP_MIN_STDDEV,
+  PROP_DETECT_INTERVAL
 };
 
 
@@ -349,6 +351,23 @@ gst_face_detect_class_init (GstFaceDetectClass * klass)
           "little changes", 0, 255, DEFAULT_MIN_STDDEV,
           (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
+  /**
+   * GstFaceDetect:detect-interval:
+   *
+   * Run the cascade over the whole frame only every n frames. In between,
+   * detection is limited to the surroundings of the faces found on the
+   * previous frame, which is considerably cheaper. A face appearing
+   * elsewhere in the picture is only found on the next full scan.
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_DETECT_INTERVAL,
+      g_param_spec_int ("detect-interval", "Detect interval",
+          "Only scan the whole frame every n frames, tracking found faces "
+          "in between (1 = full scan on every frame)", 1, G_MAXINT,
+          DEFAULT_DETECT_INTERVAL,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
   gst_element_class_set_static_metadata (element_class,
       "facedetect",
       "Filter/Effect/Video",
@@ -377,14 +396,13 @@ gst_face_detect_init (GstFaceDetect * filter)
   filter->min_size_width = DEFAULT_MIN_SIZE_WIDTH;
   filter->min_size_height = DEFAULT_MIN_SIZE_HEIGHT;
   filter->min_stddev = DEFAULT_MIN_STDDEV;
-  filter->cvFaceDetect =
-      gst_face_detect_load_profile (filter, filter->face_profile);
-  filter->cvNoseDetect =
-      gst_face_detect_load_profile (filter, filter->nose_profile);
-  filter->cvMouthDetect =
-      gst_face_detect_load_profile (filter, filter->mouth_profile);
-  filter->cvEyesDetect =
-      gst_face_detect_load_profile (filter, filter->eyes_profile);
+  filter->detect_interval = DEFAULT_DETECT_INTERVAL;
+  filter->frames_since_scan = 0;
+
+  /* the classifier cascades are loaded lazily on stream start, so that
+   * merely instantiating the element (gst-inspect, autopluggers probing
+   * factories) does not pay for parsing four cascade files */
+  filter->profiles_pending = TRUE;
 
   gst_opencv_video_filter_set_in_place (GST_OPENCV_VIDEO_FILTER_CAST (filter),
       TRUE);
@@ -403,32 +421,33 @@ gst_face_detect_set_property (GObject * object, guint prop_id,
       if (filter->cvFaceDetect)
         delete (filter->cvFaceDetect);
       filter->face_profile = g_value_dup_string (value);
-      filter->cvFaceDetect =
-          gst_face_detect_load_profile (filter, filter->face_profile);
+      /* reloaded lazily before the next detection */
+      filter->cvFaceDetect = NULL;
+      filter->profiles_pending = TRUE;
       break;
     case PROP_NOSE_PROFILE:
       g_free (filter->nose_profile);
       if (filter->cvNoseDetect)
         delete (filter->cvNoseDetect);
       filter->nose_profile = g_value_dup_string (value);
-      filter->cvNoseDetect =
-          gst_face_detect_load_profile (filter, filter->nose_profile);
+      filter->cvNoseDetect = NULL;
+      filter->profiles_pending = TRUE;
       break;
     case PROP_MOUTH_PROFILE:
       g_free (filter->mouth_profile);
       if (filter->cvMouthDetect)
         delete (filter->cvMouthDetect);
       filter->mouth_profile = g_value_dup_string (value);
-      filter->cvMouthDetect =
-          gst_face_detect_load_profile (filter, filter->mouth_profile);
+      filter->cvMouthDetect = NULL;
+      filter->profiles_pending = TRUE;
       break;
     case PROP_EYES_PROFILE:
       g_free (filter->eyes_profile);
       if (filter->cvEyesDetect)
         delete (filter->cvEyesDetect);
       filter->eyes_profile = g_value_dup_string (value);
-      filter->cvEyesDetect =
-          gst_face_detect_load_profile (filter, filter->eyes_profile);
+      filter->cvEyesDetect = NULL;
+      filter->profiles_pending = TRUE;
       break;
     case PROP_DISPLAY:
       filter->display = g_value_get_boolean (value);
@@ -454,6 +473,9 @@ gst_face_detect_set_property (GObject * object, guint prop_id,
     case PROP_UPDATES:
       filter->updates = g_value_get_enum (value);
       break;
+    case PROP_DETECT_INTERVAL:
+      filter->detect_interval = g_value_get_int (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -503,6 +525,9 @@ gst_face_detect_get_property (GObject * object, guint prop_id,
     case PROP_UPDATES:
       g_value_set_enum (value, filter->updates);
       break;
+    case PROP_DETECT_INTERVAL:
+      g_value_set_int (value, filter->detect_interval);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -511,6 +536,31 @@ gst_face_detect_get_property (GObject * object, guint prop_id,
 
 /* GstElement vmethod implementations */
 
+/* (re)load the classifier cascades if any profile property changed
+ * since the last detection. Done once per change rather than per frame,
+ * so a broken profile path does not hit the disk over and over */
+static void
+gst_face_detect_ensure_profiles (GstFaceDetect * filter)
+{
+  if (!filter->profiles_pending)
+    return;
+
+  if (!filter->cvFaceDetect)
+    filter->cvFaceDetect =
+        gst_face_detect_load_profile (filter, filter->face_profile);
+  if (!filter->cvNoseDetect)
+    filter->cvNoseDetect =
+        gst_face_detect_load_profile (filter, filter->nose_profile);
+  if (!filter->cvMouthDetect)
+    filter->cvMouthDetect =
+        gst_face_detect_load_profile (filter, filter->mouth_profile);
+  if (!filter->cvEyesDetect)
+    filter->cvEyesDetect =
+        gst_face_detect_load_profile (filter, filter->eyes_profile);
+
+  filter->profiles_pending = FALSE;
+}
+
 /* this function handles the link with other elements */
 static gboolean
 gst_face_detect_set_caps (GstOpencvVideoFilter * transform, gint in_width,
@@ -521,6 +571,7 @@ gst_face_detect_set_caps (GstOpencvVideoFilter * transform, gint in_width,
 
   filter = GST_FACE_DETECT (transform);
 
+  gst_face_detect_ensure_profiles (filter);
   filter->cvGray.create (Size (in_width, in_height), CV_8UC1);
 
   return TRUE;
@@ -579,6 +630,9 @@ gst_face_detect_transform_ip (GstOpencvVideoFilter * base, GstBuffer * buf,
 {
   GstFaceDetect *filter = GST_FACE_DETECT (base);
 
+  /* pick up profile property changes made while streaming */
+  gst_face_detect_ensure_profiles (filter);
+
   if (filter->cvFaceDetect) {
     GstMessage *msg = NULL;
     GstStructure *s;
@@ -589,14 +643,56 @@ gst_face_detect_transform_ip (GstOpencvVideoFilter * base, GstBuffer * buf,
     vector < Rect > nose;
     vector < Rect > eyes;
     gboolean post_msg = FALSE;
+    gboolean full_scan;
 
     cvtColor (img, filter->cvGray, COLOR_RGB2GRAY);
 
-    gst_face_detect_run_detector (filter, filter->cvFaceDetect,
-        filter->min_size_width, filter->min_size_height,
-        Rect (0, 0,
-            filter->cvGray.size ().width, filter->cvGray.size ().height),
-        faces);
+    full_scan = filter->detect_interval <= 1 || filter->last_faces.empty () ||
+        filter->frames_since_scan >= (guint) (filter->detect_interval - 1);
+
+    if (full_scan) {
+      gst_face_detect_run_detector (filter, filter->cvFaceDetect,
+          filter->min_size_width, filter->min_size_height,
+          Rect (0, 0,
+              filter->cvGray.size ().width, filter->cvGray.size ().height),
+          faces);
+      filter->frames_since_scan = 0;
+    } else {
+      /* between full scans, only look around the faces found on the
+       * previous frame; pad each region by half the face size so that
+       * movement and scale changes between two frames stay inside it */
+      for (unsigned int i = 0; i < filter->last_faces.size (); ++i) {
+        Rect roi = filter->last_faces[i];
+        gint pad_w = roi.width / 2;
+        gint pad_h = roi.height / 2;
+        vector < Rect > roi_faces;
+
+        roi.x = MAX (roi.x - pad_w, 0);
+        roi.y = MAX (roi.y - pad_h, 0);
+        roi.width = MIN (roi.width + 2 * pad_w,
+            filter->cvGray.size ().width - roi.x);
+        roi.height = MIN (roi.height + 2 * pad_h,
+            filter->cvGray.size ().height - roi.y);
+
+        gst_face_detect_run_detector (filter, filter->cvFaceDetect,
+            filter->min_size_width, filter->min_size_height, roi, roi_faces);
+
+        for (unsigned int j = 0; j < roi_faces.size (); ++j) {
+          Rect face = roi_faces[j];
+
+          face.x += roi.x;
+          face.y += roi.y;
+          faces.push_back (face);
+        }
+      }
+      filter->frames_since_scan++;
+      /* a tracked face disappeared; rescan the whole frame right on the
+       * next one to re-acquire it */
+      if (faces.empty ())
+        filter->frames_since_scan = filter->detect_interval;
+    }
+
+    filter->last_faces = faces;
 
     switch (filter->updates) {
       case GST_FACEDETECT_UPDATES_EVERY_FRAME:
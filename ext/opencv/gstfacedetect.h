@@ -102,6 +102,16 @@ struct _GstFaceDetect
   gint min_size_height;
   gint min_stddev;
   gint updates;
+  gint detect_interval;
+
+  /* faces found on the previous frame, used to limit detection to their
+   * surroundings between two full-frame scans */
+  std::vector < cv::Rect > last_faces;
+  guint frames_since_scan;
+
+  /* TRUE when a profile property changed and the classifiers below need
+   * (re)loading before the next detection */
+  gboolean profiles_pending;
 
   cv::Mat cvGray;
   cv::CascadeClassifier *cvFaceDetect;
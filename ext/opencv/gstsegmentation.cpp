@@ -432,16 +432,20 @@ gst_segmentation_transform_ip (GstOpencvVideoFilter * cvfilter,
   }
 
   /*  if we want to test_mode, just overwrite the output */
-  std::vector < cv::Mat > channels (3);
+  std::vector < cv::Mat > channels;
 
   if (filter->test_mode) {
     cvtColor (filter->cvFG, filter->cvRGB, COLOR_GRAY2RGB);
 
     split (filter->cvRGB, channels);
-  } else
+    channels.push_back (filter->cvFG);
+  } else {
+    /* replace the alpha plane instead of appending a fifth channel,
+     * merging five channels would reallocate the Mat and the result
+     * would never reach the output buffer */
     split (img, channels);
-
-  channels.push_back (filter->cvFG);
+    channels[3] = filter->cvFG;
+  }
 
   /*  copy anyhow the fg/bg to the alpha channel in the output image */
   merge (channels, img);
@@ -29,6 +29,7 @@
 
 #include <ImfRgbaFile.h>
 #include <ImfIO.h>
+#include <ImfThreading.h>
 using namespace Imf;
 using namespace Imath;
 
@@ -158,9 +159,23 @@ static gboolean
 gst_openexr_dec_start (GstVideoDecoder * decoder)
 {
   GstOpenEXRDec *self = GST_OPENEXR_DEC (decoder);
+  guint i;
 
   GST_DEBUG_OBJECT (self, "Starting");
 
+  /* let readPixels() decompress scanline blocks on all cores */
+  setGlobalThreadCount (g_get_num_processors ());
+
+  /* precompute the half-float to 16 bit integer conversion for all 65536
+   * bit patterns, the output loop is then a plain table lookup per channel */
+  self->half_lut = g_new (guint16, 65536);
+  for (i = 0; i < 65536; i++) {
+    half h;
+
+    h.setBits (i);
+    self->half_lut[i] = CLAMP (((float) h) * 65536, 0, 65535);
+  }
+
   return TRUE;
 }
 
@@ -181,6 +196,9 @@ gst_openexr_dec_stop (GstVideoDecoder * video_decoder)
     self->input_state = NULL;
   }
 
+  g_free (self->half_lut);
+  self->half_lut = NULL;
+
   GST_DEBUG_OBJECT (self, "Stopped");
 
   return TRUE;
@@ -421,6 +439,7 @@ gst_openexr_dec_handle_frame (GstVideoDecoder * decoder,
   gint i, j;
   guint16 *dest = (guint16 *) GST_VIDEO_FRAME_PLANE_DATA (&vframe, 0);
   guint dstride = GST_VIDEO_FRAME_PLANE_STRIDE (&vframe, 0);
+  const guint16 *lut = self->half_lut;
   Rgba *ptr = fb;
 
   /* TODO: Use displayWindow here and also support output of ARGB_F16
@@ -428,10 +447,10 @@ gst_openexr_dec_handle_frame (GstVideoDecoder * decoder,
    * other things */
   for (i = 0; i < height; i++) {
     for (j = 0; j < width; j++) {
-      dest[4 * j + 0] = CLAMP (((float) ptr->a) * 65536, 0, 65535);
-      dest[4 * j + 1] = CLAMP (((float) ptr->r) * 65536, 0, 65535);
-      dest[4 * j + 2] = CLAMP (((float) ptr->g) * 65536, 0, 65535);
-      dest[4 * j + 3] = CLAMP (((float) ptr->b) * 65536, 0, 65535);
+      dest[4 * j + 0] = lut[ptr->a.bits ()];
+      dest[4 * j + 1] = lut[ptr->r.bits ()];
+      dest[4 * j + 2] = lut[ptr->g.bits ()];
+      dest[4 * j + 3] = lut[ptr->b.bits ()];
       ptr++;
     }
     dest += dstride / 2;
@@ -49,6 +49,9 @@ struct _GstOpenEXRDec
   /* < private > */
   GstVideoCodecState *input_state;
   GstVideoCodecState *output_state;
+
+  /* maps half-float bit patterns to 16 bit integer channel values */
+  guint16 *half_lut;
 };
 
 struct _GstOpenEXRDecClass
@@ -822,6 +822,7 @@ gst_openh264enc_handle_frame (GstVideoEncoder * encoder,
     GstVideoCodecFrame * frame)
 {
   GstOpenh264Enc *openh264enc = GST_OPENH264ENC (encoder);
+  SSourcePicture pic;
   SSourcePicture *src_pic = NULL;
   GstVideoFrame video_frame;
   gboolean force_keyframe;
@@ -864,13 +865,9 @@ gst_openh264enc_handle_frame (GstVideoEncoder * encoder,
   GST_OBJECT_UNLOCK (openh264enc);
 
   if (frame) {
-    src_pic = new SSourcePicture;
+    src_pic = &pic;
+    memset (src_pic, 0, sizeof (SSourcePicture));
 
-    if (src_pic == NULL) {
-      if (frame)
-        gst_video_codec_frame_unref (frame);
-      return GST_FLOW_ERROR;
-    }
     //fill default src_pic
     src_pic->iColorFormat = videoFormatI420;
     src_pic->uiTimeStamp = frame->pts / GST_MSECOND;
@@ -919,7 +916,6 @@ gst_openh264enc_handle_frame (GstVideoEncoder * encoder,
     if (frame) {
       gst_video_frame_unmap (&video_frame);
       gst_video_codec_frame_unref (frame);
-      delete src_pic;
       GST_ELEMENT_ERROR (openh264enc, STREAM, ENCODE,
           ("Could not encode frame"), ("Openh264 returned %d", ret));
       return GST_FLOW_ERROR;
@@ -932,7 +928,6 @@ gst_openh264enc_handle_frame (GstVideoEncoder * encoder,
     if (frame) {
       gst_video_frame_unmap (&video_frame);
       gst_video_encoder_finish_frame (encoder, frame);
-      delete src_pic;
     }
 
     return GST_FLOW_OK;
@@ -941,7 +936,6 @@ gst_openh264enc_handle_frame (GstVideoEncoder * encoder,
   if (frame) {
     gst_video_frame_unmap (&video_frame);
     gst_video_codec_frame_unref (frame);
-    delete src_pic;
     src_pic = NULL;
     frame = NULL;
   }
@@ -1110,6 +1110,14 @@ gst_openjpeg_dec_handle_frame (GstVideoDecoder * decoder,
     params.jpwl_exp_comps = self->ncomps;
   opj_setup_decoder (dec, &params);
 
+#if !defined(HAVE_OPENJPEG_1) && defined(OPJ_VERSION_MAJOR) && \
+    (OPJ_VERSION_MAJOR > 2 || OPJ_VERSION_MINOR >= 2)
+  /* Spread tile and codeblock decoding over all cores, a single 4K frame
+   * is otherwise limited to one core */
+  if (opj_has_thread_support ())
+    opj_codec_set_threads (dec, g_get_num_processors ());
+#endif
+
   if (!gst_buffer_map (frame->input_buffer, &map, GST_MAP_READ))
     goto map_read_error;
 
@@ -915,6 +915,14 @@ gst_openjpeg_enc_handle_frame (GstVideoEncoder * encoder,
   }
   opj_setup_encoder (enc, &self->params, image);
 
+#if !defined(HAVE_OPENJPEG_1) && defined(OPJ_VERSION_MAJOR) && \
+    (OPJ_VERSION_MAJOR > 2 || OPJ_VERSION_MINOR >= 3)
+  /* Spread DWT and codeblock coding over all cores, a single 4K frame
+   * is otherwise limited to one core */
+  if (opj_has_thread_support ())
+    opj_codec_set_threads (enc, g_get_num_processors ());
+#endif
+
 #ifdef HAVE_OPENJPEG_1
   io = opj_cio_open ((opj_common_ptr) enc, NULL, 0);
   if (!io)
@@ -374,6 +374,12 @@ rsn_dvdsrc_start (GstBaseSrc * bsrc)
     goto fail;
   }
 
+  /* Turn on the read-ahead cache, so libdvdnav reads whole VOBUs at a time
+   * instead of issuing a blocking read per 2kB block on the streaming
+   * thread. Not fatal if it fails, playback just reads block by block */
+  if (dvdnav_set_readahead_flag (src->dvdnav, 1) != DVDNAV_STATUS_OK)
+    GST_WARNING_OBJECT (src, "Failed to enable libdvdnav read-ahead cache");
+
   /* Attempt to set DVD menu, audio and spu languages */
   langs = g_get_language_names ();
   strncpy (lang, DEFAULT_LANG, 8);
@@ -223,7 +223,7 @@ gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
 {
   GstRTMPSink *sink = GST_RTMP_SINK (bsink);
   gboolean need_unref = FALSE;
-  GstMapInfo map = GST_MAP_INFO_INIT;
+  guint i, n_mem;
 
   if (sink->rtmp == NULL) {
     /* Do not crash */
@@ -266,12 +266,26 @@ gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   GST_LOG_OBJECT (sink, "Sending %" G_GSIZE_FORMAT " bytes to RTMP server",
       gst_buffer_get_size (buf));
 
-  gst_buffer_map (buf, &map, GST_MAP_READ);
-
-  if (RTMP_Write (sink->rtmp, (char *) map.data, map.size) <= 0)
-    goto write_failed;
+  /* Feed the buffer's memories to librtmp one at a time; RTMP_Write()
+   * keeps its FLV parsing state between calls, and mapping the memories
+   * individually avoids merging a multi-memory buffer into one
+   * contiguous copy first */
+  n_mem = gst_buffer_n_memory (buf);
+  for (i = 0; i < n_mem; i++) {
+    GstMemory *mem = gst_buffer_peek_memory (buf, i);
+    GstMapInfo map;
+
+    if (!gst_memory_map (mem, &map, GST_MAP_READ))
+      goto write_failed;
+
+    if (map.size > 0
+        && RTMP_Write (sink->rtmp, (char *) map.data, map.size) <= 0) {
+      gst_memory_unmap (mem, &map);
+      goto write_failed;
+    }
+    gst_memory_unmap (mem, &map);
+  }
 
-  gst_buffer_unmap (buf, &map);
   if (need_unref)
     gst_buffer_unref (buf);
 
@@ -281,7 +295,6 @@ gst_rtmp_sink_render (GstBaseSink * bsink, GstBuffer * buf)
 write_failed:
   {
     GST_ELEMENT_ERROR (sink, RESOURCE, WRITE, (NULL), ("Failed to write data"));
-    gst_buffer_unmap (buf, &map);
     if (need_unref)
       gst_buffer_unref (buf);
     sink->have_write_error = TRUE;
@@ -810,7 +810,11 @@ on_sctp_packet_out (GstSctpAssociation * _association, const guint8 * buf,
   GList *pending_pads, *l;
   GstSctpEncPad *sctpenc_pad;
 
-  gstbuf = gst_buffer_new_wrapped (g_memdup (buf, length), length);
+  /* the packet only stays valid for the duration of this callback, so a
+   * copy cannot be avoided; allocating the memory together with the buffer
+   * at least keeps it to a single allocation */
+  gstbuf = gst_buffer_new_allocate (NULL, length, NULL);
+  gst_buffer_fill (gstbuf, 0, buf, length);
 
   item = g_new0 (GstDataQueueItem, 1);
   item->object = GST_MINI_OBJECT (gstbuf);
@@ -178,6 +178,15 @@ gst_sctp_association_init (GstSctpAssociation * self)
   if (number_of_associations == 0) {
     usrsctp_init (0, sctp_packet_out, g_print);
 
+#ifdef HAVE_USRSCTP_CRC32C_OFFLOAD
+    /* The packets enter and leave the stack through usrsctp_conninput() and
+     * sctp_packet_out(), riding on a transport (DTLS for WebRTC data
+     * channels) that already guarantees their integrity. Let usrsctp skip
+     * the software CRC32c verification pass over every received packet and
+     * stamp outgoing packets ourselves in sctp_packet_out(). */
+    usrsctp_enable_crc32c_offload ();
+#endif
+
     /* Explicit Congestion Notification */
     usrsctp_sysctl_set_sctp_ecn_enable (0);
 
@@ -666,6 +675,16 @@ sctp_packet_out (void *addr, void *buffer, size_t length, guint8 tos,
 {
   GstSctpAssociation *self = GST_SCTP_ASSOCIATION (addr);
 
+#ifdef HAVE_USRSCTP_CRC32C_OFFLOAD
+  /* with checksum offloading enabled the stack leaves the CRC zeroed and
+   * expects us to fill it in before the packet goes on the wire */
+  if (length >= 12) {
+    guint32 crc = usrsctp_crc32c (buffer, length);
+
+    memcpy ((guint8 *) buffer + 8, &crc, sizeof (crc));
+  }
+#endif
+
   if (self->packet_out_cb) {
     self->packet_out_cb (self, buffer, length, self->packet_out_user_data);
   }
@@ -81,11 +81,21 @@ struct _GstMssStream
   GstAdapter *live_adapter;
 
   GList *fragments;
+  /* list nodes of @fragments in timeline order, for bisecting in seeks;
+   * rebuilt whenever the fragments list changes */
+  GPtrArray *fragment_index;
   GList *qualities;
 
   gchar *url;
   gchar *lang;
 
+  /* @url with the bitrate placeholder substituted for the current quality
+   * and split at the start time placeholder, so that building a fragment
+   * url is a single printf instead of two regex passes; a NULL prefix
+   * means the template couldn't be split and the regexes are used */
+  gchar *url_template_prefix;
+  gchar *url_template_suffix;
+
   GstMssFragmentParser fragment_parser;
 
   guint fragment_repetition_index;
@@ -243,6 +253,56 @@ compare_bitrate (GstMssStreamQuality * a, GstMssStreamQuality * b)
 
 }
 
+static void
+gst_mss_stream_rebuild_fragment_index (GstMssStream * stream)
+{
+  GList *iter;
+
+  if (stream->fragment_index == NULL)
+    stream->fragment_index = g_ptr_array_new ();
+  else
+    g_ptr_array_set_size (stream->fragment_index, 0);
+
+  for (iter = stream->fragments; iter; iter = g_list_next (iter))
+    g_ptr_array_add (stream->fragment_index, iter);
+}
+
+static void
+gst_mss_stream_update_url_template (GstMssStream * stream)
+{
+  GMatchInfo *match = NULL;
+  GstMssStreamQuality *quality;
+  gchar *tmp;
+  gint start, end;
+
+  g_free (stream->url_template_prefix);
+  g_free (stream->url_template_suffix);
+  stream->url_template_prefix = NULL;
+  stream->url_template_suffix = NULL;
+
+  if (stream->url == NULL || stream->current_quality == NULL)
+    return;
+
+  quality = stream->current_quality->data;
+  tmp = g_regex_replace_literal (stream->regex_bitrate, stream->url,
+      strlen (stream->url), 0, quality->bitrate_str, 0, NULL);
+  if (tmp == NULL)
+    return;
+
+  /* only usable when the start time placeholder appears exactly once,
+   * otherwise gst_mss_stream_get_fragment_url() keeps using the regexes */
+  if (g_regex_match (stream->regex_position, tmp, 0, &match) &&
+      g_match_info_fetch_pos (match, 0, &start, &end) &&
+      !g_match_info_next (match, NULL)) {
+    stream->url_template_prefix = g_strndup (tmp, start);
+    stream->url_template_suffix = g_strdup (tmp + end);
+  }
+
+  if (match)
+    g_match_info_free (match);
+  g_free (tmp);
+}
+
 static void
 _gst_mss_stream_init (GstMssManifest * manifest, GstMssStream * stream,
     xmlNodePtr node)
@@ -288,6 +348,7 @@ _gst_mss_stream_init (GstMssManifest * manifest, GstMssStream * stream,
     stream->fragments = g_list_reverse (builder.fragments);
     stream->current_fragment = stream->fragments;
   }
+  gst_mss_stream_rebuild_fragment_index (stream);
 
   /* order them from smaller to bigger based on bitrates */
   stream->qualities =
@@ -297,6 +358,8 @@ _gst_mss_stream_init (GstMssManifest * manifest, GstMssStream * stream,
   stream->regex_bitrate = g_regex_new ("\\{[Bb]itrate\\}", 0, 0, NULL);
   stream->regex_position = g_regex_new ("\\{start[ _]time\\}", 0, 0, NULL);
 
+  gst_mss_stream_update_url_template (stream);
+
   gst_mss_fragment_parser_init (&stream->fragment_parser);
 }
 
@@ -423,10 +486,14 @@ gst_mss_stream_free (GstMssStream * stream)
   }
 
   g_list_free_full (stream->fragments, g_free);
+  if (stream->fragment_index)
+    g_ptr_array_free (stream->fragment_index, TRUE);
   g_list_free_full (stream->qualities,
       (GDestroyNotify) gst_mss_stream_quality_free);
   xmlFree (stream->url);
   xmlFree (stream->lang);
+  g_free (stream->url_template_prefix);
+  g_free (stream->url_template_suffix);
   g_regex_unref (stream->regex_position);
   g_regex_unref (stream->regex_bitrate);
   gst_mss_fragment_parser_clear (&stream->fragment_parser);
@@ -1052,6 +1119,13 @@ gst_mss_stream_get_fragment_url (GstMssStream * stream, gchar ** url)
 
   time =
       fragment->time + fragment->duration * stream->fragment_repetition_index;
+
+  if (stream->url_template_prefix) {
+    *url = g_strdup_printf ("%s%" G_GUINT64_FORMAT "%s",
+        stream->url_template_prefix, time, stream->url_template_suffix);
+    return GST_FLOW_OK;
+  }
+
   start_time_str = g_strdup_printf ("%" G_GUINT64_FORMAT, time);
 
   tmp = g_regex_replace_literal (stream->regex_bitrate, stream->url,
@@ -1232,42 +1306,62 @@ gst_mss_stream_seek (GstMssStream * stream, gboolean forward,
   time = gst_util_uint64_scale_round (time, timescale, GST_SECOND);
 
   GST_DEBUG ("Stream %s seeking to %" G_GUINT64_FORMAT, stream->url, time);
-  for (iter = stream->fragments; iter; iter = g_list_next (iter)) {
+
+  /* bisect for the first fragment whose interval ends after the target
+   * time; the index holds the list nodes in timeline order */
+  iter = NULL;
+  if (stream->fragment_index->len > 0) {
+    guint lo = 0, hi = stream->fragment_index->len;
+
+    while (lo < hi) {
+      guint mid = lo + (hi - lo) / 2;
+      GstMssStreamFragment *frag =
+          ((GList *) g_ptr_array_index (stream->fragment_index, mid))->data;
+
+      if (frag->time + frag->repetitions * frag->duration > time)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+    if (lo < stream->fragment_index->len)
+      iter = g_ptr_array_index (stream->fragment_index, lo);
+    else
+      fragment = ((GList *) g_ptr_array_index (stream->fragment_index,
+              stream->fragment_index->len - 1))->data;
+  }
+
+  if (iter != NULL) {
     fragment = iter->data;
-    if (fragment->time + fragment->repetitions * fragment->duration > time) {
-      stream->current_fragment = iter;
-      stream->fragment_repetition_index =
-          (time - fragment->time) / fragment->duration;
-      if (((time - fragment->time) % fragment->duration) == 0) {
-
-        /* for reverse playback, start from the previous fragment when we are
-         * exactly at a limit */
-        if (!forward)
-          stream->fragment_repetition_index--;
-      } else if (SNAP_AFTER (forward, flags))
-        stream->fragment_repetition_index++;
-
-      if (stream->fragment_repetition_index == fragment->repetitions) {
-        /* move to the next one */
+    stream->current_fragment = iter;
+    stream->fragment_repetition_index =
+        (time - fragment->time) / fragment->duration;
+    if (((time - fragment->time) % fragment->duration) == 0) {
+
+      /* for reverse playback, start from the previous fragment when we are
+       * exactly at a limit */
+      if (!forward)
+        stream->fragment_repetition_index--;
+    } else if (SNAP_AFTER (forward, flags))
+      stream->fragment_repetition_index++;
+
+    if (stream->fragment_repetition_index == fragment->repetitions) {
+      /* move to the next one */
+      stream->fragment_repetition_index = 0;
+      stream->current_fragment = g_list_next (iter);
+      fragment =
+          stream->current_fragment ? stream->current_fragment->data : NULL;
+
+    } else if (stream->fragment_repetition_index == -1) {
+      if (g_list_previous (iter)) {
+        stream->current_fragment = g_list_previous (iter);
+        fragment = stream->current_fragment->data;
+        g_assert (fragment);
+        stream->fragment_repetition_index = fragment->repetitions - 1;
+      } else {
         stream->fragment_repetition_index = 0;
-        stream->current_fragment = g_list_next (iter);
-        fragment =
-            stream->current_fragment ? stream->current_fragment->data : NULL;
-
-      } else if (stream->fragment_repetition_index == -1) {
-        if (g_list_previous (iter)) {
-          stream->current_fragment = g_list_previous (iter);
-          fragment = stream->current_fragment->data;
-          g_assert (fragment);
-          stream->fragment_repetition_index = fragment->repetitions - 1;
-        } else {
-          stream->fragment_repetition_index = 0;
-        }
       }
-
-      break;
     }
-
   }
 
   GST_DEBUG ("Stream %s seeked to fragment time %" G_GUINT64_FORMAT
@@ -1340,6 +1434,7 @@ gst_mss_stream_reload_fragments (GstMssStream * stream, xmlNodePtr streamIndex)
     g_list_free_full (stream->fragments, g_free);
     stream->fragments = g_list_reverse (builder.fragments);
     stream->current_fragment = stream->fragments;
+    gst_mss_stream_rebuild_fragment_index (stream);
     /* TODO Verify how repositioning here works for reverse
      * playback - it might start from the wrong fragment */
     gst_mss_stream_seek (stream, TRUE, 0, current_gst_time, NULL);
@@ -1421,6 +1516,7 @@ gst_mss_stream_select_bitrate (GstMssStream * stream, guint64 bitrate)
   if (iter == stream->current_quality)
     return FALSE;
   stream->current_quality = iter;
+  gst_mss_stream_update_url_template (stream);
   return TRUE;
 }
 
@@ -1648,6 +1744,7 @@ gst_mss_stream_parse_fragment (GstMssStream * stream, GstBuffer * buffer)
     fragment->duration = parsed_duration;
 
     stream->fragments = g_list_append (stream->fragments, fragment);
+    gst_mss_stream_rebuild_fragment_index (stream);
     GST_LOG ("Adding fragment number: %u to %s stream, time: %"
         G_GUINT64_FORMAT ", duration: %" G_GUINT64_FORMAT ", repetitions: %u",
         fragment->number, stream_type_name, fragment->time,
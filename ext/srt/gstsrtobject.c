@@ -116,6 +116,7 @@ static struct srt_constant_params srt_params[] = {
   {"SRTO_RCVSYN", SRTO_RCVSYN, 0},      /* 0: non-blocking */
   {"SRTO_LINGER", SRTO_LINGER, 0},
   {"SRTO_TSBPMODE", SRTO_TSBPDMODE, 1}, /* Timestamp-based Packet Delivery mode must be enabled */
+  {"SRTO_TLPKTDROP", SRTO_TLPKTDROP, 1},        /* Drop packets that cannot be delivered within the latency budget */
   {NULL, -1, -1},
 };
 
@@ -1451,11 +1452,16 @@ gst_srt_object_get_stats (GstSRTObject * srtobject)
         /* number of too-late-to-send dropped packets */
         "packets-sent-dropped", G_TYPE_INT, stats.pktSndDrop,
         /* sending rate in Mb/s */
-        "send-rate-mbps", G_TYPE_DOUBLE, stats.msRTT,
+        "send-rate-mbps", G_TYPE_DOUBLE, stats.mbpsSendRate,
         /* estimated bandwidth, in Mb/s */
         "bandwidth-mbps", G_TYPE_DOUBLE, stats.mbpsBandwidth,
         /* busy sending time (i.e., idle time exclusive) */
         "send-duration-us", G_TYPE_UINT64, stats.usSndDuration,
+        /* fill level of the send buffer; how much data is queued
+         * ahead of the link right now */
+        "snd-buffer-packets", G_TYPE_INT, stats.pktSndBuf,
+        "snd-buffer-bytes", G_TYPE_INT, stats.byteSndBuf,
+        "snd-buffer-ms", G_TYPE_INT, stats.msSndBuf,
         "rtt-ms", G_TYPE_DOUBLE, stats.msRTT,
         "negotiated-latency-ms", G_TYPE_INT, stats.msSndTsbPdDelay, NULL);
   }
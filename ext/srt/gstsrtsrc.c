@@ -101,6 +101,7 @@ gst_srt_src_start (GstBaseSrc * bsrc)
   GError *error = NULL;
   gboolean ret = FALSE;
   GstSRTConnectionMode connection_mode = GST_SRT_CONNECTION_MODE_NONE;
+  GstStructure *config;
 
   gst_structure_get_enum (self->srtobject->parameters, "mode",
       GST_TYPE_SRT_CONNECTION_MODE, (gint *) & connection_mode);
@@ -116,9 +117,23 @@ gst_srt_src_start (GstBaseSrc * bsrc)
   if (!ret) {
     GST_WARNING_OBJECT (self, "Failed to open SRT: %s", error->message);
     g_clear_error (&error);
+    return FALSE;
   }
 
-  return ret;
+  /* All receive buffers are blocksize bytes, so recycle them through a
+   * pool instead of allocating a fresh one per packet */
+  self->pool = gst_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (self->pool);
+  gst_buffer_pool_config_set_params (config, NULL,
+      gst_base_src_get_blocksize (bsrc), 0, 0);
+  if (!gst_buffer_pool_set_config (self->pool, config)
+      || !gst_buffer_pool_set_active (self->pool, TRUE)) {
+    GST_WARNING_OBJECT (self,
+        "Failed to activate buffer pool, falling back to plain allocation");
+    g_clear_object (&self->pool);
+  }
+
+  return TRUE;
 }
 
 static gboolean
@@ -126,11 +141,30 @@ gst_srt_src_stop (GstBaseSrc * bsrc)
 {
   GstSRTSrc *self = GST_SRT_SRC (bsrc);
 
+  if (self->pool) {
+    gst_buffer_pool_set_active (self->pool, FALSE);
+    g_clear_object (&self->pool);
+  }
+
   gst_srt_object_close (self->srtobject);
 
   return TRUE;
 }
 
+static GstFlowReturn
+gst_srt_src_alloc (GstBaseSrc * bsrc, guint64 offset, guint size,
+    GstBuffer ** buffer)
+{
+  GstSRTSrc *self = GST_SRT_SRC (bsrc);
+
+  /* The pool only carries blocksize-sized buffers; anything else goes
+   * through the default allocation path */
+  if (self->pool && size == gst_base_src_get_blocksize (bsrc))
+    return gst_buffer_pool_acquire_buffer (self->pool, buffer, NULL);
+
+  return GST_BASE_SRC_CLASS (parent_class)->alloc (bsrc, offset, size, buffer);
+}
+
 static GstFlowReturn
 gst_srt_src_fill (GstPushSrc * src, GstBuffer * outbuf)
 {
@@ -308,6 +342,7 @@ gst_srt_src_class_init (GstSRTSrcClass * klass)
   gstbasesrc_class->stop = GST_DEBUG_FUNCPTR (gst_srt_src_stop);
   gstbasesrc_class->unlock = GST_DEBUG_FUNCPTR (gst_srt_src_unlock);
   gstbasesrc_class->unlock_stop = GST_DEBUG_FUNCPTR (gst_srt_src_unlock_stop);
+  gstbasesrc_class->alloc = GST_DEBUG_FUNCPTR (gst_srt_src_alloc);
 
   gstpushsrc_class->fill = GST_DEBUG_FUNCPTR (gst_srt_src_fill);
 }
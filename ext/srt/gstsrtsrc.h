@@ -49,6 +49,10 @@ struct _GstSRTSrc {
 
   GstSRTObject *srtobject;
   GCancellable *cancellable;
+
+  /* Pool the receive buffers are recycled through, so that we don't
+   * allocate a fresh buffer for every packet */
+  GstBufferPool *pool;
 };
 
 struct _GstSRTSrcClass {
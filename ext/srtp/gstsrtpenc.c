@@ -166,6 +166,7 @@ typedef struct ProcessBufferItData
   GstPad *pad;
   GstBufferList *out_list;
   GstFlowReturn flowret;
+  srtp_err_status_t err;
   gboolean is_rtcp;
 } ProcessBufferItData;
 
@@ -1095,11 +1096,14 @@ gst_srtp_enc_check_set_caps (GstSrtpEnc * filter, GstPad * pad,
   return GST_FLOW_OK;
 }
 
+/* Protects one buffer with the SRTP session. Must be called with the object
+ * lock held and a valid session; on failure @err_out carries the libsrtp
+ * status so the caller can report it once the lock has been dropped. */
 static GstFlowReturn
-gst_srtp_enc_process_buffer (GstSrtpEnc * filter, GstPad * pad,
-    GstBuffer * buf, gboolean is_rtcp, GstBuffer ** outbuf_ptr)
+gst_srtp_enc_protect_buffer (GstSrtpEnc * filter, GstPad * pad,
+    GstBuffer * buf, gboolean is_rtcp, GstBuffer ** outbuf_ptr,
+    srtp_err_status_t * err_out)
 {
-  GstFlowReturn ret = GST_FLOW_OK;
   gint size_max, size;
   GstBuffer *bufout = NULL;
   GstMapInfo mapout;
@@ -1114,16 +1118,6 @@ gst_srtp_enc_process_buffer (GstSrtpEnc * filter, GstPad * pad,
 
   gst_buffer_extract (buf, 0, mapout.data, size);
 
-  GST_OBJECT_LOCK (filter);
-
-  gst_srtp_init_event_reporter ();
-
-  if (filter->session == NULL) {
-    /* The rtcp session disappeared (element shutting down) */
-    GST_OBJECT_UNLOCK (filter);
-    ret = GST_FLOW_FLUSHING;
-    goto fail;
-  }
 #ifdef HAVE_SRTP2
   if (is_rtcp)
     err = srtp_protect_rtcp_mki (filter->session, mapout.data, &size,
@@ -1138,39 +1132,65 @@ gst_srtp_enc_process_buffer (GstSrtpEnc * filter, GstPad * pad,
     err = srtp_protect (filter->session, mapout.data, &size);
 #endif
 
-  GST_OBJECT_UNLOCK (filter);
-
   gst_buffer_unmap (bufout, &mapout);
 
-  if (err == srtp_err_status_ok) {
-    /* Buffer protected */
-    gst_buffer_set_size (bufout, size);
-    gst_buffer_copy_into (bufout, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  *err_out = err;
+
+  if (err != srtp_err_status_ok) {
+    /* srtp_protect failed */
+    gst_buffer_unref (bufout);
+    return GST_FLOW_ERROR;
+  }
 
-    GST_LOG_OBJECT (pad, "Encoding %s buffer of size %d",
-        is_rtcp ? "RTCP" : "RTP", size);
+  /* Buffer protected */
+  gst_buffer_set_size (bufout, size);
+  gst_buffer_copy_into (bufout, buf, GST_BUFFER_COPY_METADATA, 0, -1);
 
-  } else if (err == srtp_err_status_key_expired) {
+  GST_LOG_OBJECT (pad, "Encoding %s buffer of size %d",
+      is_rtcp ? "RTCP" : "RTP", size);
+
+  *outbuf_ptr = bufout;
+  return GST_FLOW_OK;
+}
 
+static void
+gst_srtp_enc_report_protect_error (GstSrtpEnc * filter, srtp_err_status_t err)
+{
+  if (err == srtp_err_status_key_expired) {
     GST_ELEMENT_ERROR (GST_ELEMENT_CAST (filter), STREAM, ENCODE,
         ("Key usage limit has been reached"),
         ("Unable to protect buffer (hard key usage limit reached)"));
-    ret = GST_FLOW_ERROR;
-    goto fail;
-
   } else {
-    /* srtp_protect failed */
     GST_ELEMENT_ERROR (filter, LIBRARY, FAILED, (NULL),
         ("Unable to protect buffer (protect failed) code %d", err));
-    ret = GST_FLOW_ERROR;
-    goto fail;
   }
+}
 
-  *outbuf_ptr = bufout;
-  return ret;
+static GstFlowReturn
+gst_srtp_enc_process_buffer (GstSrtpEnc * filter, GstPad * pad,
+    GstBuffer * buf, gboolean is_rtcp, GstBuffer ** outbuf_ptr)
+{
+  GstFlowReturn ret;
+  srtp_err_status_t err = srtp_err_status_ok;
+
+  GST_OBJECT_LOCK (filter);
+
+  gst_srtp_init_event_reporter ();
+
+  if (filter->session == NULL) {
+    /* The rtcp session disappeared (element shutting down) */
+    GST_OBJECT_UNLOCK (filter);
+    return GST_FLOW_FLUSHING;
+  }
+
+  ret = gst_srtp_enc_protect_buffer (filter, pad, buf, is_rtcp, outbuf_ptr,
+      &err);
+
+  GST_OBJECT_UNLOCK (filter);
+
+  if (ret != GST_FLOW_OK)
+    gst_srtp_enc_report_protect_error (filter, err);
 
-fail:
-  gst_buffer_unref (bufout);
   return ret;
 }
 
@@ -1233,8 +1253,9 @@ process_buffer_it (GstBuffer ** buffer, guint index, gpointer user_data)
   GstBuffer *bufout;
   GstFlowReturn ret;
 
-  ret = gst_srtp_enc_process_buffer (data->filter, data->pad, *buffer,
-      data->is_rtcp, &bufout);
+  /* The list is protected as one batch: our caller holds the object lock */
+  ret = gst_srtp_enc_protect_buffer (data->filter, data->pad, *buffer,
+      data->is_rtcp, &bufout, &data->err);
   if (ret != GST_FLOW_OK) {
     data->flowret = ret;
     return FALSE;
@@ -1281,12 +1302,32 @@ gst_srtp_enc_chain_list (GstPad * pad, GstObject * parent,
   process_data.is_rtcp = is_rtcp;
   process_data.out_list = out_list;
   process_data.flowret = GST_FLOW_OK;
+  process_data.err = srtp_err_status_ok;
+
+  /* Hold the lock across the whole list so consecutive packets are
+   * protected back to back instead of paying the lock per packet */
+  GST_OBJECT_LOCK (filter);
+
+  gst_srtp_init_event_reporter ();
+
+  if (filter->session == NULL) {
+    /* The rtcp session disappeared (element shutting down) */
+    GST_OBJECT_UNLOCK (filter);
+    gst_buffer_list_unref (out_list);
+    ret = GST_FLOW_FLUSHING;
+    goto out;
+  }
 
   if (!gst_buffer_list_foreach (buf_list, process_buffer_it, &process_data)) {
+    GST_OBJECT_UNLOCK (filter);
+    gst_srtp_enc_report_protect_error (filter, process_data.err);
+    gst_buffer_list_unref (out_list);
     ret = process_data.flowret;
     goto out;
   }
 
+  GST_OBJECT_UNLOCK (filter);
+
   if (!gst_buffer_list_length (out_list)) {
     gst_buffer_list_unref (out_list);
     ret = GST_FLOW_OK;
@@ -1936,13 +1936,13 @@ gst_ttml_render_draw_text (GstTtmlRender * render, const gchar * text,
     guint line_height, guint baseline_offset)
 {
   GstTtmlRenderRenderedImage *ret;
-  cairo_surface_t *surface, *cropped_surface;
-  cairo_t *cairo_state, *cropped_state;
+  cairo_surface_t *surface;
+  cairo_t *cairo_state;
   GstMapInfo map;
   PangoRectangle logical_rect, ink_rect;
   guint buf_width, buf_height;
   gint stride;
-  gint bounding_box_x1, bounding_box_x2, bounding_box_y1, bounding_box_y2;
+  gint bounding_box_x1, bounding_box_x2;
   gint baseline;
 
   ret = gst_ttml_render_rendered_image_new_empty ();
@@ -1959,44 +1959,29 @@ gst_ttml_render_draw_text (GstTtmlRender * render, const gchar * text,
   bounding_box_x1 = MIN (logical_rect.x, ink_rect.x);
   bounding_box_x2 = MAX (logical_rect.x + logical_rect.width,
       ink_rect.x + ink_rect.width);
-  bounding_box_y1 = MIN (logical_rect.y, ink_rect.y);
-  bounding_box_y2 = MAX (logical_rect.y + logical_rect.height,
-      ink_rect.y + ink_rect.height);
-
-  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
-      (bounding_box_x2 - bounding_box_x1), (bounding_box_y2 - bounding_box_y1));
-  cairo_state = cairo_create (surface);
-  cairo_set_operator (cairo_state, CAIRO_OPERATOR_CLEAR);
-  cairo_paint (cairo_state);
-  cairo_set_operator (cairo_state, CAIRO_OPERATOR_OVER);
-
-  cairo_save (cairo_state);
-  pango_cairo_show_layout (cairo_state, render->layout);
-  cairo_restore (cairo_state);
 
   buf_width = bounding_box_x2 - bounding_box_x1;
   buf_height = ink_rect.height;
   GST_CAT_DEBUG (ttmlrender_debug, "Output buffer width: %u  height: %u",
       buf_width, buf_height);
 
+  /* Render the layout directly into the output buffer, shifted so that the
+   * ink bounding box lands at the origin; this avoids rasterizing into an
+   * intermediate surface and copying the result out */
   ret->image = gst_buffer_new_allocate (NULL, 4 * buf_width * buf_height, NULL);
   gst_buffer_memset (ret->image, 0, 0U, 4 * buf_width * buf_height);
   gst_buffer_map (ret->image, &map, GST_MAP_READWRITE);
 
   stride = cairo_format_stride_for_width (CAIRO_FORMAT_ARGB32, buf_width);
-  cropped_surface =
+  surface =
       cairo_image_surface_create_for_data (map.data, CAIRO_FORMAT_ARGB32,
-      (bounding_box_x2 - bounding_box_x1), ink_rect.height, stride);
-  cropped_state = cairo_create (cropped_surface);
-  cairo_set_source_surface (cropped_state, surface, -bounding_box_x1,
-      -ink_rect.y);
-  cairo_rectangle (cropped_state, 0, 0, buf_width, buf_height);
-  cairo_fill (cropped_state);
+      buf_width, buf_height, stride);
+  cairo_state = cairo_create (surface);
+  cairo_translate (cairo_state, -bounding_box_x1, -ink_rect.y);
+  pango_cairo_show_layout (cairo_state, render->layout);
 
   cairo_destroy (cairo_state);
   cairo_surface_destroy (surface);
-  cairo_destroy (cropped_state);
-  cairo_surface_destroy (cropped_surface);
   gst_buffer_unmap (ret->image, &map);
 
   ret->width = buf_width;
@@ -47,6 +47,9 @@ static void gst_vulkan_device_finalize (GObject * object);
 struct _GstVulkanDevicePrivate
 {
   gboolean opened;
+
+  /* created on first use, shared by all pipelines on this device */
+  VkPipelineCache pipeline_cache;
 };
 
 #define gst_vulkan_device_parent_class parent_class
@@ -96,6 +99,10 @@ gst_vulkan_device_finalize (GObject * object)
     vkDestroyCommandPool (device->device, device->cmd_pool, NULL);
   device->cmd_pool = VK_NULL_HANDLE;
 
+  if (device->priv->pipeline_cache)
+    vkDestroyPipelineCache (device->device, device->priv->pipeline_cache, NULL);
+  device->priv->pipeline_cache = VK_NULL_HANDLE;
+
   if (device->device) {
     vkDeviceWaitIdle (device->device);
     vkDestroyDevice (device->device, NULL);
@@ -437,6 +444,55 @@ gst_vulkan_device_create_cmd_buffer (GstVulkanDevice * device,
   return TRUE;
 }
 
+/**
+ * gst_vulkan_device_get_pipeline_cache:
+ * @device: a #GstVulkanDevice
+ * @cache: (out): the #VkPipelineCache for @device
+ * @error: a #GError
+ *
+ * Retrieves the device-wide pipeline cache, creating it on first use.
+ * Pipelines created against this cache can reuse each other's compiled
+ * state instead of rebuilding it from scratch.
+ *
+ * Returns: whether @cache could be retrieved
+ *
+ * Since: 1.16
+ */
+gboolean
+gst_vulkan_device_get_pipeline_cache (GstVulkanDevice * device,
+    VkPipelineCache * cache, GError ** error)
+{
+  VkResult err;
+
+  g_return_val_if_fail (GST_IS_VULKAN_DEVICE (device), FALSE);
+  g_return_val_if_fail (device->device != NULL, FALSE);
+  g_return_val_if_fail (cache != NULL, FALSE);
+
+  GST_OBJECT_LOCK (device);
+
+  if (device->priv->pipeline_cache == VK_NULL_HANDLE) {
+    VkPipelineCacheCreateInfo cache_info = { 0, };
+
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = NULL;
+
+    err = vkCreatePipelineCache (device->device, &cache_info, NULL,
+        &device->priv->pipeline_cache);
+    if (gst_vulkan_error_to_g_error (err, error, "vkCreatePipelineCache") < 0) {
+      GST_OBJECT_UNLOCK (device);
+      return FALSE;
+    }
+
+    GST_DEBUG_OBJECT (device, "created pipeline cache");
+  }
+
+  *cache = device->priv->pipeline_cache;
+
+  GST_OBJECT_UNLOCK (device);
+
+  return TRUE;
+}
+
 /**
  * gst_context_set_vulkan_device:
  * @context: a #GstContext
@@ -83,6 +83,9 @@ VkPhysicalDevice    gst_vulkan_device_get_physical_device   (GstVulkanDevice * d
 gboolean            gst_vulkan_device_create_cmd_buffer     (GstVulkanDevice * device,
                                                              VkCommandBuffer * cmd,
                                                              GError ** error);
+gboolean            gst_vulkan_device_get_pipeline_cache    (GstVulkanDevice * device,
+                                                             VkPipelineCache * cache,
+                                                             GError ** error);
 
 void                gst_context_set_vulkan_device           (GstContext * context,
                                                              GstVulkanDevice * device);
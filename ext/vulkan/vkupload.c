@@ -299,7 +299,10 @@ _raw_to_buffer_perform (gpointer impl, GstBuffer * inbuf, GstBuffer ** outbuf)
   if (!gst_video_frame_map (&v_frame, &raw->in_info, inbuf, GST_MAP_READ)) {
     GST_ELEMENT_ERROR (raw->upload, RESOURCE, NOT_FOUND,
         ("%s", "Failed to map input buffer"), NULL);
-    return GST_FLOW_ERROR;
+    gst_buffer_unref (*outbuf);
+    *outbuf = NULL;
+    ret = GST_FLOW_ERROR;
+    goto out;
   }
 
   for (i = 0; i < GST_VIDEO_INFO_N_PLANES (&raw->out_info); i++) {
@@ -521,9 +521,17 @@ gst_wayland_create_pool (GstWaylandSink * sink, GstCaps * caps)
 {
   GstBufferPool *pool = NULL;
   GstStructure *structure;
-  gsize size = sink->video_info.size;
+  GstVideoInfo info;
+  gsize size;
   GstAllocator *alloc;
 
+  /* the pool may be created for caps that differ from the negotiated ones,
+   * e.g. from an allocation query, so take the size from the caps */
+  if (gst_video_info_from_caps (&info, caps))
+    size = info.size;
+  else
+    size = sink->video_info.size;
+
   pool = g_object_new (gst_wayland_pool_get_type (), NULL);
 
   structure = gst_buffer_pool_get_config (pool);
@@ -600,13 +608,21 @@ gst_wayland_sink_propose_allocation (GstBaseSink * bsink, GstQuery * query)
   GstBufferPool *pool = NULL;
   gboolean need_pool;
   GstAllocator *alloc;
+  GstVideoInfo vinfo;
 
   gst_query_parse_allocation (query, &caps, &need_pool);
+  if (!caps)
+    return FALSE;
+
+  /* size the proposed pool for the caps in the query, not for whatever we
+   * last negotiated; upstream may be probing a different format */
+  if (!gst_video_info_from_caps (&vinfo, caps))
+    return FALSE;
 
   if (need_pool)
     pool = gst_wayland_create_pool (sink, caps);
 
-  gst_query_add_allocation_pool (query, pool, sink->video_info.size, 2, 0);
+  gst_query_add_allocation_pool (query, pool, vinfo.size, 2, 0);
   if (pool)
     g_object_unref (pool);
 
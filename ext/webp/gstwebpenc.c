@@ -289,17 +289,15 @@ gst_webp_enc_handle_frame (GstVideoEncoder * encoder,
   if (WebPEncode (&enc->webp_config, &enc->webp_picture)) {
     WebPPictureFree (&enc->webp_picture);
 
-    out_buffer = gst_buffer_new_allocate (NULL, enc->webp_writer.size, NULL);
-    if (!out_buffer) {
-      GST_ERROR_OBJECT (enc, "Failed to create output buffer");
-      gst_video_frame_unmap (&vframe);
-      return GST_FLOW_ERROR;
-    }
-    gst_buffer_fill (out_buffer, 0, enc->webp_writer.mem,
-        enc->webp_writer.size);
-    free (enc->webp_writer.mem);
+    /* wrap the writer's memory instead of copying it; the buffer takes
+     * ownership and releases it with free() */
+    out_buffer = gst_buffer_new_wrapped_full (0, enc->webp_writer.mem,
+        enc->webp_writer.size, 0, enc->webp_writer.size, enc->webp_writer.mem,
+        (GDestroyNotify) free);
   } else {
     GST_ERROR_OBJECT (enc, "Failed to encode WebPPicture");
+    WebPPictureFree (&enc->webp_picture);
+    free (enc->webp_writer.mem);
     gst_video_frame_unmap (&vframe);
     return GST_FLOW_ERROR;
   }
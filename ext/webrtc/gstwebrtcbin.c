@@ -636,37 +636,14 @@ match_for_pad (GstWebRTCBinPad * pad, GstWebRTCBinPad * other)
 }
 #endif
 
-static gboolean
-_unlock_pc_thread (GMutex * lock)
-{
-  g_mutex_unlock (lock);
-  return G_SOURCE_REMOVE;
-}
-
 static gpointer
 _gst_pc_thread (GstWebRTCBin * webrtc)
 {
-  PC_LOCK (webrtc);
-  webrtc->priv->main_context = g_main_context_new ();
-  webrtc->priv->loop = g_main_loop_new (webrtc->priv->main_context, FALSE);
-
-  PC_COND_BROADCAST (webrtc);
-  g_main_context_invoke (webrtc->priv->main_context,
-      (GSourceFunc) _unlock_pc_thread, PC_GET_LOCK (webrtc));
-
   /* Having the thread be the thread default GMainContext will break the
    * required queue-like ordering (from W3's peerconnection spec) of re-entrant
    * tasks */
   g_main_loop_run (webrtc->priv->loop);
 
-  PC_LOCK (webrtc);
-  g_main_context_unref (webrtc->priv->main_context);
-  webrtc->priv->main_context = NULL;
-  g_main_loop_unref (webrtc->priv->loop);
-  webrtc->priv->loop = NULL;
-  PC_COND_BROADCAST (webrtc);
-  PC_UNLOCK (webrtc);
-
   return NULL;
 }
 
@@ -674,26 +651,52 @@ static void
 _start_thread (GstWebRTCBin * webrtc)
 {
   PC_LOCK (webrtc);
+  /* Create the context and loop before spawning the thread so that tasks can
+   * be queued right away; the state change thread doesn't have to wait for
+   * the pc thread to have spun up */
+  webrtc->priv->main_context = g_main_context_new ();
+  webrtc->priv->loop = g_main_loop_new (webrtc->priv->main_context, FALSE);
   webrtc->priv->thread = g_thread_new ("gst-pc-ops",
       (GThreadFunc) _gst_pc_thread, webrtc);
-
-  while (!webrtc->priv->loop)
-    PC_COND_WAIT (webrtc);
   webrtc->priv->is_closed = FALSE;
   PC_UNLOCK (webrtc);
 }
 
+static gboolean
+_quit_loop_cb (GMainLoop * loop)
+{
+  g_main_loop_quit (loop);
+
+  return G_SOURCE_REMOVE;
+}
+
 static void
 _stop_thread (GstWebRTCBin * webrtc)
 {
+  GSource *source;
+
   PC_LOCK (webrtc);
   webrtc->priv->is_closed = TRUE;
-  g_main_loop_quit (webrtc->priv->loop);
-  while (webrtc->priv->loop)
-    PC_COND_WAIT (webrtc);
   PC_UNLOCK (webrtc);
 
-  g_thread_unref (webrtc->priv->thread);
+  /* Quit from a source dispatched by the loop itself, a direct
+   * g_main_loop_quit() racing with the thread entering g_main_loop_run()
+   * would be lost */
+  source = g_idle_source_new ();
+  g_source_set_callback (source, (GSourceFunc) _quit_loop_cb,
+      webrtc->priv->loop, NULL);
+  g_source_attach (source, webrtc->priv->main_context);
+  g_source_unref (source);
+
+  g_thread_join (webrtc->priv->thread);
+  webrtc->priv->thread = NULL;
+
+  PC_LOCK (webrtc);
+  g_main_loop_unref (webrtc->priv->loop);
+  webrtc->priv->loop = NULL;
+  g_main_context_unref (webrtc->priv->main_context);
+  webrtc->priv->main_context = NULL;
+  PC_UNLOCK (webrtc);
 }
 
 static gboolean
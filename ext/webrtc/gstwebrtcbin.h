@@ -133,6 +133,8 @@ struct _GstWebRTCBinPrivate
   guint media_counter;
 
   GstStructure *stats;
+  /* monotonic time the cached stats were last rebuilt */
+  gint64 stats_updated_time;
 };
 
 typedef void (*GstWebRTCBinFunc) (GstWebRTCBin * webrtc, gpointer data);
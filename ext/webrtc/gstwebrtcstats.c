@@ -514,19 +514,31 @@ _get_stats_from_pad (GstWebRTCBin * webrtc, GstPad * pad, GstStructure * s)
   return TRUE;
 }
 
+/* How long a built stats snapshot stays valid. Applications typically
+ * request stats for every pad in one go; serving those requests from one
+ * snapshot avoids walking all transports once per pad */
+#define STATS_CACHE_MAX_AGE_US (100 * G_TIME_SPAN_MILLISECOND)
+
 void
 gst_webrtc_bin_update_stats (GstWebRTCBin * webrtc)
 {
-  GstStructure *s = gst_structure_new_empty ("application/x-webrtc-stats");
+  GstStructure *s;
   double ts = monotonic_time_as_double_milliseconds ();
   GstStructure *pc_stats;
 
   _init_debug ();
 
+  if (webrtc->priv->stats && g_get_monotonic_time () -
+      webrtc->priv->stats_updated_time < STATS_CACHE_MAX_AGE_US) {
+    GST_DEBUG_OBJECT (webrtc, "reusing stats cached at time %f", ts);
+    return;
+  }
+
+  s = gst_structure_new_empty ("application/x-webrtc-stats");
+
   gst_structure_set (s, "timestamp", G_TYPE_DOUBLE, ts, NULL);
 
   /* FIXME: better unique IDs */
-  /* FIXME: rate limitting stat updates? */
   /* FIXME: all stats need to be kept forever */
 
   GST_DEBUG_OBJECT (webrtc, "updating stats at time %f", ts);
@@ -546,4 +558,5 @@ gst_webrtc_bin_update_stats (GstWebRTCBin * webrtc)
   if (webrtc->priv->stats)
     gst_structure_free (webrtc->priv->stats);
   webrtc->priv->stats = s;
+  webrtc->priv->stats_updated_time = g_get_monotonic_time ();
 }
@@ -175,12 +175,15 @@ gst_webrtc_echo_probe_transform_ip (GstBaseTransform * btrans,
   GstWebrtcEchoProbe *self = GST_WEBRTC_ECHO_PROBE (btrans);
   GstBuffer *newbuf = NULL;
 
-  GST_WEBRTC_ECHO_PROBE_LOCK (self);
+  /* Prepare the copy outside of the probe lock, the DSP may be blocking on
+   * it from another thread to read back our data. */
   newbuf = gst_buffer_copy (buffer);
   /* Moves the buffer timestamp to be in Running time */
   GST_BUFFER_PTS (newbuf) = gst_segment_to_running_time (&btrans->segment,
       GST_FORMAT_TIME, GST_BUFFER_PTS (buffer));
 
+  GST_WEBRTC_ECHO_PROBE_LOCK (self);
+
   if (self->interleaved) {
     gst_adapter_push (self->adapter, newbuf);
 
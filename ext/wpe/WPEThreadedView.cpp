@@ -76,9 +76,15 @@ WPEThreadedView::~WPEThreadedView()
         }
     }
 
+    // Make sure the view thread has processed the asynchronous
+    // frame-complete and release-image dispatches queued above before the
+    // exportable they reference goes away.
+    flushDispatches();
+
     {
         GMutexHolder lock(threading.mutex);
         wpe_view_backend_exportable_fdo_destroy(wpe.exportable);
+        wpe.exportable = nullptr;
     }
 
     if (gst.display) {
@@ -302,6 +308,9 @@ void WPEThreadedView::frameComplete()
 {
     GST_DEBUG("frame complete");
 
+    // Dispatched asynchronously: the streaming thread doesn't need the
+    // result and waiting here would serialize it against the view thread
+    // on every frame.
     GSource* source = g_idle_source_new();
     g_source_set_callback(source,
         [](gpointer data) -> gboolean {
@@ -309,8 +318,24 @@ void WPEThreadedView::frameComplete()
             GMutexHolder lock(view.threading.mutex);
 
             GST_DEBUG("dispatching");
-            wpe_view_backend_exportable_fdo_dispatch_frame_complete(view.wpe.exportable);
+            if (view.wpe.exportable)
+                wpe_view_backend_exportable_fdo_dispatch_frame_complete(view.wpe.exportable);
+
+            return G_SOURCE_REMOVE;
+        },
+        this, nullptr);
+    g_source_set_priority(source, WPE_GLIB_SOURCE_PRIORITY);
+    g_source_attach(source, glib.context);
+    g_source_unref(source);
+}
 
+void WPEThreadedView::flushDispatches()
+{
+    GSource* source = g_idle_source_new();
+    g_source_set_callback(source,
+        [](gpointer data) -> gboolean {
+            auto& view = *static_cast<WPEThreadedView*>(data);
+            GMutexHolder lock(view.threading.mutex);
             g_cond_signal(&view.threading.cond);
             return G_SOURCE_REMOVE;
         },
@@ -384,8 +409,12 @@ void WPEThreadedView::releaseImage(EGLImageKHR image)
     struct ReleaseImageContext {
         WPEThreadedView& view;
         EGLImageKHR image;
-    } releaseImageContext{ *this, image };
+    };
+    auto* releaseImageContext = new ReleaseImageContext{ *this, image };
 
+    // Dispatched asynchronously, this is called from the last unref of a
+    // GstEGLImage, possibly on the streaming thread right in the middle of
+    // producing a buffer.
     GSource* source = g_idle_source_new();
     g_source_set_callback(source,
         [](gpointer data) -> gboolean {
@@ -393,21 +422,18 @@ void WPEThreadedView::releaseImage(EGLImageKHR image)
             auto& view = releaseImageContext.view;
             GMutexHolder lock(view.threading.mutex);
 
-            wpe_view_backend_exportable_fdo_egl_dispatch_release_image(
-                releaseImageContext.view.wpe.exportable, releaseImageContext.image);
+            if (view.wpe.exportable)
+                wpe_view_backend_exportable_fdo_egl_dispatch_release_image(
+                    view.wpe.exportable, releaseImageContext.image);
 
-            g_cond_signal(&view.threading.cond);
             return G_SOURCE_REMOVE;
         },
-        &releaseImageContext, nullptr);
+        releaseImageContext,
+        [](gpointer data) {
+            delete static_cast<ReleaseImageContext*>(data);
+        });
     g_source_set_priority(source, WPE_GLIB_SOURCE_PRIORITY);
-
-    {
-        GMutexHolder lock(threading.mutex);
-        g_source_attach(source, glib.context);
-        g_cond_wait(&threading.cond, &threading.mutex);
-    }
-
+    g_source_attach(source, glib.context);
     g_source_unref(source);
 }
 
@@ -49,6 +49,7 @@ public:
 
 private:
     void frameComplete();
+    void flushDispatches();
     void releaseImage(EGLImageKHR);
     void loadUriUnlocked(const gchar*);
 
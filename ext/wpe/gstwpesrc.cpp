@@ -106,6 +106,10 @@ struct _GstWpeSrc
   gboolean draw_background;
   gboolean negotiated;
   WPEThreadedView *view;
+  /* Last buffer produced and the EGLImage it wraps, to reuse when the web
+   * view hasn't rendered a new frame since */
+  GstBuffer *last_buffer;
+  GstEGLImage *last_image;
 };
 
 static void gst_wpe_src_uri_handler_init (gpointer iface, gpointer data);
@@ -140,15 +144,27 @@ gst_wpe_src_create (GstPushSrc * psrc, GstBuffer ** buffer)
 
   g_return_val_if_fail(img != NULL, GST_FLOW_ERROR);
 
-  *buffer = gst_buffer_new ();
-  imgs[0] = (gpointer) img;
-  alloc_params->parent.gl_handle = img;
-  alloc_params->plane = 0;
-  gst_gl_memory_setup_buffer (src->allocator, *buffer, alloc_params, formats, imgs, 1);
-
-  sync_meta = gst_buffer_get_gl_sync_meta (*buffer);
-  if (sync_meta)
-    gst_gl_sync_meta_set_sync_point (sync_meta, src->context);
+  if (img == src->last_image && src->last_buffer) {
+    /* The web view didn't export a new frame, hand out the previous GL
+     * memory again instead of wrapping the same EGLImage once more */
+    *buffer = gst_buffer_copy (src->last_buffer);
+  } else {
+    *buffer = gst_buffer_new ();
+    imgs[0] = (gpointer) img;
+    alloc_params->parent.gl_handle = img;
+    alloc_params->plane = 0;
+    gst_gl_memory_setup_buffer (src->allocator, *buffer, alloc_params, formats,
+        imgs, 1);
+
+    sync_meta = gst_buffer_get_gl_sync_meta (*buffer);
+    if (sync_meta)
+      gst_gl_sync_meta_set_sync_point (sync_meta, src->context);
+
+    gst_buffer_replace (&src->last_buffer, *buffer);
+    if (src->last_image)
+      gst_egl_image_unref (src->last_image);
+    src->last_image = gst_egl_image_ref (img);
+  }
 
   GST_BUFFER_OFFSET (*buffer) = src->n_frames;
   src->n_frames++;
@@ -176,6 +192,8 @@ gst_wpe_src_start (GstBaseSrc * base_src)
   src->negotiated = FALSE;
   src->allocator = GST_GL_MEMORY_ALLOCATOR (gst_allocator_find (GST_GL_MEMORY_EGL_ALLOCATOR_NAME));
   src->gl_alloc_params = NULL;
+  src->last_buffer = NULL;
+  src->last_image = NULL;
   src->view = new WPEThreadedView;
 
   GST_OBJECT_UNLOCK (src);
@@ -201,6 +219,14 @@ gst_wpe_src_stop (GstBaseSrc * base_src)
   if (src->context)
     g_clear_object (&src->context);
 
+  /* Drop the cached buffer before the view goes away, releasing the
+   * wrapped EGLImage needs the view thread */
+  gst_buffer_replace (&src->last_buffer, NULL);
+  if (src->last_image) {
+    gst_egl_image_unref (src->last_image);
+    src->last_image = NULL;
+  }
+
   delete src->view;
   src->view = NULL;
 
@@ -54,7 +54,9 @@ enum
   PROP_X265_LOG_LEVEL,
   PROP_SPEED_PRESET,
   PROP_TUNE,
-  PROP_KEY_INT_MAX
+  PROP_KEY_INT_MAX,
+  PROP_FRAME_THREADS,
+  PROP_NUMA_POOLS
 };
 
 #define PROP_BITRATE_DEFAULT            (2 * 1024)
@@ -64,6 +66,8 @@ enum
 #define PROP_SPEED_PRESET_DEFAULT        6      /* Medium */
 #define PROP_TUNE_DEFAULT                2      /* SSIM   */
 #define PROP_KEY_INT_MAX_DEFAULT         0      /* x265 lib default */
+#define PROP_FRAME_THREADS_DEFAULT       0      /* x265 lib default */
+#define PROP_NUMA_POOLS_DEFAULT          NULL   /* x265 lib default */
 
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
 #define FORMATS "I420, Y444, I420_10LE, Y444_10LE"
@@ -410,6 +414,35 @@ gst_x265_enc_class_init (GstX265EncClass * klass)
           "Maximal distance between two key-frames (0 = x265 default / 250)",
           0, G_MAXINT32, PROP_KEY_INT_MAX_DEFAULT, G_PARAM_READWRITE));
 
+  /**
+   * GstX265Enc::frame-threads:
+   *
+   * Number of concurrently encoded frames (0 = x265 default, based on the
+   * detected CPU core count)
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_FRAME_THREADS,
+      g_param_spec_int ("frame-threads", "Frame threads",
+          "Number of concurrently encoded frames (0 = automatic)",
+          0, 16, PROP_FRAME_THREADS_DEFAULT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstX265Enc::numa-pools:
+   *
+   * Comma separated list of threads per NUMA node, as understood by the
+   * x265 "pools" parameter, e.g. "8,8" or "16,-" (NULL = x265 default,
+   * one pool spanning all detected cores)
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_NUMA_POOLS,
+      g_param_spec_string ("numa-pools", "NUMA pools",
+          "Comma separated list of worker threads per NUMA node "
+          "(NULL = automatic)", PROP_NUMA_POOLS_DEFAULT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "x265enc", "Codec/Encoder/Video", "H265 Encoder",
       "Thijs Vermeir <thijs.vermeir@barco.com>");
@@ -437,6 +470,8 @@ gst_x265_enc_init (GstX265Enc * encoder)
   encoder->speed_preset = PROP_SPEED_PRESET_DEFAULT;
   encoder->tune = PROP_TUNE_DEFAULT;
   encoder->keyintmax = PROP_KEY_INT_MAX_DEFAULT;
+  encoder->frame_threads = PROP_FRAME_THREADS_DEFAULT;
+  encoder->numa_pools = g_strdup (PROP_NUMA_POOLS_DEFAULT);
 }
 
 typedef struct
@@ -553,6 +588,7 @@ gst_x265_enc_finalize (GObject * object)
   gst_x265_enc_close_encoder (encoder);
 
   g_string_free (encoder->option_string_prop, TRUE);
+  g_free (encoder->numa_pools);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -690,6 +726,21 @@ gst_x265_enc_init_encoder (GstX265Enc * encoder)
     encoder->x265param.keyframeMax = encoder->keyintmax;
   }
 
+  if (encoder->frame_threads > 0) {
+    encoder->x265param.frameNumThreads = encoder->frame_threads;
+  }
+
+  /* let x265 parse the pool description, it owns a copy of the string */
+  if (encoder->numa_pools != NULL) {
+    if (x265_param_parse (&encoder->x265param, "pools",
+            encoder->numa_pools) != 0) {
+      GST_ERROR_OBJECT (encoder, "Bad value for numa-pools: %s",
+          encoder->numa_pools);
+      GST_OBJECT_UNLOCK (encoder);
+      return FALSE;
+    }
+  }
+
   /* apply option-string property */
   if (encoder->option_string_prop && encoder->option_string_prop->len) {
     GST_DEBUG_OBJECT (encoder, "Applying option-string: %s",
@@ -1221,6 +1272,13 @@ gst_x265_enc_set_property (GObject * object, guint prop_id,
     case PROP_KEY_INT_MAX:
       encoder->keyintmax = g_value_get_int (value);
       break;
+    case PROP_FRAME_THREADS:
+      encoder->frame_threads = g_value_get_int (value);
+      break;
+    case PROP_NUMA_POOLS:
+      g_free (encoder->numa_pools);
+      encoder->numa_pools = g_value_dup_string (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1268,6 +1326,12 @@ gst_x265_enc_get_property (GObject * object, guint prop_id,
     case PROP_KEY_INT_MAX:
       g_value_set_int (value, encoder->keyintmax);
       break;
+    case PROP_FRAME_THREADS:
+      g_value_set_int (value, encoder->frame_threads);
+      break;
+    case PROP_NUMA_POOLS:
+      g_value_set_string (value, encoder->numa_pools);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -62,6 +62,8 @@ struct _GstX265Enc
   gint tune;
   gint speed_preset;
   gint keyintmax;
+  gint frame_threads;
+  gchar *numa_pools;
   GString *option_string_prop;  /* option-string property */
   /*GString *option_string; *//* used by set prop */
 
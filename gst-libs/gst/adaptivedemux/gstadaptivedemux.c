@@ -131,7 +131,9 @@ GST_DEBUG_CATEGORY (adaptivedemux_debug);
 #define DEFAULT_CONNECTION_SPEED 0
 #define DEFAULT_BITRATE_LIMIT 0.8f
 #define SRC_QUEUE_MAX_BYTES 20 * 1024 * 1024    /* For safety. Large enough to hold a segment. */
-#define NUM_LOOKBACK_FRAGMENTS 3
+#define DEFAULT_MAX_PREFETCH_BYTES SRC_QUEUE_MAX_BYTES
+#define DEFAULT_LOW_LATENCY FALSE
+#define NUM_LOOKBACK_FRAGMENTS 8
 
 #define GST_MANIFEST_GET_LOCK(d) (&(GST_ADAPTIVE_DEMUX_CAST(d)->priv->manifest_lock))
 #define GST_MANIFEST_LOCK(d) G_STMT_START { \
@@ -158,6 +160,8 @@ enum
   PROP_0,
   PROP_CONNECTION_SPEED,
   PROP_BITRATE_LIMIT,
+  PROP_MAX_PREFETCH_BYTES,
+  PROP_LOW_LATENCY,
   PROP_LAST
 };
 
@@ -362,6 +366,14 @@ gst_adaptive_demux_set_property (GObject * object, guint prop_id,
     case PROP_BITRATE_LIMIT:
       demux->bitrate_limit = g_value_get_float (value);
       break;
+    case PROP_MAX_PREFETCH_BYTES:
+      demux->max_prefetch_bytes = g_value_get_uint (value);
+      GST_DEBUG_OBJECT (demux, "Max prefetch bytes set to %u",
+          demux->max_prefetch_bytes);
+      break;
+    case PROP_LOW_LATENCY:
+      demux->low_latency = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -386,6 +398,12 @@ gst_adaptive_demux_get_property (GObject * object, guint prop_id,
     case PROP_BITRATE_LIMIT:
       g_value_set_float (value, demux->bitrate_limit);
       break;
+    case PROP_MAX_PREFETCH_BYTES:
+      g_value_set_uint (value, demux->max_prefetch_bytes);
+      break;
+    case PROP_LOW_LATENCY:
+      g_value_set_boolean (value, demux->low_latency);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -431,6 +449,40 @@ gst_adaptive_demux_class_init (GstAdaptiveDemuxClass * klass)
           0, 1, DEFAULT_BITRATE_LIMIT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAdaptiveDemux:max-prefetch-bytes:
+   *
+   * Maximum number of bytes a stream may download ahead of consumption
+   * (the byte budget of the per-stream download queue). Larger values
+   * keep the connection busy on high-latency links, at the cost of
+   * memory. 0 means unlimited.
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_PREFETCH_BYTES,
+      g_param_spec_uint ("max-prefetch-bytes", "Max prefetch bytes",
+          "Maximum number of bytes to download ahead of consumption per "
+          "stream (0 = unlimited)", 0, G_MAXUINT, DEFAULT_MAX_PREFETCH_BYTES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAdaptiveDemux:low-latency:
+   *
+   * Request live fragments as soon as they start being produced instead
+   * of waiting for them to be fully available. Downloaded chunks are
+   * forwarded downstream as they arrive, so with a server that delivers
+   * in-progress segments with chunked transfer encoding this cuts up to
+   * one segment duration of latency. Servers that only serve complete
+   * segments will return 404 for the early request and the existing
+   * retry handling applies.
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_LOW_LATENCY,
+      g_param_spec_boolean ("low-latency", "Low latency",
+          "Request live fragments before they are fully available",
+          DEFAULT_LOW_LATENCY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state = gst_adaptive_demux_change_state;
 
   gstbin_class->handle_message = gst_adaptive_demux_handle_message;
@@ -523,6 +575,8 @@ gst_adaptive_demux_init (GstAdaptiveDemux * demux,
   /* Properties */
   demux->bitrate_limit = DEFAULT_BITRATE_LIMIT;
   demux->connection_speed = DEFAULT_CONNECTION_SPEED;
+  demux->max_prefetch_bytes = DEFAULT_MAX_PREFETCH_BYTES;
+  demux->low_latency = DEFAULT_LOW_LATENCY;
 
   gst_element_add_pad (GST_ELEMENT (demux), demux->sinkpad);
 }
@@ -2007,7 +2061,18 @@ gst_adaptive_demux_src_query (GstPad * pad, GstObject * parent,
   return ret;
 }
 
-/* must be called with manifest_lock taken */
+/* must be called with manifest_lock taken
+ *
+ * Note on threading: every stream gets its own download task, so a process
+ * with many demux instances runs one (mostly idle) thread per stream. A
+ * shared worker pool servicing all instances has been considered and does
+ * not fit the current design: the download task doubles as the streaming
+ * thread for the stream's pad, and pad pushes may block downstream (e.g. in
+ * a full queue or a paused sink) for an unbounded time, so multiplexing
+ * several streams onto one worker would let any blocked session stall
+ * unrelated ones. Sharing the fetch work would first require decoupling
+ * downloading from pushing.
+ */
 static void
 gst_adaptive_demux_start_tasks (GstAdaptiveDemux * demux,
     gboolean start_preroll_streams)
@@ -2215,6 +2280,8 @@ _update_average_bitrate (GstAdaptiveDemux * demux,
     GstAdaptiveDemuxStream * stream, guint64 new_bitrate)
 {
   gint index = stream->moving_index % NUM_LOOKBACK_FRAGMENTS;
+  gdouble denom = 0.0;
+  guint i, samples, n;
 
   stream->moving_bitrate -= stream->fragment_bitrates[index];
   stream->fragment_bitrates[index] = new_bitrate;
@@ -2222,9 +2289,24 @@ _update_average_bitrate (GstAdaptiveDemux * demux,
 
   stream->moving_index += 1;
 
-  if (stream->moving_index > NUM_LOOKBACK_FRAGMENTS)
-    return stream->moving_bitrate / NUM_LOOKBACK_FRAGMENTS;
-  return stream->moving_bitrate / stream->moving_index;
+  samples = MIN (stream->moving_index, NUM_LOOKBACK_FRAGMENTS);
+
+  /* Harmonic mean over the window. Unlike the arithmetic mean it is
+   * dominated by the slow samples, which is the right bias when judging
+   * whether a representation is sustainable on a bursty link: a single
+   * fast fragment must not mask a string of slow ones. */
+  n = 0;
+  for (i = 0; i < samples; i++) {
+    if (stream->fragment_bitrates[i] > 0) {
+      denom += 1.0 / (gdouble) stream->fragment_bitrates[i];
+      n++;
+    }
+  }
+
+  if (n == 0)
+    return 0;
+
+  return (guint64) ((gdouble) n / denom);
 }
 
 /* must be called with manifest_lock taken */
@@ -2276,6 +2358,28 @@ gst_adaptive_demux_stream_update_current_bitrate (GstAdaptiveDemux * demux,
   return stream->current_download_rate;
 }
 
+/**
+ * gst_adaptive_demux_stream_get_download_rate:
+ * @stream: a #GstAdaptiveDemuxStream
+ *
+ * Gets the estimated sustainable download rate for @stream: a
+ * sliding-window harmonic mean over the last fragment downloads, capped
+ * by the last fragment's rate and scaled by the bitrate-limit property.
+ * Subclasses can use this from their stream_select_bitrate()
+ * implementation to build throughput/buffer hybrid adaptation schemes.
+ *
+ * Returns: the estimated download rate in bits per second
+ *
+ * Since: 1.16
+ */
+guint64
+gst_adaptive_demux_stream_get_download_rate (GstAdaptiveDemuxStream * stream)
+{
+  g_return_val_if_fail (stream != NULL, 0);
+
+  return stream->current_download_rate;
+}
+
 /* must be called with manifest_lock taken */
 static GstFlowReturn
 gst_adaptive_demux_combine_flows (GstAdaptiveDemux * demux)
@@ -2950,6 +3054,10 @@ gst_adaptive_demux_stream_update_source (GstAdaptiveDemuxStream * stream,
         gst_element_set_state (src, GST_STATE_NULL);
         gst_bin_remove (GST_BIN_CAST (demux), src);
         GST_MANIFEST_LOCK (demux);
+      } else {
+        /* pick up a possibly updated prefetch byte budget */
+        g_object_set (stream->queue, "max-size-bytes",
+            (guint) demux->max_prefetch_bytes, NULL);
       }
     }
     g_free (old_uri);
@@ -2969,14 +3077,17 @@ gst_adaptive_demux_stream_update_source (GstAdaptiveDemuxStream * stream,
 
     /* Our src consists of a bin containing uri_handler -> queue . The
      * purpose of the queue is to allow the uri_handler to download an
-     * entire fragment without blocking, so we can accurately measure the
-     * download bitrate. */
+     * entire fragment (or as much of it as the configured prefetch byte
+     * budget allows) without blocking on downstream consumption, so the
+     * connection stays busy and we can accurately measure the download
+     * bitrate. */
 
     queue = gst_element_factory_make ("queue", NULL);
     if (queue == NULL)
       return FALSE;
 
-    g_object_set (queue, "max-size-bytes", (guint) SRC_QUEUE_MAX_BYTES, NULL);
+    g_object_set (queue, "max-size-bytes", (guint) demux->max_prefetch_bytes,
+        NULL);
     g_object_set (queue, "max-size-buffers", (guint) 0, NULL);
     g_object_set (queue, "max-size-time", (guint64) 0, NULL);
 
@@ -3722,6 +3833,16 @@ gst_adaptive_demux_stream_download_loop (GstAdaptiveDemuxStream * stream)
     if (live) {
       gint64 wait_time =
           gst_adaptive_demux_stream_get_fragment_waiting_time (demux, stream);
+
+      /* In low-latency mode, request the fragment right away and let the
+       * server stream it to us while it is being produced */
+      if (wait_time > 0 && demux->low_latency) {
+        GST_DEBUG_OBJECT (stream->pad,
+            "Low latency: requesting fragment %" GST_TIME_FORMAT
+            " before availability", GST_TIME_ARGS (wait_time));
+        wait_time = 0;
+      }
+
       if (wait_time > 0) {
         GstClockTime end_time =
             gst_adaptive_demux_get_monotonic_time (demux) + wait_time;
@@ -4164,6 +4285,7 @@ gst_adaptive_demux_stream_advance_fragment_unlocked (GstAdaptiveDemux * demux,
     GstAdaptiveDemuxStream * stream, GstClockTime duration)
 {
   GstAdaptiveDemuxClass *klass = GST_ADAPTIVE_DEMUX_GET_CLASS (demux);
+  GstClockTime buffer_depth = GST_CLOCK_TIME_NONE;
   GstFlowReturn ret;
 
   g_return_val_if_fail (klass->stream_advance_fragment != NULL, GST_FLOW_ERROR);
@@ -4175,6 +4297,22 @@ gst_adaptive_demux_stream_advance_fragment_unlocked (GstAdaptiveDemux * demux,
   stream->download_error_count = 0;
   g_clear_error (&stream->last_error);
 
+  /* How far the downloaded position is ahead of the rendering position
+   * last reported through downstream QoS events. Applications get this as
+   * per-stream buffer telemetry without having to query the pipeline. */
+  if (GST_CLOCK_TIME_IS_VALID (stream->qos_earliest_time)) {
+    GstClockTime position_rt;
+
+    GST_ADAPTIVE_DEMUX_SEGMENT_LOCK (demux);
+    position_rt = gst_segment_to_running_time (&stream->segment,
+        GST_FORMAT_TIME, stream->segment.position);
+    GST_ADAPTIVE_DEMUX_SEGMENT_UNLOCK (demux);
+
+    if (GST_CLOCK_TIME_IS_VALID (position_rt)
+        && position_rt > stream->qos_earliest_time)
+      buffer_depth = position_rt - stream->qos_earliest_time;
+  }
+
   /* FIXME - url has no indication of byte ranges for subsegments */
   /* FIXME : All those time statistics are biased, since they are calculated
    * *AFTER* the queue2, which might be blocking. They should ideally be
@@ -4189,7 +4327,10 @@ gst_adaptive_demux_stream_advance_fragment_unlocked (GstAdaptiveDemux * demux,
               "fragment-stop-time", GST_TYPE_CLOCK_TIME,
               gst_util_get_timestamp (), "fragment-size", G_TYPE_UINT64,
               stream->download_total_bytes, "fragment-download-time",
-              GST_TYPE_CLOCK_TIME, stream->last_download_time, NULL)));
+              GST_TYPE_CLOCK_TIME, stream->last_download_time,
+              "fragment-stream-time", GST_TYPE_CLOCK_TIME,
+              stream->fragment.timestamp, "buffer-depth", GST_TYPE_CLOCK_TIME,
+              buffer_depth, NULL)));
 
   /* Don't update to the end of the segment if in reverse playback */
   GST_ADAPTIVE_DEMUX_SEGMENT_LOCK (demux);
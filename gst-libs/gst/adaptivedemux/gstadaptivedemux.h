@@ -228,6 +228,9 @@ struct _GstAdaptiveDemux
   /* Properties */
   gfloat bitrate_limit;         /* limit of the available bitrate to use */
   guint connection_speed;
+  guint max_prefetch_bytes;     /* download-ahead byte budget per stream */
+  gboolean low_latency;         /* request live fragments before they are
+                                 * fully available */
 
   gboolean have_group_id;
   guint group_id;
@@ -523,6 +526,9 @@ GST_ADAPTIVE_DEMUX_API
 void gst_adaptive_demux_stream_queue_event (GstAdaptiveDemuxStream * stream,
     GstEvent * event);
 
+GST_ADAPTIVE_DEMUX_API
+guint64 gst_adaptive_demux_stream_get_download_rate (GstAdaptiveDemuxStream * stream);
+
 GST_ADAPTIVE_DEMUX_API
 GstClockTime gst_adaptive_demux_get_monotonic_time (GstAdaptiveDemux * demux);
 
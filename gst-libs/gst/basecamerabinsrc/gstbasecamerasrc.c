@@ -190,6 +190,14 @@ gst_base_camera_src_start_capture (GstBaseCameraSrc * src)
 
   g_mutex_lock (&src->capturing_mutex);
   if (src->capturing) {
+    /* subclasses that can pipeline captures queue this one behind the
+     * ongoing one instead of refusing it */
+    if (klass->queue_capture && klass->queue_capture (src)) {
+      GST_DEBUG_OBJECT (src, "Capture queued behind the ongoing one");
+      g_mutex_unlock (&src->capturing_mutex);
+      return;
+    }
+
     GST_WARNING_OBJECT (src, "Capturing already ongoing");
     g_mutex_unlock (&src->capturing_mutex);
 
@@ -126,7 +126,12 @@ struct _GstBaseCameraSrcClass
   /* Called by the handler for 'stop-capture'. Mandatory. */
   void (*stop_capture) (GstBaseCameraSrc * src);
 
-  gpointer _gst_reserved[GST_PADDING_LARGE];
+  /* Called by the handler for 'start-capture' when a capture is already
+   * ongoing. Return TRUE to queue the new capture behind the ongoing one
+   * instead of refusing it with a RESOURCE/BUSY warning. Optional. */
+  gboolean (*queue_capture) (GstBaseCameraSrc * src);
+
+  gpointer _gst_reserved[GST_PADDING_LARGE - 1];
 };
 
 
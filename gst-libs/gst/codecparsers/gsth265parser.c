@@ -2215,8 +2215,10 @@ gst_h265_parser_parse_slice_hdr (GstH265Parser * parser,
     READ_UE_MAX (&nr, slice->num_entry_point_offsets, offset_max);
     if (slice->num_entry_point_offsets > 0) {
       READ_UE_MAX (&nr, slice->offset_len_minus1, 31);
+      /* no g_new0: every entry is written right below, and this runs for
+       * each slice of tiled/WPP streams */
       slice->entry_point_offset_minus1 =
-          g_new0 (guint32, slice->num_entry_point_offsets);
+          g_new (guint32, slice->num_entry_point_offsets);
       for (i = 0; i < slice->num_entry_point_offsets; i++)
         READ_UINT32 (&nr, slice->entry_point_offset_minus1[i],
             (slice->offset_len_minus1 + 1));
@@ -2373,8 +2375,6 @@ gboolean
 gst_h265_slice_hdr_copy (GstH265SliceHdr * dst_slice,
     const GstH265SliceHdr * src_slice)
 {
-  guint i;
-
   g_return_val_if_fail (dst_slice != NULL, FALSE);
   g_return_val_if_fail (src_slice != NULL, FALSE);
 
@@ -2384,10 +2384,10 @@ gst_h265_slice_hdr_copy (GstH265SliceHdr * dst_slice,
 
   if (dst_slice->num_entry_point_offsets > 0) {
     dst_slice->entry_point_offset_minus1 =
-        g_new0 (guint32, dst_slice->num_entry_point_offsets);
-    for (i = 0; i < dst_slice->num_entry_point_offsets; i++)
-      dst_slice->entry_point_offset_minus1[i] =
-          src_slice->entry_point_offset_minus1[i];
+        g_new (guint32, dst_slice->num_entry_point_offsets);
+    memcpy (dst_slice->entry_point_offset_minus1,
+        src_slice->entry_point_offset_minus1,
+        dst_slice->num_entry_point_offsets * sizeof (guint32));
   }
 
   return TRUE;
@@ -300,10 +300,28 @@ nal_reader_has_more_data (NalReader * nr)
 gint
 scan_for_start_codes (const guint8 * data, guint size)
 {
-  GstByteReader br;
-  gst_byte_reader_init (&br, data, size);
+  guint offset = 2;
 
   /* NALU not empty, so we can at least expect 1 (even 2) bytes following sc */
-  return gst_byte_reader_masked_scan_uint32 (&br, 0xffffff00, 0x00000100,
-      0, size);
+  if (size < 4)
+    return -1;
+
+  /* Look for the 00 00 01 pattern by letting memchr(), which every modern
+   * libc vectorizes, locate each 0x01 candidate and checking the two
+   * preceding bytes, instead of testing every input byte with the generic
+   * masked scan. The last possible 0x01 position is size - 2 so that at
+   * least one byte follows the start code */
+  while (offset < size - 1) {
+    const guint8 *candidate = memchr (data + offset, 0x01, size - 1 - offset);
+
+    if (candidate == NULL)
+      return -1;
+
+    offset = candidate - data;
+    if (candidate[-1] == 0x00 && candidate[-2] == 0x00)
+      return offset - 2;
+    offset++;
+  }
+
+  return -1;
 }
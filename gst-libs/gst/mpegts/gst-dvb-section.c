@@ -155,7 +155,7 @@ static gpointer
 _parse_eit (GstMpegtsSection * section)
 {
   GstMpegtsEIT *eit = NULL;
-  guint i = 0, allocated_events = 12;
+  guint i = 0, allocated_events;
   guint8 *data, *end, *duration_ptr;
   guint16 descriptors_loop_length;
 
@@ -164,6 +164,10 @@ _parse_eit (GstMpegtsSection * section)
   data = section->data;
   end = data + section->section_length;
 
+  /* Each event takes at least 12 bytes of payload; sizing the array from
+   * that keeps schedule sections full of events from reallocating it */
+  allocated_events = (section->section_length - 18) / 12 + 1;
+
   /* Skip already parsed data */
   data += 8;
 
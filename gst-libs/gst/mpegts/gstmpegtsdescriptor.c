@@ -740,6 +740,15 @@ G_DEFINE_BOXED_TYPE (GstMpegtsDescriptor, gst_mpegts_descriptor,
     (GBoxedCopyFunc) _copy_descriptor,
     (GBoxedFreeFunc) gst_mpegts_descriptor_free);
 
+/* Descriptors from gst_mpegts_parse_descriptors() carry their data in the
+ * same allocation as the struct itself (see below), so only one g_free is
+ * needed. Only ever used as the free function of the returned array. */
+static void
+_packed_descriptor_free (GstMpegtsDescriptor * desc)
+{
+  g_free (desc);
+}
+
 /**
  * gst_mpegts_parse_descriptors:
  * @buffer: (transfer none): descriptors to parse
@@ -795,18 +804,20 @@ gst_mpegts_parse_descriptors (guint8 * buffer, gsize buf_len)
 
   res =
       g_ptr_array_new_full (nb_desc + 1,
-      (GDestroyNotify) gst_mpegts_descriptor_free);
+      (GDestroyNotify) _packed_descriptor_free);
 
   data = buffer;
 
   for (i = 0; i < nb_desc; i++) {
-    GstMpegtsDescriptor *desc = g_slice_new0 (GstMpegtsDescriptor);
+    GstMpegtsDescriptor *desc;
 
-    desc->data = data;
+    /* Allocate the descriptor and its data in one block, so each entry
+     * costs a single allocation and a single copy */
+    desc = g_malloc0 (sizeof (GstMpegtsDescriptor) + data[1] + 2);
+    desc->data = (guint8 *) desc + sizeof (GstMpegtsDescriptor);
+    memcpy ((guint8 *) desc->data, data, data[1] + 2);
     desc->tag = *data++;
     desc->length = *data++;
-    /* Copy the data now that we known the size */
-    desc->data = g_memdup (desc->data, desc->length + 2);
     GST_LOG ("descriptor 0x%02x length:%d", desc->tag, desc->length);
     GST_MEMDUMP ("descriptor", desc->data + 2, desc->length);
     /* extended descriptors */
@@ -51,6 +51,7 @@
 #include "gstopencvvideofilter.h"
 #include "gstopencvutils.h"
 #include <opencv2/core.hpp>
+#include <opencv2/core/ocl.hpp>
 
 GST_DEBUG_CATEGORY_STATIC (gst_opencv_video_filter_debug);
 #define GST_CAT_DEFAULT gst_opencv_video_filter_debug
@@ -64,9 +65,12 @@ enum
 
 enum
 {
-  PROP_0
+  PROP_0,
+  PROP_OPENCL
 };
 
+#define DEFAULT_OPENCL FALSE
+
 #define parent_class gst_opencv_video_filter_parent_class
 G_DEFINE_ABSTRACT_TYPE (GstOpencvVideoFilter, gst_opencv_video_filter,
     GST_TYPE_VIDEO_FILTER);
@@ -93,6 +97,8 @@ gst_opencv_video_filter_finalize (GObject * obj)
 
   transform->cvImage.release ();
   transform->out_cvImage.release ();
+  transform->cvUMat.release ();
+  transform->out_cvUMat.release ();
 
   G_OBJECT_CLASS (parent_class)->finalize (obj);
 }
@@ -118,11 +124,37 @@ gst_opencv_video_filter_class_init (GstOpencvVideoFilterClass * klass)
   vfilter_class->transform_frame_ip =
       gst_opencv_video_filter_transform_frame_ip;
   vfilter_class->set_info = gst_opencv_video_filter_set_info;
+
+  g_object_class_install_property (gobject_class, PROP_OPENCL,
+      g_param_spec_boolean ("opencl", "OpenCL",
+          "Process frames on the GPU through OpenCV's transparent API, "
+          "if the element supports it and an OpenCL device is available",
+          DEFAULT_OPENCL,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 }
 
 static void
 gst_opencv_video_filter_init (GstOpencvVideoFilter * transform)
 {
+  transform->use_opencl = DEFAULT_OPENCL;
+}
+
+/* Whether this frame should take the UMat path: it is opt-in, needs the
+ * subclass to implement it and OpenCL to actually be usable, otherwise
+ * the upload/download would only add copies around CPU processing */
+static gboolean
+gst_opencv_video_filter_use_umat (GstOpencvVideoFilter * transform,
+    gpointer umat_func)
+{
+  if (!transform->use_opencl || umat_func == NULL)
+    return FALSE;
+
+  if (!cv::ocl::useOpenCL ()) {
+    GST_LOG_OBJECT (transform, "OpenCL requested but not available");
+    return FALSE;
+  }
+
+  return TRUE;
 }
 
 static GstFlowReturn
@@ -142,6 +174,18 @@ gst_opencv_video_filter_transform_frame (GstVideoFilter * trans,
   transform->cvImage.datastart = (unsigned char *) inframe->data[0];
   transform->out_cvImage.data = (unsigned char *) outframe->data[0];
   transform->out_cvImage.datastart = (unsigned char *) outframe->data[0];
+
+  if (gst_opencv_video_filter_use_umat (transform,
+          (gpointer) fclass->cv_trans_umat_func)) {
+    /* upload once, process on the device, download only the result */
+    transform->cvImage.copyTo (transform->cvUMat);
+    ret = fclass->cv_trans_umat_func (transform, inframe->buffer,
+        transform->cvUMat, outframe->buffer, transform->out_cvUMat);
+    if (ret == GST_FLOW_OK)
+      transform->out_cvUMat.copyTo (transform->out_cvImage);
+    return ret;
+  }
+
   ret = fclass->cv_trans_func (transform, inframe->buffer, transform->cvImage,
       outframe->buffer, transform->out_cvImage);
 
@@ -164,6 +208,16 @@ gst_opencv_video_filter_transform_frame_ip (GstVideoFilter * trans,
   transform->cvImage.data = (unsigned char *) frame->data[0];
   transform->cvImage.datastart = (unsigned char *) frame->data[0];
 
+  if (gst_opencv_video_filter_use_umat (transform,
+          (gpointer) fclass->cv_trans_ip_umat_func)) {
+    transform->cvImage.copyTo (transform->cvUMat);
+    ret = fclass->cv_trans_ip_umat_func (transform, frame->buffer,
+        transform->cvUMat);
+    if (ret == GST_FLOW_OK)
+      transform->cvUMat.copyTo (transform->cvImage);
+    return ret;
+  }
+
   ret = fclass->cv_trans_ip_func (transform, frame->buffer, transform->cvImage);
 
   return ret;
@@ -217,7 +271,12 @@ static void
 gst_opencv_video_filter_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
 {
+  GstOpencvVideoFilter *transform = GST_OPENCV_VIDEO_FILTER (object);
+
   switch (prop_id) {
+    case PROP_OPENCL:
+      transform->use_opencl = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -228,7 +287,12 @@ static void
 gst_opencv_video_filter_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec)
 {
+  GstOpencvVideoFilter *transform = GST_OPENCV_VIDEO_FILTER (object);
+
   switch (prop_id) {
+    case PROP_OPENCL:
+      g_value_set_boolean (value, transform->use_opencl);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -79,6 +79,15 @@ typedef GstFlowReturn (*GstOpencvVideoFilterTransformFunc)
     (GstOpencvVideoFilter * transform, GstBuffer * buffer, cv::Mat img,
     GstBuffer * outbuf, cv::Mat outimg);
 
+/* optional UMat variants used when the "opencl" property is enabled; the
+ * base class uploads the frame once, the subclass keeps its processing
+ * graph on cv::UMat and the result is downloaded at the boundary only */
+typedef GstFlowReturn (*GstOpencvVideoFilterTransformUMatIPFunc)
+    (GstOpencvVideoFilter * transform, GstBuffer * buffer, cv::UMat & img);
+typedef GstFlowReturn (*GstOpencvVideoFilterTransformUMatFunc)
+    (GstOpencvVideoFilter * transform, GstBuffer * buffer, cv::UMat & img,
+    GstBuffer * outbuf, cv::UMat & outimg);
+
 typedef gboolean (*GstOpencvVideoFilterSetCaps)
     (GstOpencvVideoFilter * transform, gint in_width, gint in_height,
     int in_cv_type, gint out_width, gint out_height,
@@ -89,9 +98,13 @@ struct _GstOpencvVideoFilter
   GstVideoFilter trans;
 
   gboolean in_place;
+  gboolean use_opencl;
 
   cv::Mat cvImage;
   cv::Mat out_cvImage;
+
+  cv::UMat cvUMat;
+  cv::UMat out_cvUMat;
 };
 
 struct _GstOpencvVideoFilterClass
@@ -102,6 +115,9 @@ struct _GstOpencvVideoFilterClass
   GstOpencvVideoFilterTransformIPFunc cv_trans_ip_func;
 
   GstOpencvVideoFilterSetCaps cv_set_caps;
+
+  GstOpencvVideoFilterTransformUMatFunc cv_trans_umat_func;
+  GstOpencvVideoFilterTransformUMatIPFunc cv_trans_ip_umat_func;
 };
 
 GST_OPENCV_API
@@ -83,6 +83,8 @@ typedef enum
   CONFIG_QUARK_USER_AGENT = 0,
   CONFIG_QUARK_POSITION_INTERVAL_UPDATE,
   CONFIG_QUARK_ACCURATE_SEEK,
+  CONFIG_QUARK_PIPELINE_PREWARM,
+  CONFIG_QUARK_FAST_SEEK,
 
   CONFIG_QUARK_MAX
 } ConfigQuarkId;
@@ -91,6 +93,8 @@ static const gchar *_config_quark_strings[] = {
   "user-agent",
   "position-interval-update",
   "accurate-seek",
+  "pipeline-prewarm",
+  "fast-seek",
 };
 
 GQuark _config_quark_table[CONFIG_QUARK_MAX];
@@ -147,6 +151,8 @@ enum
   GST_PLAY_FLAG_VIS = (1 << 3)
 };
 
+typedef struct _PositionUpdatedSignalData PositionUpdatedSignalData;
+
 struct _GstPlayer
 {
   GstObject parent;
@@ -192,6 +198,10 @@ struct _GstPlayer
    * state-changed:GST_PLAYER_STATE_STOPPED/PAUSED. This ensures that no signal
    * is emitted after gst_player_stop/pause() has been called by the user. */
   gboolean inhibit_sigs;
+  /* Not yet delivered position-updated dispatch, if any. New positions are
+   * folded into it instead of queueing further dispatches, so a slow
+   * application main context never accumulates a backlog of them. */
+  PositionUpdatedSignalData *position_signal_data;
 
   /* For playbin3 */
   gboolean use_playbin3;
@@ -290,6 +300,8 @@ gst_player_init (GstPlayer * self)
   self->config = gst_structure_new_id (QUARK_CONFIG,
       CONFIG_QUARK (POSITION_INTERVAL_UPDATE), G_TYPE_UINT, DEFAULT_POSITION_UPDATE_INTERVAL_MS,
       CONFIG_QUARK (ACCURATE_SEEK), G_TYPE_BOOLEAN, FALSE,
+      CONFIG_QUARK (PIPELINE_PREWARM), G_TYPE_BOOLEAN, FALSE,
+      CONFIG_QUARK (FAST_SEEK), G_TYPE_BOOLEAN, FALSE,
       NULL);
   /* *INDENT-ON* */
 
@@ -588,6 +600,7 @@ static gboolean
 gst_player_set_uri_internal (gpointer user_data)
 {
   GstPlayer *self = user_data;
+  gboolean prewarm;
 
   gst_player_stop_internal (self, FALSE);
 
@@ -610,8 +623,17 @@ gst_player_set_uri_internal (gpointer user_data)
 
   g_object_set (self->playbin, "suburi", NULL, NULL);
 
+  prewarm = gst_player_config_get_pipeline_prewarm (self->config);
+
   g_mutex_unlock (&self->lock);
 
+  /* Pre-roll the new URI in the background so that a later play request
+   * only has to perform the PAUSED->PLAYING transition */
+  if (prewarm && self->uri) {
+    GST_DEBUG_OBJECT (self, "Pre-rolling new URI");
+    gst_player_pause_internal (self);
+  }
+
   return G_SOURCE_REMOVE;
 }
 
@@ -910,23 +932,32 @@ change_state (GstPlayer * self, GstPlayerState state)
   }
 }
 
-typedef struct
+struct _PositionUpdatedSignalData
 {
   GstPlayer *player;
   GstClockTime position;
-} PositionUpdatedSignalData;
+};
 
 static void
 position_updated_dispatch (gpointer user_data)
 {
   PositionUpdatedSignalData *data = user_data;
+  GstClockTime position;
 
   if (data->player->inhibit_sigs)
     return;
 
+  /* Take the most recent position folded in by tick_cb() and stop
+   * accepting more, so later updates get a dispatch of their own */
+  g_mutex_lock (&data->player->lock);
+  position = data->position;
+  if (data->player->position_signal_data == data)
+    data->player->position_signal_data = NULL;
+  g_mutex_unlock (&data->player->lock);
+
   if (data->player->target_state >= GST_STATE_PAUSED) {
     g_signal_emit (data->player, signals[SIGNAL_POSITION_UPDATED], 0,
-        data->position);
+        position);
     g_object_notify_by_pspec (G_OBJECT (data->player),
         param_specs[PROP_POSITION]);
   }
@@ -935,7 +966,15 @@ position_updated_dispatch (gpointer user_data)
 static void
 position_updated_signal_data_free (PositionUpdatedSignalData * data)
 {
-  g_object_unref (data->player);
+  GstPlayer *player = data->player;
+
+  /* In case the dispatch never ran, e.g. the main context went away */
+  g_mutex_lock (&player->lock);
+  if (player->position_signal_data == data)
+    player->position_signal_data = NULL;
+  g_mutex_unlock (&player->lock);
+
+  g_object_unref (player);
   g_free (data);
 }
 
@@ -953,10 +992,23 @@ tick_cb (gpointer user_data)
 
     if (g_signal_handler_find (self, G_SIGNAL_MATCH_ID,
             signals[SIGNAL_POSITION_UPDATED], 0, NULL, NULL, NULL) != 0) {
-      PositionUpdatedSignalData *data = g_new (PositionUpdatedSignalData, 1);
+      PositionUpdatedSignalData *data;
 
+      g_mutex_lock (&self->lock);
+      if (self->position_signal_data) {
+        /* The application has not run the previous update yet; fold the
+         * new position into it instead of queueing another dispatch */
+        self->position_signal_data->position = position;
+        g_mutex_unlock (&self->lock);
+        return G_SOURCE_CONTINUE;
+      }
+
+      data = g_new (PositionUpdatedSignalData, 1);
       data->player = g_object_ref (self);
       data->position = position;
+      self->position_signal_data = data;
+      g_mutex_unlock (&self->lock);
+
       gst_player_signal_dispatcher_dispatch (self->signal_dispatcher, self,
           position_updated_dispatch, data,
           (GDestroyNotify) position_updated_signal_data_free);
@@ -3312,6 +3364,7 @@ gst_player_seek_internal_locked (GstPlayer * self)
   GstEvent *s_event;
   GstSeekFlags flags = 0;
   gboolean accurate = FALSE;
+  gboolean fast = FALSE;
 
   remove_seek_source (self);
 
@@ -3344,8 +3397,13 @@ gst_player_seek_internal_locked (GstPlayer * self)
   flags |= GST_SEEK_FLAG_FLUSH;
 
   accurate = gst_player_config_get_seek_accurate (self->config);
+  fast = gst_player_config_get_seek_fast (self->config);
 
-  if (accurate) {
+  if (fast) {
+    /* Jump to the nearest keyframe so the seek only costs one keyframe
+     * decode. Takes precedence over accurate seeking. */
+    flags |= GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SNAP_NEAREST;
+  } else if (accurate) {
     flags |= GST_SEEK_FLAG_ACCURATE;
   } else {
     flags &= ~GST_SEEK_FLAG_ACCURATE;
@@ -4731,6 +4789,105 @@ gst_player_config_get_seek_accurate (const GstStructure * config)
   return accurate;
 }
 
+/**
+ * gst_player_config_set_seek_fast:
+ * @config: a #GstPlayer configuration
+ * @fast: fast seek or not
+ *
+ * Enable or disable fast seeking. When enabled, seeks land on the keyframe
+ * nearest to the requested position instead of the exact position, so each
+ * seek is bounded by a single keyframe decode. This is useful for scrubbing,
+ * where many seeks are issued in quick succession and responsiveness matters
+ * more than precision.
+ *
+ * Fast seeking takes precedence over accurate seeking as configured with
+ * gst_player_config_set_seek_accurate().
+ *
+ * Fast seeking is disabled by default.
+ *
+ * Since: 1.16
+ */
+void
+gst_player_config_set_seek_fast (GstStructure * config, gboolean fast)
+{
+  g_return_if_fail (config != NULL);
+
+  gst_structure_id_set (config,
+      CONFIG_QUARK (FAST_SEEK), G_TYPE_BOOLEAN, fast, NULL);
+}
+
+/**
+ * gst_player_config_get_seek_fast:
+ * @config: a #GstPlayer configuration
+ *
+ * Returns: %TRUE if fast seeking is enabled
+ *
+ * Since: 1.16
+ */
+gboolean
+gst_player_config_get_seek_fast (const GstStructure * config)
+{
+  gboolean fast = FALSE;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  gst_structure_id_get (config,
+      CONFIG_QUARK (FAST_SEEK), G_TYPE_BOOLEAN, &fast, NULL);
+
+  return fast;
+}
+
+/**
+ * gst_player_config_set_pipeline_prewarm:
+ * @config: a #GstPlayer configuration
+ * @prewarm: pre-roll new URIs or not
+ *
+ * Enable or disable pipeline pre-warming. When enabled, setting a new URI
+ * immediately pre-rolls the pipeline to %GST_PLAYER_STATE_PAUSED in the
+ * background, so element factories are loaded and the streams are decoded
+ * up to the first frame before gst_player_play() is called. A subsequent
+ * play request then only has to start the sinks, which significantly
+ * reduces the time to the first rendered frame.
+ *
+ * Note that with pre-warming enabled the player leaves
+ * %GST_PLAYER_STATE_STOPPED as soon as a URI is set, and network sources
+ * start downloading before playback is requested.
+ *
+ * Pipeline pre-warming is disabled by default.
+ *
+ * Since: 1.16
+ */
+void
+gst_player_config_set_pipeline_prewarm (GstStructure * config,
+    gboolean prewarm)
+{
+  g_return_if_fail (config != NULL);
+
+  gst_structure_id_set (config,
+      CONFIG_QUARK (PIPELINE_PREWARM), G_TYPE_BOOLEAN, prewarm, NULL);
+}
+
+/**
+ * gst_player_config_get_pipeline_prewarm:
+ * @config: a #GstPlayer configuration
+ *
+ * Returns: %TRUE if pipeline pre-warming is enabled
+ *
+ * Since: 1.16
+ */
+gboolean
+gst_player_config_get_pipeline_prewarm (const GstStructure * config)
+{
+  gboolean prewarm = FALSE;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  gst_structure_id_get (config,
+      CONFIG_QUARK (PIPELINE_PREWARM), G_TYPE_BOOLEAN, &prewarm, NULL);
+
+  return prewarm;
+}
+
 /**
  * gst_player_get_video_snapshot:
  * @player: #GstPlayer instance
@@ -285,6 +285,18 @@ void           gst_player_config_set_seek_accurate (GstStructure * config, gbool
 GST_PLAYER_API
 gboolean       gst_player_config_get_seek_accurate (const GstStructure * config);
 
+GST_PLAYER_API
+void           gst_player_config_set_seek_fast (GstStructure * config, gboolean fast);
+
+GST_PLAYER_API
+gboolean       gst_player_config_get_seek_fast (const GstStructure * config);
+
+GST_PLAYER_API
+void           gst_player_config_set_pipeline_prewarm (GstStructure * config, gboolean prewarm);
+
+GST_PLAYER_API
+gboolean       gst_player_config_get_pipeline_prewarm (const GstStructure * config);
+
 typedef enum
 {
   GST_PLAYER_THUMBNAIL_RAW_NATIVE = 0,
@@ -44,6 +44,9 @@ enum
 
 struct _GstFragmentPrivate
 {
+  /* List of downloaded chunks, in download order */
+  GstBufferList *buffer_list;
+  /* Lazily built single buffer spanning all chunks */
   GstBuffer *buffer;
   GstCaps *caps;
   GMutex lock;
@@ -158,6 +161,7 @@ gst_fragment_init (GstFragment * fragment)
   fragment->priv = priv = gst_fragment_get_instance_private (fragment);
 
   g_mutex_init (&fragment->priv->lock);
+  priv->buffer_list = NULL;
   priv->buffer = NULL;
   fragment->download_start_time = gst_util_get_timestamp ();
   fragment->start_time = 0;
@@ -195,6 +199,11 @@ gst_fragment_dispose (GObject * object)
 {
   GstFragmentPrivate *priv = GST_FRAGMENT (object)->priv;
 
+  if (priv->buffer_list != NULL) {
+    gst_buffer_list_unref (priv->buffer_list);
+    priv->buffer_list = NULL;
+  }
+
   if (priv->buffer != NULL) {
     gst_buffer_unref (priv->buffer);
     priv->buffer = NULL;
@@ -208,18 +217,81 @@ gst_fragment_dispose (GObject * object)
   G_OBJECT_CLASS (gst_fragment_parent_class)->dispose (object);
 }
 
+/* called with the fragment lock taken */
+static void
+gst_fragment_ensure_buffer (GstFragment * fragment)
+{
+  GstFragmentPrivate *priv = fragment->priv;
+  guint i, len;
+
+  if (priv->buffer != NULL || priv->buffer_list == NULL)
+    return;
+
+  /* Merge the chunk list into a single buffer. This only appends the
+   * chunks' GstMemory to one buffer, the data itself is not copied. */
+  len = gst_buffer_list_length (priv->buffer_list);
+  for (i = 0; i < len; i++) {
+    GstBuffer *chunk =
+        gst_buffer_ref (gst_buffer_list_get (priv->buffer_list, i));
+
+    if (priv->buffer == NULL)
+      priv->buffer = chunk;
+    else
+      priv->buffer = gst_buffer_append (priv->buffer, chunk);
+  }
+}
+
 GstBuffer *
 gst_fragment_get_buffer (GstFragment * fragment)
 {
+  GstBuffer *buffer;
+
   g_return_val_if_fail (fragment != NULL, NULL);
 
   if (!fragment->completed)
     return NULL;
-  if (!fragment->priv->buffer)
+
+  g_mutex_lock (&fragment->priv->lock);
+  gst_fragment_ensure_buffer (fragment);
+  buffer = fragment->priv->buffer;
+  if (buffer)
+    gst_buffer_ref (buffer);
+  g_mutex_unlock (&fragment->priv->lock);
+
+  return buffer;
+}
+
+/**
+ * gst_fragment_get_buffer_list:
+ * @fragment: a #GstFragment
+ *
+ * Gets the downloaded data as a #GstBufferList of the individual chunks
+ * in download order. Unlike gst_fragment_get_buffer() this never has to
+ * merge the chunks, so consumers that can push a buffer list downstream
+ * avoid mapping the whole fragment contiguously.
+ *
+ * Returns: (transfer full) (nullable): the fragment's data, or %NULL if
+ * the download is not completed yet.
+ *
+ * Since: 1.16
+ */
+GstBufferList *
+gst_fragment_get_buffer_list (GstFragment * fragment)
+{
+  GstBufferList *list;
+
+  g_return_val_if_fail (fragment != NULL, NULL);
+
+  if (!fragment->completed)
     return NULL;
 
-  gst_buffer_ref (fragment->priv->buffer);
-  return fragment->priv->buffer;
+  g_mutex_lock (&fragment->priv->lock);
+  list = fragment->priv->buffer_list;
+  if (list)
+    gst_buffer_list_ref (list);
+  g_mutex_unlock (&fragment->priv->lock);
+
+  return list;
 }
 
 void
@@ -241,6 +313,7 @@ gst_fragment_get_caps (GstFragment * fragment)
     return NULL;
 
   g_mutex_lock (&fragment->priv->lock);
+  gst_fragment_ensure_buffer (fragment);
   if (fragment->priv->caps == NULL) {
     guint64 offset, offset_end;
 
@@ -275,9 +348,10 @@ gst_fragment_add_buffer (GstFragment * fragment, GstBuffer * buffer)
 
   GST_DEBUG ("Adding new buffer to the fragment");
   /* We steal the buffers you pass in */
-  if (fragment->priv->buffer == NULL)
-    fragment->priv->buffer = buffer;
-  else
-    fragment->priv->buffer = gst_buffer_append (fragment->priv->buffer, buffer);
+  g_mutex_lock (&fragment->priv->lock);
+  if (fragment->priv->buffer_list == NULL)
+    fragment->priv->buffer_list = gst_buffer_list_new ();
+  gst_buffer_list_add (fragment->priv->buffer_list, buffer);
+  g_mutex_unlock (&fragment->priv->lock);
   return TRUE;
 }
@@ -72,6 +72,9 @@ GType gst_fragment_get_type (void);
 GST_URI_DOWNLOADER_API
 GstBuffer * gst_fragment_get_buffer (GstFragment *fragment);
 
+GST_URI_DOWNLOADER_API
+GstBufferList * gst_fragment_get_buffer_list (GstFragment *fragment);
+
 GST_URI_DOWNLOADER_API
 void gst_fragment_set_caps (GstFragment * fragment, GstCaps * caps);
 
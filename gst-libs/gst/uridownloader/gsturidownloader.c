@@ -23,6 +23,7 @@
 #endif
 
 #include <glib.h>
+#include <glib/gstdio.h>
 #include "gstfragment.h"
 #include "gsturidownloader.h"
 #include "gsturidownloader_debug.h"
@@ -47,8 +48,21 @@ struct _GstUriDownloaderPrivate
 
   GCond cond;
   gboolean cancelled;
+
+  /* Optional on-disk download cache */
+  gchar *cache_dir;
+  guint64 cache_max_size;
+
+  /* Minimum spacing between requests to the same host, 0 to disable */
+  guint host_request_interval;
 };
 
+/* Process-wide per-host request slots, shared between all downloader
+ * instances so that aligned manifest refreshes from many sessions on one
+ * node spread out instead of bursting towards the same server */
+static GMutex host_slots_lock;
+static GHashTable *host_slots;  /* host -> next slot (gint64 *, monotonic us) */
+
 static void gst_uri_downloader_finalize (GObject * object);
 static void gst_uri_downloader_dispose (GObject * object);
 
@@ -143,6 +157,7 @@ gst_uri_downloader_finalize (GObject * object)
 {
   GstUriDownloader *downloader = GST_URI_DOWNLOADER (object);
 
+  g_free (downloader->priv->cache_dir);
   g_mutex_clear (&downloader->priv->download_lock);
   g_cond_clear (&downloader->priv->cond);
 
@@ -176,6 +191,265 @@ gst_uri_downloader_set_parent (GstUriDownloader * downloader,
   g_weak_ref_set (&downloader->priv->parent, parent);
 }
 
+/**
+ * gst_uri_downloader_set_cache_dir:
+ * @downloader: the #GstUriDownloader
+ * @cache_dir: (nullable): directory to cache downloads in, or %NULL to
+ *   disable caching
+ * @max_size: maximum total size of the cache in bytes, 0 for unlimited
+ *
+ * Enables an on-disk cache for downloads, keyed by URI and byte range.
+ * Cache hits are served as buffers wrapping a memory-mapped file, so
+ * repeated fetches of the same resource (e.g. VOD segments played by
+ * many sessions on the same node) avoid both the network fetch and a
+ * heap copy of the payload. When the cache grows past @max_size the
+ * least recently used entries are evicted.
+ */
+void
+gst_uri_downloader_set_cache_dir (GstUriDownloader * downloader,
+    const gchar * cache_dir, guint64 max_size)
+{
+  g_mutex_lock (&downloader->priv->download_lock);
+  g_free (downloader->priv->cache_dir);
+  downloader->priv->cache_dir = g_strdup (cache_dir);
+  downloader->priv->cache_max_size = max_size;
+  if (cache_dir)
+    g_mkdir_with_parents (cache_dir, 0700);
+  g_mutex_unlock (&downloader->priv->download_lock);
+}
+
+/**
+ * gst_uri_downloader_set_host_request_interval:
+ * @downloader: the #GstUriDownloader
+ * @interval_ms: minimum spacing between requests to one host in
+ *   milliseconds, 0 to disable
+ *
+ * Spreads requests towards the same host over time. Before each fetch the
+ * downloader reserves the next free request slot for the target host; slots
+ * are spaced by @interval_ms plus up to half an interval of random jitter.
+ * The slot table is shared between all downloaders in the process, so many
+ * sessions refreshing manifests on aligned segment boundaries are smoothed
+ * into a steady request rate instead of a synchronized burst.
+ */
+void
+gst_uri_downloader_set_host_request_interval (GstUriDownloader * downloader,
+    guint interval_ms)
+{
+  g_mutex_lock (&downloader->priv->download_lock);
+  downloader->priv->host_request_interval = interval_ms;
+  g_mutex_unlock (&downloader->priv->download_lock);
+}
+
+/* Reserve the next request slot towards @uri's host and wait until it
+ * arrives. Called with download_lock taken; the wait is interrupted by
+ * gst_uri_downloader_cancel() like the download wait itself. */
+static void
+gst_uri_downloader_wait_for_host_slot (GstUriDownloader * downloader,
+    const gchar * uri)
+{
+  GstUri *parsed;
+  gchar *host;
+  gint64 *slotp;
+  gint64 now, slot;
+  gint64 interval = downloader->priv->host_request_interval * (gint64) 1000;
+
+  if (interval == 0)
+    return;
+
+  parsed = gst_uri_from_string (uri);
+  if (parsed == NULL)
+    return;
+  host = g_strdup (gst_uri_get_host (parsed));
+  gst_uri_unref (parsed);
+  if (host == NULL)
+    return;
+
+  now = g_get_monotonic_time ();
+
+  g_mutex_lock (&host_slots_lock);
+  if (host_slots == NULL)
+    host_slots = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+        g_free);
+  slotp = g_hash_table_lookup (host_slots, host);
+  if (slotp == NULL) {
+    slotp = g_new (gint64, 1);
+    *slotp = now;
+    g_hash_table_insert (host_slots, host, slotp);
+  } else {
+    g_free (host);
+  }
+  slot = MAX (*slotp, now);
+  *slotp = slot + interval +
+      g_random_int_range (0, MAX ((gint32) (interval / 2), 1));
+  g_mutex_unlock (&host_slots_lock);
+
+  if (slot <= now)
+    return;
+
+  GST_DEBUG_OBJECT (downloader,
+      "Waiting %" G_GINT64_FORMAT "ms for a request slot",
+      (slot - now) / 1000);
+
+  GST_OBJECT_LOCK (downloader);
+  while (!downloader->priv->cancelled && g_get_monotonic_time () < slot)
+    g_cond_wait_until (&downloader->priv->cond,
+        GST_OBJECT_GET_LOCK (downloader), slot);
+  GST_OBJECT_UNLOCK (downloader);
+}
+
+static gchar *
+gst_uri_downloader_cache_path (GstUriDownloader * downloader,
+    const gchar * uri, gint64 range_start, gint64 range_end)
+{
+  gchar *key_data, *key, *path;
+
+  key_data = g_strdup_printf ("%s\n%" G_GINT64_FORMAT "-%" G_GINT64_FORMAT,
+      uri, range_start, range_end);
+  key = g_compute_checksum_for_string (G_CHECKSUM_SHA256, key_data, -1);
+  path = g_build_filename (downloader->priv->cache_dir, key, NULL);
+  g_free (key_data);
+  g_free (key);
+
+  return path;
+}
+
+/* called with download_lock taken */
+static GstFragment *
+gst_uri_downloader_cache_lookup (GstUriDownloader * downloader,
+    const gchar * uri, gint64 range_start, gint64 range_end)
+{
+  gchar *path;
+  GMappedFile *mapped;
+  GstFragment *fragment = NULL;
+
+  path = gst_uri_downloader_cache_path (downloader, uri, range_start,
+      range_end);
+  mapped = g_mapped_file_new (path, FALSE, NULL);
+  if (mapped) {
+    GstBuffer *buffer;
+
+    GST_DEBUG_OBJECT (downloader, "Cache hit for URI %s", path);
+
+    /* freshen the mtime for LRU eviction */
+    g_utime (path, NULL);
+
+    buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+        g_mapped_file_get_contents (mapped),
+        g_mapped_file_get_length (mapped), 0,
+        g_mapped_file_get_length (mapped), mapped,
+        (GDestroyNotify) g_mapped_file_unref);
+
+    fragment = gst_fragment_new ();
+    fragment->uri = g_strdup (uri);
+    fragment->range_start = range_start;
+    fragment->range_end = range_end;
+    gst_fragment_add_buffer (fragment, buffer);
+    fragment->completed = TRUE;
+    fragment->download_stop_time = gst_util_get_timestamp ();
+  }
+  g_free (path);
+
+  return fragment;
+}
+
+static gint
+cache_entry_compare_mtime (gconstpointer a, gconstpointer b)
+{
+  GStatBuf sa, sb;
+
+  if (g_stat ((const gchar *) a, &sa) != 0 || g_stat ((const gchar *) b,
+          &sb) != 0)
+    return 0;
+  if (sa.st_mtime < sb.st_mtime)
+    return -1;
+  return sa.st_mtime > sb.st_mtime;
+}
+
+/* called with download_lock taken */
+static void
+gst_uri_downloader_cache_prune (GstUriDownloader * downloader)
+{
+  GDir *dir;
+  const gchar *name;
+  GList *entries = NULL, *l;
+  guint64 total = 0;
+
+  if (downloader->priv->cache_max_size == 0)
+    return;
+
+  dir = g_dir_open (downloader->priv->cache_dir, 0, NULL);
+  if (!dir)
+    return;
+
+  while ((name = g_dir_read_name (dir))) {
+    gchar *path = g_build_filename (downloader->priv->cache_dir, name, NULL);
+    GStatBuf st;
+
+    if (g_stat (path, &st) == 0) {
+      total += st.st_size;
+      entries = g_list_prepend (entries, path);
+    } else {
+      g_free (path);
+    }
+  }
+  g_dir_close (dir);
+
+  if (total > downloader->priv->cache_max_size) {
+    entries = g_list_sort (entries, cache_entry_compare_mtime);
+    for (l = entries; l != NULL && total > downloader->priv->cache_max_size;
+        l = l->next) {
+      gchar *path = l->data;
+      GStatBuf st;
+
+      if (g_stat (path, &st) == 0 && g_remove (path) == 0) {
+        GST_DEBUG_OBJECT (downloader, "Evicted cache entry %s", path);
+        total -= st.st_size;
+      }
+    }
+  }
+
+  g_list_free_full (entries, g_free);
+}
+
+/* called with download_lock taken */
+static void
+gst_uri_downloader_cache_store (GstUriDownloader * downloader,
+    GstFragment * fragment, const gchar * uri, gint64 range_start,
+    gint64 range_end)
+{
+  GstBuffer *buffer;
+  GstMapInfo map;
+  gchar *path, *tmp_path;
+
+  buffer = gst_fragment_get_buffer (fragment);
+  if (buffer == NULL)
+    return;
+
+  if (!gst_buffer_map (buffer, &map, GST_MAP_READ)) {
+    gst_buffer_unref (buffer);
+    return;
+  }
+
+  path = gst_uri_downloader_cache_path (downloader, uri, range_start,
+      range_end);
+  tmp_path = g_strconcat (path, ".tmp", NULL);
+
+  /* write to a temporary file and rename so concurrent readers never
+   * see a partial entry */
+  if (g_file_set_contents (tmp_path, (const gchar *) map.data, map.size,
+          NULL)) {
+    if (g_rename (tmp_path, path) != 0)
+      g_remove (tmp_path);
+    else
+      gst_uri_downloader_cache_prune (downloader);
+  }
+
+  g_free (tmp_path);
+  g_free (path);
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+}
+
 static gboolean
 gst_uri_downloader_sink_event (GstPad * pad, GstObject * parent,
     GstEvent * event)
@@ -477,6 +751,10 @@ gst_uri_downloader_set_uri (GstUriDownloader * downloader, const gchar * uri,
     g_object_set (downloader->priv->urisrc, "compress", compress, NULL);
   if (g_object_class_find_property (gobject_class, "keep-alive"))
     g_object_set (downloader->priv->urisrc, "keep-alive", TRUE, NULL);
+  /* a previous download may have left a HEAD method behind on the
+   * re-used source element, reset it */
+  if (g_object_class_find_property (gobject_class, "method"))
+    g_object_set (downloader->priv->urisrc, "method", "GET", NULL);
   if (g_object_class_find_property (gobject_class, "extra-headers")) {
     if (referer || refresh || !allow_cache) {
       GstStructure *extra_headers = gst_structure_new_empty ("headers");
@@ -562,6 +840,21 @@ gst_uri_downloader_fetch_uri_with_range (GstUriDownloader *
   GST_DEBUG_OBJECT (downloader, "Fetching URI %s", uri);
 
   g_mutex_lock (&downloader->priv->download_lock);
+
+  /* try the on-disk cache first; refresh requests and HEAD requests
+   * must always hit the network */
+  if (downloader->priv->cache_dir && allow_cache && !refresh
+      && !(range_start < 0 && range_end < 0)) {
+    download = gst_uri_downloader_cache_lookup (downloader, uri, range_start,
+        range_end);
+    if (download) {
+      g_mutex_unlock (&downloader->priv->download_lock);
+      return download;
+    }
+  }
+
+  gst_uri_downloader_wait_for_host_slot (downloader, uri);
+
   downloader->priv->err = NULL;
   downloader->priv->got_buffer = FALSE;
 
@@ -673,10 +966,16 @@ quit:
       gst_bus_set_sync_handler (downloader->priv->bus, NULL, NULL, NULL);
       gst_bus_set_flushing (downloader->priv->bus, TRUE);
 
-      /* set the element state to NULL */
+      /* stop the element, but keep it around in READY so a persistent
+       * HTTP connection (and TLS session) survives until the next
+       * download; a failure here is often just a 404 on a live edge
+       * and tearing the connection down would cost two extra RTTs on
+       * the retry */
       GST_OBJECT_UNLOCK (downloader);
       if (download == NULL) {
-        gst_element_set_state (urisrc, GST_STATE_NULL);
+        if (gst_element_set_state (urisrc,
+                GST_STATE_READY) == GST_STATE_CHANGE_FAILURE)
+          gst_element_set_state (urisrc, GST_STATE_NULL);
       } else {
         GstQuery *query;
 
@@ -715,6 +1014,11 @@ quit:
 
     downloader->priv->cancelled = FALSE;
 
+    if (download != NULL && downloader->priv->cache_dir && allow_cache
+        && !refresh && downloader->priv->got_buffer)
+      gst_uri_downloader_cache_store (downloader, download, uri, range_start,
+          range_end);
+
     g_mutex_unlock (&downloader->priv->download_lock);
     return download;
   }
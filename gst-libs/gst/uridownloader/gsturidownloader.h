@@ -67,6 +67,12 @@ GstUriDownloader * gst_uri_downloader_new (void);
 GST_URI_DOWNLOADER_API
 void gst_uri_downloader_set_parent (GstUriDownloader * downloader, GstElement * parent);
 
+GST_URI_DOWNLOADER_API
+void gst_uri_downloader_set_cache_dir (GstUriDownloader * downloader, const gchar * cache_dir, guint64 max_size);
+
+GST_URI_DOWNLOADER_API
+void gst_uri_downloader_set_host_request_interval (GstUriDownloader * downloader, guint interval_ms);
+
 GST_URI_DOWNLOADER_API
 GstFragment * gst_uri_downloader_fetch_uri (GstUriDownloader * downloader, const gchar * uri, const gchar * referer, gboolean compress, gboolean refresh, gboolean allow_cache, GError ** err);
 
@@ -260,10 +260,24 @@ static const int ima_step_size[89] = {
   32767
 };
 
+/* Advance the predictor and step index of one channel by a single nibble */
+static inline void
+ima_decode_nibble (int bytecode, int *pred, int *index)
+{
+  int step = ima_step_size[*index];
+  int diff = (2 * (bytecode & 0x7) * step + step) / 8;
+
+  if (bytecode & 8)
+    diff = -diff;
+
+  *pred = CLAMP (*pred + diff, G_MININT16, G_MAXINT16);
+  *index = CLAMP (*index + ima_indx_adjust[bytecode], 0, 88);
+}
+
 /* Decode a single block of data from 'data', storing 'n_samples' decoded 16 bit
    samples in 'samples'.
 
-   All buffer lengths have been verified by the caller 
+   All buffer lengths have been verified by the caller
  */
 static gboolean
 adpcmdec_decode_ima_block (ADPCMDec * dec, int n_samples, const guint8 * data,
@@ -273,7 +287,6 @@ adpcmdec_decode_ima_block (ADPCMDec * dec, int n_samples, const guint8 * data,
   int channel;
   int idx;
   int i, j;
-  int sample;
 
   if ((n_samples - dec->channels) % 8 != 0) {
     GST_WARNING_OBJECT (dec, "Input not correct size");
@@ -295,30 +308,23 @@ adpcmdec_decode_ima_block (ADPCMDec * dec, int n_samples, const guint8 * data,
 
   while (i < n_samples) {
     for (channel = 0; channel < dec->channels; channel++) {
-      sample = i + channel;
-      for (j = 0; j < 8; j++) {
-        int bytecode;
-        int step;
-        int diff;
-
-        if (j % 2 == 0) {
-          bytecode = data[idx] & 0x0F;
-        } else {
-          bytecode = (data[idx] >> 4) & 0x0F;
-          idx++;
-        }
-        step = ima_step_size[stepindex[channel]];
-        diff = (2 * (bytecode & 0x7) * step + step) / 8;
-        if (bytecode & 8)
-          diff = -diff;
-
-        samples[sample] =
-            CLAMP (samples[sample - dec->channels] + diff, G_MININT16,
-            G_MAXINT16);
-        stepindex[channel] =
-            CLAMP (stepindex[channel] + ima_indx_adjust[bytecode], 0, 88);
-        sample += dec->channels;
+      /* keep the predictor recurrence and step index in locals while
+         decoding the eight samples in this channel's four data bytes */
+      int pred = samples[i - dec->channels + channel];
+      int index = stepindex[channel];
+      gint16 *out = samples + i + channel;
+
+      for (j = 0; j < 4; j++) {
+        guint8 byte = data[idx++];
+
+        ima_decode_nibble (byte & 0x0F, &pred, &index);
+        *out = pred;
+        out += dec->channels;
+        ima_decode_nibble ((byte >> 4) & 0x0F, &pred, &index);
+        *out = pred;
+        out += dec->channels;
       }
+      stepindex[channel] = index;
     }
     i += 8 * dec->channels;
   }
@@ -342,7 +348,9 @@ adpcmdec_decode_block (ADPCMDec * dec, const guint8 * data, int blocksize)
       goto exit;
     samples = (blocksize - 7 * dec->channels) * 2 + 2 * dec->channels;
     outsize = 2 * samples;
-    outbuf = gst_buffer_new_and_alloc (outsize);
+    outbuf =
+        gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER (dec),
+        outsize);
 
     gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
     res = adpcmdec_decode_ms_block (dec, samples, data, (gint16 *) omap.data);
@@ -354,7 +362,9 @@ adpcmdec_decode_block (ADPCMDec * dec, const guint8 * data, int blocksize)
       goto exit;
     samples = (blocksize - 4 * dec->channels) * 2 + dec->channels;
     outsize = 2 * samples;
-    outbuf = gst_buffer_new_and_alloc (outsize);
+    outbuf =
+        gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER (dec),
+        outsize);
 
     gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
     res = adpcmdec_decode_ima_block (dec, samples, data, (gint16 *) omap.data);
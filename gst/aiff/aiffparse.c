@@ -768,25 +768,15 @@ unknown_compression:
   }
 }
 
+/* Reads the payload of a chunk whose 8 byte header was already parsed by
+ * the caller: @offset points at the chunk header, @size is the payload
+ * size from it. The header bytes are not pulled a second time */
 static GstFlowReturn
-gst_aiff_parse_read_chunk (GstAiffParse * aiff, guint64 * offset, guint32 * tag,
-    GstBuffer ** data)
+gst_aiff_parse_read_chunk_data (GstAiffParse * aiff, guint64 * offset,
+    guint32 size, GstBuffer ** data)
 {
-  guint size;
   GstFlowReturn res;
   GstBuffer *buf = NULL;
-  GstMapInfo info;
-
-  if ((res =
-          gst_pad_pull_range (aiff->sinkpad, *offset, 8, &buf)) != GST_FLOW_OK)
-    return res;
-
-  gst_buffer_map (buf, &info, GST_MAP_READ);
-  *tag = GST_READ_UINT32_LE (info.data);
-  size = GST_READ_UINT32_BE (info.data + 4);
-  gst_buffer_unmap (buf, &info);
-  gst_buffer_unref (buf);
-  buf = NULL;
 
   if ((res =
           gst_pad_pull_range (aiff->sinkpad, (*offset) + 8, size,
@@ -958,8 +948,8 @@ gst_aiff_parse_stream_headers (GstAiffParse * aiff)
           buf = gst_adapter_take_buffer (aiff->adapter, size);
           aiff->offset += size;
         } else {
-          if ((res = gst_aiff_parse_read_chunk (aiff,
-                      &aiff->offset, &tag, &buf)) != GST_FLOW_OK)
+          if ((res = gst_aiff_parse_read_chunk_data (aiff,
+                      &aiff->offset, size, &buf)) != GST_FLOW_OK)
             return res;
         }
 
@@ -1044,14 +1034,16 @@ gst_aiff_parse_stream_headers (GstAiffParse * aiff)
           GstBuffer *ssndbuf = NULL;
           GstMapInfo info;
 
+          /* the 8 byte chunk header was already read above, only pull the
+           * SSND header that follows it */
           if ((res =
-                  gst_pad_pull_range (aiff->sinkpad, aiff->offset, 16,
+                  gst_pad_pull_range (aiff->sinkpad, aiff->offset + 8, 8,
                       &ssndbuf)) != GST_FLOW_OK)
             goto header_read_error;
 
           gst_buffer_map (ssndbuf, &info, GST_MAP_READ);
-          aiff->ssnd_offset = GST_READ_UINT32_BE (info.data + 8);
-          aiff->ssnd_blocksize = GST_READ_UINT32_BE (info.data + 12);
+          aiff->ssnd_offset = GST_READ_UINT32_BE (info.data);
+          aiff->ssnd_blocksize = GST_READ_UINT32_BE (info.data + 4);
           gst_buffer_unmap (ssndbuf, &info);
           gst_buffer_unref (ssndbuf);
         }
@@ -1093,8 +1085,8 @@ gst_aiff_parse_stream_headers (GstAiffParse * aiff)
 
           buf = gst_adapter_take_buffer (aiff->adapter, size);
         } else {
-          if ((res = gst_aiff_parse_read_chunk (aiff,
-                      &aiff->offset, &tag, &buf)) != GST_FLOW_OK)
+          if ((res = gst_aiff_parse_read_chunk_data (aiff,
+                      &aiff->offset, size, &buf)) != GST_FLOW_OK)
             return res;
         }
 
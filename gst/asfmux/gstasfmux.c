@@ -198,6 +198,12 @@ gst_asf_mux_reset (GstAsfMux * asfmux)
   asfmux->payloads = NULL;
   asfmux->payload_data_size = 0;
 
+  if (asfmux->packet_pool) {
+    gst_buffer_pool_set_active (asfmux->packet_pool, FALSE);
+    gst_object_unref (asfmux->packet_pool);
+    asfmux->packet_pool = NULL;
+  }
+
   asfmux->file_id.v1 = 0;
   asfmux->file_id.v2 = 0;
   asfmux->file_id.v3 = 0;
@@ -1480,9 +1486,31 @@ gst_asf_mux_flush_payloads (GstAsfMux * asfmux)
 
   GST_LOG_OBJECT (asfmux, "Flushing payloads");
 
-  buf = gst_buffer_new_and_alloc (asfmux->packet_size);
+  /* data packets all have the same size, so they are served from our own
+   * pool instead of being allocated one by one. No need to clear the
+   * packet up front either: every byte is either written below or part of
+   * the padding area, which is cleared after the payloads are in place */
+  if (G_UNLIKELY (asfmux->packet_pool == NULL)) {
+    GstStructure *config;
+
+    asfmux->packet_pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (asfmux->packet_pool);
+    gst_buffer_pool_config_set_params (config, NULL, asfmux->packet_size, 2,
+        0);
+    if (!gst_buffer_pool_set_config (asfmux->packet_pool, config) ||
+        !gst_buffer_pool_set_active (asfmux->packet_pool, TRUE)) {
+      GST_WARNING_OBJECT (asfmux, "Failed to activate the packet pool");
+      gst_object_unref (asfmux->packet_pool);
+      asfmux->packet_pool = NULL;
+    }
+  }
+
+  buf = NULL;
+  if (asfmux->packet_pool == NULL ||
+      gst_buffer_pool_acquire_buffer (asfmux->packet_pool, &buf,
+          NULL) != GST_FLOW_OK)
+    buf = gst_buffer_new_and_alloc (asfmux->packet_size);
   gst_buffer_map (buf, &map, GST_MAP_WRITE);
-  memset (map.data, 0, asfmux->packet_size);
 
   /* 1 for the multiple payload flags */
   data = map.data + asfmux->payload_parsing_info_size + 1;
@@ -1601,6 +1629,11 @@ gst_asf_mux_flush_payloads (GstAsfMux * asfmux)
     payloads_count++;
   }
 
+  /* the unused tail of the packet is padding and must be zeroed; everything
+   * before it is overwritten below or was filled by the payloads */
+  if (size_left > 0)
+    memset (map.data + (asfmux->packet_size - size_left), 0, size_left);
+
   GST_LOG_OBJECT (asfmux, "Payload data size: %" G_GUINT32_FORMAT,
       asfmux->payload_data_size);
 
@@ -1649,6 +1682,8 @@ gst_asf_mux_flush_payloads (GstAsfMux * asfmux)
   if (GST_CLOCK_TIME_IS_VALID (send_ts)) {
     GST_WRITE_UINT32_LE (data + offset, (send_ts / GST_MSECOND));
     GST_BUFFER_TIMESTAMP (buf) = send_ts;
+  } else {
+    GST_WRITE_UINT32_LE (data + offset, 0);
   }
   offset += 4;
 
@@ -2432,6 +2467,11 @@ gst_asf_mux_change_state (GstElement * element, GstStateChange transition)
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_collect_pads_stop (asfmux->collect);
       asfmux->state = GST_ASF_MUX_STATE_NONE;
+      if (asfmux->packet_pool) {
+        gst_buffer_pool_set_active (asfmux->packet_pool, FALSE);
+        gst_object_unref (asfmux->packet_pool);
+        asfmux->packet_pool = NULL;
+      }
       break;
     default:
       break;
@@ -123,6 +123,9 @@ struct _GstAsfMux
   guint32 payload_parsing_info_size;
   GSList *payloads;
 
+  /* pool for the fixed size data packets */
+  GstBufferPool *packet_pool;
+
   Guid file_id;
 
   /* properties */
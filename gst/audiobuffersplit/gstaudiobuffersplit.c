@@ -336,19 +336,69 @@ gst_audio_buffer_split_change_state (GstElement * element,
   return state_ret;
 }
 
+/* Takes ownership of the buffer, timestamps it based on the current offset
+ * and pushes it downstream. The buffer must hold the samples the current
+ * offset expects next */
+static GstFlowReturn
+gst_audio_buffer_split_output_buffer (GstAudioBufferSplit * self,
+    GstBuffer * buffer, gint rate, gint bpf)
+{
+  GstClockTime resync_time = self->resync_time;
+  GstClockTime resync_time_diff;
+  gsize size = gst_buffer_get_size (buffer);
+
+  /* After a reset we have to set the discont flag */
+  if (self->current_offset == 0)
+    GST_BUFFER_FLAG_SET (buffer, GST_BUFFER_FLAG_DISCONT);
+
+  resync_time_diff =
+      gst_util_uint64_scale (self->current_offset, GST_SECOND, rate);
+  if (self->segment.rate < 0.0) {
+    if (resync_time > resync_time_diff)
+      GST_BUFFER_TIMESTAMP (buffer) = resync_time - resync_time_diff;
+    else
+      GST_BUFFER_TIMESTAMP (buffer) = 0;
+    GST_BUFFER_DURATION (buffer) =
+        gst_util_uint64_scale (size / bpf, GST_SECOND, rate);
+
+    self->current_offset += size / bpf;
+  } else {
+    GST_BUFFER_TIMESTAMP (buffer) = resync_time + resync_time_diff;
+    self->current_offset += size / bpf;
+    resync_time_diff =
+        gst_util_uint64_scale (self->current_offset, GST_SECOND, rate);
+    GST_BUFFER_DURATION (buffer) =
+        resync_time_diff - (GST_BUFFER_TIMESTAMP (buffer) - resync_time);
+  }
+
+  GST_BUFFER_OFFSET (buffer) = GST_BUFFER_OFFSET_NONE;
+  GST_BUFFER_OFFSET_END (buffer) = GST_BUFFER_OFFSET_NONE;
+
+  self->accumulated_error =
+      (self->accumulated_error +
+      self->error_per_buffer) % self->output_buffer_duration_d;
+
+  GST_LOG_OBJECT (self,
+      "Outputting buffer at timestamp %" GST_TIME_FORMAT " with duration %"
+      GST_TIME_FORMAT " (%u samples)",
+      GST_TIME_ARGS (GST_BUFFER_TIMESTAMP (buffer)),
+      GST_TIME_ARGS (GST_BUFFER_DURATION (buffer)), (guint) (size / bpf));
+
+  return gst_pad_push (self->srcpad, buffer);
+}
+
 static GstFlowReturn
 gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
     gint rate, gint bpf, guint samples_per_buffer)
 {
   gint size, avail;
   GstFlowReturn ret = GST_FLOW_OK;
-  GstClockTime resync_time;
 
-  resync_time = self->resync_time;
   size = samples_per_buffer * bpf;
 
   /* If we accumulated enough error for one sample, include one
-   * more sample in this buffer. Accumulated error is updated below */
+   * more sample in this buffer. Accumulated error is updated in
+   * gst_audio_buffer_split_output_buffer() */
   if (self->error_per_buffer + self->accumulated_error >=
       self->output_buffer_duration_d)
     size += bpf;
@@ -356,49 +406,11 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
   while ((avail = gst_adapter_available (self->adapter)) >= size || (force
           && avail > 0)) {
     GstBuffer *buffer;
-    GstClockTime resync_time_diff;
 
     size = MIN (size, avail);
     buffer = gst_adapter_take_buffer (self->adapter, size);
 
-    /* After a reset we have to set the discont flag */
-    if (self->current_offset == 0)
-      GST_BUFFER_FLAG_SET (buffer, GST_BUFFER_FLAG_DISCONT);
-
-    resync_time_diff =
-        gst_util_uint64_scale (self->current_offset, GST_SECOND, rate);
-    if (self->segment.rate < 0.0) {
-      if (resync_time > resync_time_diff)
-        GST_BUFFER_TIMESTAMP (buffer) = resync_time - resync_time_diff;
-      else
-        GST_BUFFER_TIMESTAMP (buffer) = 0;
-      GST_BUFFER_DURATION (buffer) =
-          gst_util_uint64_scale (size / bpf, GST_SECOND, rate);
-
-      self->current_offset += size / bpf;
-    } else {
-      GST_BUFFER_TIMESTAMP (buffer) = resync_time + resync_time_diff;
-      self->current_offset += size / bpf;
-      resync_time_diff =
-          gst_util_uint64_scale (self->current_offset, GST_SECOND, rate);
-      GST_BUFFER_DURATION (buffer) =
-          resync_time_diff - (GST_BUFFER_TIMESTAMP (buffer) - resync_time);
-    }
-
-    GST_BUFFER_OFFSET (buffer) = GST_BUFFER_OFFSET_NONE;
-    GST_BUFFER_OFFSET_END (buffer) = GST_BUFFER_OFFSET_NONE;
-
-    self->accumulated_error =
-        (self->accumulated_error +
-        self->error_per_buffer) % self->output_buffer_duration_d;
-
-    GST_LOG_OBJECT (self,
-        "Outputting buffer at timestamp %" GST_TIME_FORMAT " with duration %"
-        GST_TIME_FORMAT " (%u samples)",
-        GST_TIME_ARGS (GST_BUFFER_TIMESTAMP (buffer)),
-        GST_TIME_ARGS (GST_BUFFER_DURATION (buffer)), size / bpf);
-
-    ret = gst_pad_push (self->srcpad, buffer);
+    ret = gst_audio_buffer_split_output_buffer (self, buffer, rate, bpf);
     if (ret != GST_FLOW_OK)
       break;
 
@@ -640,6 +652,32 @@ gst_audio_buffer_split_sink_chain (GstPad * pad, GstObject * parent,
   if (!buffer)
     return GST_FLOW_OK;
 
+  /* Fast path: nothing is pending and the incoming buffer holds an exact
+   * multiple of the output buffer size, so slice it into sub-buffers that
+   * share the input memory instead of copying it all through the adapter */
+  if (self->error_per_buffer == 0 && gst_adapter_available (self->adapter) == 0) {
+    gsize buffer_size = gst_buffer_get_size (buffer);
+    gsize chunk_size = (gsize) samples_per_buffer * bpf;
+
+    if (buffer_size >= chunk_size && buffer_size % chunk_size == 0) {
+      gsize offset;
+
+      ret = GST_FLOW_OK;
+      for (offset = 0; offset < buffer_size; offset += chunk_size) {
+        GstBuffer *chunk =
+            gst_buffer_copy_region (buffer, GST_BUFFER_COPY_MEMORY, offset,
+            chunk_size);
+
+        ret = gst_audio_buffer_split_output_buffer (self, chunk, rate, bpf);
+        if (ret != GST_FLOW_OK)
+          break;
+      }
+      gst_buffer_unref (buffer);
+
+      return ret;
+    }
+  }
+
   gst_adapter_push (self->adapter, buffer);
 
   return gst_audio_buffer_split_output (self, FALSE, rate, bpf,
@@ -49,12 +49,20 @@
  * "average-latency" fields in the GstStructure.
  *
  * The average latency is a running average of the last 5 measurements.
+ *
+ * The "latency" element message additionally contains the "p50-latency",
+ * "p95-latency" and "p99-latency" fields: percentiles in microseconds
+ * computed over a window of the last #GstAudioLatency:samples-window
+ * measurements, and a "samples" field with the number of measurements the
+ * percentiles were computed from.
  */
 
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
 
+#include <stdlib.h>
+
 #include "gstaudiolatency.h"
 
 #define AUDIOLATENCY_CAPS "audio/x-raw, " \
@@ -82,14 +90,17 @@ static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
 G_DEFINE_TYPE (GstAudioLatency, gst_audiolatency, GST_TYPE_BIN);
 
 #define DEFAULT_PRINT_LATENCY   FALSE
+#define DEFAULT_SAMPLES_WINDOW  100
 enum
 {
   PROP_0,
   PROP_PRINT_LATENCY,
   PROP_LAST_LATENCY,
-  PROP_AVERAGE_LATENCY
+  PROP_AVERAGE_LATENCY,
+  PROP_SAMPLES_WINDOW
 };
 
+static void gst_audiolatency_finalize (GObject * object);
 static gint64 gst_audiolatency_get_latency (GstAudioLatency * self);
 static gint64 gst_audiolatency_get_average_latency (GstAudioLatency * self);
 static GstFlowReturn gst_audiolatency_sink_chain (GstPad * pad,
@@ -113,6 +124,9 @@ gst_audiolatency_get_property (GObject * object,
     case PROP_AVERAGE_LATENCY:
       g_value_set_int64 (value, gst_audiolatency_get_average_latency (self));
       break;
+    case PROP_SAMPLES_WINDOW:
+      g_value_set_uint (value, self->samples_window);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -129,6 +143,14 @@ gst_audiolatency_set_property (GObject * object,
     case PROP_PRINT_LATENCY:
       self->print_latency = g_value_get_boolean (value);
       break;
+    case PROP_SAMPLES_WINDOW:
+      GST_OBJECT_LOCK (self);
+      self->samples_window = g_value_get_uint (value);
+      self->window = g_renew (gint64, self->window, self->samples_window);
+      self->window_pos = 0;
+      self->window_filled = 0;
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -143,6 +165,7 @@ gst_audiolatency_class_init (GstAudioLatencyClass * klass)
 
   gobject_class->get_property = gst_audiolatency_get_property;
   gobject_class->set_property = gst_audiolatency_set_property;
+  gobject_class->finalize = gst_audiolatency_finalize;
 
   g_object_class_install_property (gobject_class, PROP_PRINT_LATENCY,
       g_param_spec_boolean ("print-latency", "Print latencies",
@@ -159,6 +182,22 @@ gst_audiolatency_class_init (GstAudioLatencyClass * klass)
           "The running average latency, in microseconds", 0,
           G_USEC_PER_SEC, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioLatency:samples-window:
+   *
+   * The number of measurements the p50/p95/p99 percentiles in the "latency"
+   * element message are computed over. Setting it discards the measurements
+   * collected so far. Measurements arrive once a second, so the default of
+   * 100 covers roughly the last 100 seconds.
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_SAMPLES_WINDOW,
+      g_param_spec_uint ("samples-window", "Samples window",
+          "Number of measurements the latency percentiles are computed over",
+          1, G_MAXUINT16, DEFAULT_SAMPLES_WINDOW,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_static_pad_template (gstelement_class, &src_template);
   gst_element_class_add_static_pad_template (gstelement_class, &sink_template);
 
@@ -177,6 +216,10 @@ gst_audiolatency_init (GstAudioLatency * self)
   self->send_pts = 0;
   self->recv_pts = 0;
   self->print_latency = DEFAULT_PRINT_LATENCY;
+  self->samples_window = DEFAULT_SAMPLES_WINDOW;
+  self->window = g_new0 (gint64, self->samples_window);
+  self->window_pos = 0;
+  self->window_filled = 0;
 
   /* Setup sinkpad */
   self->sinkpad = gst_pad_new_from_static_template (&sink_template, "sink");
@@ -202,6 +245,17 @@ gst_audiolatency_init (GstAudioLatency * self)
   GST_LOG_OBJECT (self, "Initialized audiolatency");
 }
 
+static void
+gst_audiolatency_finalize (GObject * object)
+{
+  GstAudioLatency *self = GST_AUDIOLATENCY (object);
+
+  g_free (self->window);
+  self->window = NULL;
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 static gint64
 gst_audiolatency_get_latency (GstAudioLatency * self)
 {
@@ -247,10 +301,30 @@ gst_audiolatency_get_average_latency (GstAudioLatency * self)
   return average;
 }
 
+static gint
+compare_latencies (gconstpointer a, gconstpointer b)
+{
+  gint64 la = *(const gint64 *) a;
+  gint64 lb = *(const gint64 *) b;
+
+  return (la > lb) - (la < lb);
+}
+
+/* Nearest-rank percentile of a sorted array of @n measurements */
+static gint64
+get_percentile (const gint64 * sorted, guint n, guint percentile)
+{
+  guint rank = (n * percentile + 99) / 100;
+
+  return sorted[rank > 0 ? rank - 1 : 0];
+}
+
 static void
 gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
 {
-  gint64 avg_latency;
+  gint64 avg_latency, p50, p95, p99;
+  gint64 *sorted;
+  guint n;
 
   GST_OBJECT_LOCK (self);
   self->latencies[self->next_latency_idx] = latency;
@@ -262,6 +336,22 @@ gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
 
   avg_latency = gst_audiolatency_get_average_latency_unlocked (self);
 
+  /* Store the measurement in the percentile window too. A new measurement
+   * arrives at most once a second, so sorting a copy of the window here is
+   * nowhere near a bottleneck. */
+  self->window[self->window_pos] = latency;
+  self->window_pos = (self->window_pos + 1) % self->samples_window;
+  if (self->window_filled < self->samples_window)
+    self->window_filled += 1;
+
+  n = self->window_filled;
+  sorted = g_memdup (self->window, n * sizeof (gint64));
+  qsort (sorted, n, sizeof (gint64), compare_latencies);
+  p50 = get_percentile (sorted, n, 50);
+  p95 = get_percentile (sorted, n, 95);
+  p99 = get_percentile (sorted, n, 99);
+  g_free (sorted);
+
   if (self->print_latency)
     g_print ("last latency: %" G_GINT64_FORMAT "ms, running average: %"
         G_GINT64_FORMAT "ms\n", latency / 1000, avg_latency / 1000);
@@ -271,7 +361,11 @@ gst_audiolatency_set_latency (GstAudioLatency * self, gint64 latency)
   gst_element_post_message (GST_ELEMENT (self),
       gst_message_new_element (GST_OBJECT (self),
           gst_structure_new ("latency", "last-latency", G_TYPE_INT64, latency,
-              "average-latency", G_TYPE_INT64, avg_latency, NULL)));
+              "average-latency", G_TYPE_INT64, avg_latency,
+              "p50-latency", G_TYPE_INT64, p50,
+              "p95-latency", G_TYPE_INT64, p95,
+              "p99-latency", G_TYPE_INT64, p99,
+              "samples", G_TYPE_UINT, n, NULL)));
 }
 
 static gint64
@@ -53,9 +53,14 @@ struct _GstAudioLatency
   gint64 recv_pts;
   gint next_latency_idx;
   gint latencies[GST_AUDIOLATENCY_NUM_LATENCIES];
+  /* ring of the last samples-window measurements, for the percentiles */
+  gint64 *window;
+  guint window_pos;
+  guint window_filled;
 
   /* properties */
   gboolean print_latency;
+  guint samples_window;
 };
 
 struct _GstAudioLatencyClass
@@ -227,6 +227,8 @@ gst_audio_mix_matrix_init (GstAudioMixMatrix * self)
   self->channel_mask = 0;
   self->s16_conv_matrix = NULL;
   self->s32_conv_matrix = NULL;
+  self->nonzero_count = NULL;
+  self->nonzero_in = NULL;
   self->mode = GST_AUDIO_MIX_MATRIX_MODE_MANUAL;
 }
 
@@ -240,6 +242,16 @@ gst_audio_mix_matrix_dispose (GObject * object)
     self->matrix = NULL;
   }
 
+  if (self->nonzero_count) {
+    g_free (self->nonzero_count);
+    self->nonzero_count = NULL;
+  }
+
+  if (self->nonzero_in) {
+    g_free (self->nonzero_in);
+    self->nonzero_in = NULL;
+  }
+
   G_OBJECT_CLASS (gst_audio_mix_matrix_parent_class)->dispose (object);
 }
 
@@ -279,6 +291,33 @@ gst_audio_mix_matrix_convert_s32_matrix (GstAudioMixMatrix * self)
   }
 }
 
+static void
+gst_audio_mix_matrix_update_nonzero (GstAudioMixMatrix * self)
+{
+  gint in, out;
+
+  /* Collect, for every output channel, the input channels with a non-zero
+   * coefficient. Large routing matrices are mostly zeros and the transform
+   * loop then only visits the terms that contribute to the output sample. */
+  if (self->nonzero_count)
+    g_free (self->nonzero_count);
+  if (self->nonzero_in)
+    g_free (self->nonzero_in);
+  self->nonzero_count = g_new (guint, self->out_channels);
+  self->nonzero_in = g_new (guint, self->in_channels * self->out_channels);
+
+  for (out = 0; out < self->out_channels; out++) {
+    guint *idx = self->nonzero_in + out * self->in_channels;
+    guint n = 0;
+
+    for (in = 0; in < self->in_channels; in++) {
+      if (self->matrix[out * self->in_channels + in] != 0.0)
+        idx[n++] = in;
+    }
+    self->nonzero_count[out] = n;
+  }
+}
+
 
 static void
 gst_audio_mix_matrix_set_property (GObject * object, guint prop_id,
@@ -292,6 +331,7 @@ gst_audio_mix_matrix_set_property (GObject * object, guint prop_id,
       if (self->matrix) {
         gst_audio_mix_matrix_convert_s16_matrix (self);
         gst_audio_mix_matrix_convert_s32_matrix (self);
+        gst_audio_mix_matrix_update_nonzero (self);
       }
       break;
     case PROP_OUT_CHANNELS:
@@ -299,6 +339,7 @@ gst_audio_mix_matrix_set_property (GObject * object, guint prop_id,
       if (self->matrix) {
         gst_audio_mix_matrix_convert_s16_matrix (self);
         gst_audio_mix_matrix_convert_s32_matrix (self);
+        gst_audio_mix_matrix_update_nonzero (self);
       }
       break;
     case PROP_MATRIX:{
@@ -324,6 +365,7 @@ gst_audio_mix_matrix_set_property (GObject * object, guint prop_id,
       }
       gst_audio_mix_matrix_convert_s16_matrix (self);
       gst_audio_mix_matrix_convert_s32_matrix (self);
+      gst_audio_mix_matrix_update_nonzero (self);
       break;
     }
     case PROP_CHANNEL_MASK:
@@ -404,6 +446,16 @@ gst_audio_mix_matrix_change_state (GstElement * element,
       g_free (self->s32_conv_matrix);
       self->s32_conv_matrix = NULL;
     }
+
+    if (self->nonzero_count) {
+      g_free (self->nonzero_count);
+      self->nonzero_count = NULL;
+    }
+
+    if (self->nonzero_in) {
+      g_free (self->nonzero_in);
+      self->nonzero_in = NULL;
+    }
   }
 
   return s;
@@ -420,6 +472,8 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
   guint inchannels = self->in_channels;
   guint outchannels = self->out_channels;
   gdouble *matrix = self->matrix;
+  const guint *nonzero_count = self->nonzero_count;
+  const guint *nonzero_in = self->nonzero_in;
 
   if (!gst_buffer_map (inbuf, &inmap, GST_MAP_READ)) {
     return GST_FLOW_ERROR;
@@ -441,11 +495,12 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
 
       for (sample = 0; sample < n_samples; sample++) {
         for (out = 0; out < outchannels; out++) {
+          const guint *idx = nonzero_in + out * inchannels;
+          guint nz = nonzero_count[out];
           gfloat outval = 0;
-          for (in = 0; in < inchannels; in++) {
-            outval +=
-                inarray[sample * inchannels +
-                in] * matrix[out * inchannels + in];
+          for (in = 0; in < nz; in++) {
+            outval += inarray[sample * inchannels + idx[in]]
+                * matrix[out * inchannels + idx[in]];
           }
           outarray[sample * outchannels + out] = outval;
         }
@@ -463,11 +518,12 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
 
       for (sample = 0; sample < n_samples; sample++) {
         for (out = 0; out < outchannels; out++) {
+          const guint *idx = nonzero_in + out * inchannels;
+          guint nz = nonzero_count[out];
           gdouble outval = 0;
-          for (in = 0; in < inchannels; in++) {
-            outval +=
-                inarray[sample * inchannels +
-                in] * matrix[out * inchannels + in];
+          for (in = 0; in < nz; in++) {
+            outval += inarray[sample * inchannels + idx[in]]
+                * matrix[out * inchannels + idx[in]];
           }
           outarray[sample * outchannels + out] = outval;
         }
@@ -487,10 +543,12 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
 
       for (sample = 0; sample < n_samples; sample++) {
         for (out = 0; out < outchannels; out++) {
+          const guint *idx = nonzero_in + out * inchannels;
+          guint nz = nonzero_count[out];
           gint32 outval = 0;
-          for (in = 0; in < inchannels; in++) {
-            outval += (gint32) (inarray[sample * inchannels + in] *
-                conv_matrix[out * inchannels + in]);
+          for (in = 0; in < nz; in++) {
+            outval += (gint32) (inarray[sample * inchannels + idx[in]] *
+                conv_matrix[out * inchannels + idx[in]]);
           }
           outarray[sample * outchannels + out] = (gint16) (outval >> n);
         }
@@ -510,10 +568,12 @@ gst_audio_mix_matrix_transform (GstBaseTransform * vfilter,
 
       for (sample = 0; sample < n_samples; sample++) {
         for (out = 0; out < outchannels; out++) {
+          const guint *idx = nonzero_in + out * inchannels;
+          guint nz = nonzero_count[out];
           gint64 outval = 0;
-          for (in = 0; in < inchannels; in++) {
-            outval += (gint64) (inarray[sample * inchannels + in] *
-                conv_matrix[out * inchannels + in]);
+          for (in = 0; in < nz; in++) {
+            outval += (gint64) (inarray[sample * inchannels + idx[in]] *
+                conv_matrix[out * inchannels + idx[in]]);
           }
           outarray[sample * outchannels + out] = (gint32) (outval >> n);
         }
@@ -582,6 +642,8 @@ gst_audio_mix_matrix_set_caps (GstBaseTransform * trans, GstCaps * incaps,
     return FALSE;
   }
 
+  gst_audio_mix_matrix_update_nonzero (self);
+
   switch (self->format) {
     case GST_AUDIO_FORMAT_S16LE:
     case GST_AUDIO_FORMAT_S16BE:{
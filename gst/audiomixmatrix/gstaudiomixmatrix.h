@@ -62,6 +62,11 @@ struct _GstAudioMixMatrix
   gint64 *s32_conv_matrix;
   gint shift_bytes;
 
+  /* per output channel, the input channels with a non-zero coefficient,
+   * so that sparse routing matrices skip the zero terms while mixing */
+  guint *nonzero_count;
+  guint *nonzero_in;
+
   GstAudioFormat format;
 };
 
@@ -0,0 +1,105 @@
+/* GStreamer
+ * Copyright (C) <2011> Stefan Sauer <ensonic@users.sf.net>
+ *
+ * gstfftpool.c: shared fft context pool for the scope elements
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/*
+ * Setting up a GstFFTS16 computes the twiddle tables for the transform
+ * length, which is not free when many scope instances negotiate the same
+ * video size (think a wall of synaescope/spectrascope instances, all
+ * 2 * height - 2 or 2 * width - 2 samples per frame). Instead of freeing a
+ * context on renegotiation or teardown we park it here and hand it out
+ * again to the next scope that asks for the same length.
+ *
+ * A context is owned exclusively by one scope while checked out; GstFFTS16
+ * keeps per-transform scratch state, so a single context must never be
+ * shared between streaming threads. Only forward transforms are pooled,
+ * that is all the scopes ever use.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstfftpool.h"
+
+typedef struct
+{
+  GstFFTS16 *ctx;
+  gint len;
+} GstScopeFFTEntry;
+
+/* enough for a handful of distinct video sizes; beyond that we just
+ * fall back to allocating */
+#define GST_SCOPE_FFT_POOL_MAX 16
+
+static GMutex pool_lock;
+static GSList *pool = NULL;
+static guint pool_size = 0;
+
+/* get a forward fft context for @len samples, reusing a parked one if a
+ * scope of the same size released it before */
+GstFFTS16 *
+gst_scope_fft_acquire (gint len)
+{
+  GstFFTS16 *ctx = NULL;
+  GSList *node;
+
+  g_mutex_lock (&pool_lock);
+  for (node = pool; node; node = g_slist_next (node)) {
+    GstScopeFFTEntry *entry = node->data;
+
+    if (entry->len == len) {
+      ctx = entry->ctx;
+      pool = g_slist_delete_link (pool, node);
+      pool_size--;
+      g_slice_free (GstScopeFFTEntry, entry);
+      break;
+    }
+  }
+  g_mutex_unlock (&pool_lock);
+
+  if (!ctx)
+    ctx = gst_fft_s16_new (len, FALSE);
+
+  return ctx;
+}
+
+/* give a context obtained from gst_scope_fft_acquire() back to the pool;
+ * @len must be the length it was acquired for */
+void
+gst_scope_fft_release (GstFFTS16 * ctx, gint len)
+{
+  GstScopeFFTEntry *entry;
+
+  if (!ctx)
+    return;
+
+  g_mutex_lock (&pool_lock);
+  if (pool_size < GST_SCOPE_FFT_POOL_MAX) {
+    entry = g_slice_new (GstScopeFFTEntry);
+    entry->ctx = ctx;
+    entry->len = len;
+    pool = g_slist_prepend (pool, entry);
+    pool_size++;
+    ctx = NULL;
+  }
+  g_mutex_unlock (&pool_lock);
+
+  if (ctx)
+    gst_fft_s16_free (ctx);
+}
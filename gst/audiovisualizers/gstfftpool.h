@@ -0,0 +1,33 @@
+/* GStreamer
+ * Copyright (C) <2011> Stefan Sauer <ensonic@users.sf.net>
+ *
+ * gstfftpool.h: shared fft context pool for the scope elements
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_FFT_POOL_H__
+#define __GST_FFT_POOL_H__
+
+#include <gst/fft/gstffts16.h>
+
+G_BEGIN_DECLS
+
+GstFFTS16 *gst_scope_fft_acquire (gint len);
+void gst_scope_fft_release (GstFFTS16 * ctx, gint len);
+
+G_END_DECLS
+#endif /* __GST_FFT_POOL_H__ */
@@ -37,8 +37,10 @@
 #include "config.h"
 #endif
 #include <stdlib.h>
+#include <string.h>
 
 #include "gstspectrascope.h"
+#include "gstfftpool.h"
 
 #if G_BYTE_ORDER == G_BIG_ENDIAN
 #define RGB_ORDER "xRGB"
@@ -111,13 +113,17 @@ gst_spectra_scope_finalize (GObject * object)
   GstSpectraScope *scope = GST_SPECTRA_SCOPE (object);
 
   if (scope->fft_ctx) {
-    gst_fft_s16_free (scope->fft_ctx);
+    gst_scope_fft_release (scope->fft_ctx, GST_AUDIO_VISUALIZER (scope)->req_spf);
     scope->fft_ctx = NULL;
   }
   if (scope->freq_data) {
     g_free (scope->freq_data);
     scope->freq_data = NULL;
   }
+  if (scope->mono_adata) {
+    g_free (scope->mono_adata);
+    scope->mono_adata = NULL;
+  }
 
   G_OBJECT_CLASS (gst_spectra_scope_parent_class)->finalize (object);
 }
@@ -127,15 +133,18 @@ gst_spectra_scope_setup (GstAudioVisualizer * bscope)
 {
   GstSpectraScope *scope = GST_SPECTRA_SCOPE (bscope);
   guint num_freq = GST_VIDEO_INFO_WIDTH (&bscope->vinfo) + 1;
+  guint spf = num_freq * 2 - 2;
 
-  if (scope->fft_ctx)
-    gst_fft_s16_free (scope->fft_ctx);
-  g_free (scope->freq_data);
+  /* we'd need this amount of samples per render() call; keep the fft
+   * context across renegotiations that don't change the transform size */
+  if (!scope->fft_ctx || bscope->req_spf != spf) {
+    gst_scope_fft_release (scope->fft_ctx, bscope->req_spf);
+    g_free (scope->freq_data);
 
-  /* we'd need this amount of samples per render() call */
-  bscope->req_spf = num_freq * 2 - 2;
-  scope->fft_ctx = gst_fft_s16_new (bscope->req_spf, FALSE);
-  scope->freq_data = g_new (GstFFTS16Complex, num_freq);
+    scope->fft_ctx = gst_scope_fft_acquire (spf);
+    scope->freq_data = g_new (GstFFTS16Complex, num_freq);
+  }
+  bscope->req_spf = spf;
 
   return TRUE;
 }
@@ -184,7 +193,14 @@ gst_spectra_scope_render (GstAudioVisualizer * bscope, GstBuffer * audio,
 
   channels = GST_AUDIO_INFO_CHANNELS (&bscope->ainfo);
 
-  mono_adata = (gint16 *) g_memdup (amap.data, amap.size);
+  /* reuse the scratch buffer across frames, the in-place FFT would
+   * otherwise force an allocation and copy per rendered frame */
+  if (scope->mono_adata_size < amap.size) {
+    scope->mono_adata = g_realloc (scope->mono_adata, amap.size);
+    scope->mono_adata_size = amap.size;
+  }
+  mono_adata = scope->mono_adata;
+  memcpy (mono_adata, amap.data, amap.size);
 
   if (channels > 1) {
     guint ch = channels;
@@ -204,7 +220,6 @@ gst_spectra_scope_render (GstAudioVisualizer * bscope, GstBuffer * audio,
   /* run fft */
   gst_fft_s16_window (scope->fft_ctx, mono_adata, GST_FFT_WINDOW_HAMMING);
   gst_fft_s16_fft (scope->fft_ctx, mono_adata, fdata);
-  g_free (mono_adata);
 
   /* draw lines */
   for (x = 0; x < w; x++) {
@@ -40,6 +40,10 @@ struct _GstSpectraScope
 
   GstFFTS16 *fft_ctx;
   GstFFTS16Complex *freq_data;
+
+  /* scratch copy of the audio data for mixdown and windowing */
+  gint16 *mono_adata;
+  gsize mono_adata_size;
 };
 
 struct _GstSpectraScopeClass
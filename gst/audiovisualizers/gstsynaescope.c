@@ -37,6 +37,7 @@
 #endif
 
 #include "gstsynaescope.h"
+#include "gstfftpool.h"
 
 #if G_BYTE_ORDER == G_BIG_ENDIAN
 #define RGB_ORDER "xRGB"
@@ -128,7 +129,7 @@ gst_synae_scope_finalize (GObject * object)
   GstSynaeScope *scope = GST_SYNAE_SCOPE (object);
 
   if (scope->fft_ctx) {
-    gst_fft_s16_free (scope->fft_ctx);
+    gst_scope_fft_release (scope->fft_ctx, GST_AUDIO_VISUALIZER (scope)->req_spf);
     scope->fft_ctx = NULL;
   }
   if (scope->freq_data_l) {
@@ -156,24 +157,27 @@ gst_synae_scope_setup (GstAudioVisualizer * bscope)
 {
   GstSynaeScope *scope = GST_SYNAE_SCOPE (bscope);
   guint num_freq = GST_VIDEO_INFO_HEIGHT (&bscope->vinfo) + 1;
-
-  if (scope->fft_ctx)
-    gst_fft_s16_free (scope->fft_ctx);
-  g_free (scope->freq_data_l);
-  g_free (scope->freq_data_r);
-  g_free (scope->adata_l);
-  g_free (scope->adata_r);
+  guint spf = num_freq * 2 - 2;
 
   /* FIXME: we could have horizontal or vertical layout */
 
-  /* we'd need this amount of samples per render() call */
-  bscope->req_spf = num_freq * 2 - 2;
-  scope->fft_ctx = gst_fft_s16_new (bscope->req_spf, FALSE);
-  scope->freq_data_l = g_new (GstFFTS16Complex, num_freq);
-  scope->freq_data_r = g_new (GstFFTS16Complex, num_freq);
+  /* we'd need this amount of samples per render() call; keep the fft
+   * context across renegotiations that don't change the transform size */
+  if (!scope->fft_ctx || bscope->req_spf != spf) {
+    gst_scope_fft_release (scope->fft_ctx, bscope->req_spf);
+    g_free (scope->freq_data_l);
+    g_free (scope->freq_data_r);
+    g_free (scope->adata_l);
+    g_free (scope->adata_r);
+
+    scope->fft_ctx = gst_scope_fft_acquire (spf);
+    scope->freq_data_l = g_new (GstFFTS16Complex, num_freq);
+    scope->freq_data_r = g_new (GstFFTS16Complex, num_freq);
 
-  scope->adata_l = g_new (gint16, bscope->req_spf);
-  scope->adata_r = g_new (gint16, bscope->req_spf);
+    scope->adata_l = g_new (gint16, spf);
+    scope->adata_r = g_new (gint16, spf);
+  }
+  bscope->req_spf = spf;
 
   return TRUE;
 }
@@ -123,6 +123,8 @@ struct _GstBayer2RGB
   int g_off;                    /* offset for green */
   int b_off;                    /* offset for blue */
   int format;
+  int bpp;                      /* bits per bayer sample, 8 or 16 */
+  gboolean bigendian;           /* sample byte order when bpp == 16 */
 };
 
 struct _GstBayer2RGBClass
@@ -133,7 +135,9 @@ struct _GstBayer2RGBClass
 #define	SRC_CAPS                                 \
   GST_VIDEO_CAPS_MAKE ("{ RGBx, xRGB, BGRx, xBGR, RGBA, ARGB, BGRA, ABGR }")
 
-#define SINK_CAPS "video/x-bayer,format=(string){bggr,grbg,gbrg,rggb}," \
+#define SINK_CAPS "video/x-bayer,format=(string){bggr,grbg,gbrg,rggb," \
+  "bggr16le,grbg16le,gbrg16le,rggb16le," \
+  "bggr16be,grbg16be,gbrg16be,rggb16be}," \
   "width=(int)[1,MAX],height=(int)[1,MAX],framerate=(fraction)[0/1,MAX]"
 
 enum
@@ -249,18 +253,31 @@ gst_bayer2rgb_set_caps (GstBaseTransform * base, GstCaps * incaps,
   gst_structure_get_int (structure, "height", &bayer2rgb->height);
 
   format = gst_structure_get_string (structure, "format");
-  if (g_str_equal (format, "bggr")) {
+  if (g_str_has_prefix (format, "bggr")) {
     bayer2rgb->format = GST_BAYER_2_RGB_FORMAT_BGGR;
-  } else if (g_str_equal (format, "gbrg")) {
+  } else if (g_str_has_prefix (format, "gbrg")) {
     bayer2rgb->format = GST_BAYER_2_RGB_FORMAT_GBRG;
-  } else if (g_str_equal (format, "grbg")) {
+  } else if (g_str_has_prefix (format, "grbg")) {
     bayer2rgb->format = GST_BAYER_2_RGB_FORMAT_GRBG;
-  } else if (g_str_equal (format, "rggb")) {
+  } else if (g_str_has_prefix (format, "rggb")) {
     bayer2rgb->format = GST_BAYER_2_RGB_FORMAT_RGGB;
   } else {
     return FALSE;
   }
 
+  if (format[4] == '\0') {
+    bayer2rgb->bpp = 8;
+    bayer2rgb->bigendian = FALSE;
+  } else if (g_str_equal (format + 4, "16le")) {
+    bayer2rgb->bpp = 16;
+    bayer2rgb->bigendian = FALSE;
+  } else if (g_str_equal (format + 4, "16be")) {
+    bayer2rgb->bpp = 16;
+    bayer2rgb->bigendian = TRUE;
+  } else {
+    return FALSE;
+  }
+
   /* To cater for different RGB formats, we need to set params for later */
   gst_video_info_from_caps (&info, outcaps);
   bayer2rgb->r_off = GST_VIDEO_INFO_COMP_OFFSET (&info, 0);
@@ -280,6 +297,8 @@ gst_bayer2rgb_reset (GstBayer2RGB * filter)
   filter->r_off = 0;
   filter->g_off = 0;
   filter->b_off = 0;
+  filter->bpp = 8;
+  filter->bigendian = FALSE;
   gst_video_info_init (&filter->info);
 }
 
@@ -334,7 +353,13 @@ gst_bayer2rgb_get_unit_size (GstBaseTransform * base, GstCaps * caps,
     name = gst_structure_get_name (structure);
     /* Our name must be either video/x-bayer video/x-raw */
     if (strcmp (name, "video/x-raw")) {
-      *size = GST_ROUND_UP_4 (width) * height;
+      const char *format = gst_structure_get_string (structure, "format");
+
+      /* 16-bit variants carry two bytes per sample */
+      if (format != NULL && strstr (format, "16") != NULL)
+        *size = GST_ROUND_UP_4 (width * 2) * height;
+      else
+        *size = GST_ROUND_UP_4 (width) * height;
       return TRUE;
     } else {
       /* For output, calculate according to format (always 32 bits) */
@@ -447,8 +472,102 @@ gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
   g_free (tmp);
 }
 
+/* 16-bit path: plain C bilinear demosaic.  The ORC kernels above are
+ * byte-oriented and there is no practical way to express the widened
+ * arithmetic with the current kernel set, so high bit depth frames are
+ * interpolated here and rendered into the negotiated 8-bit RGB output
+ * by keeping the most significant byte of each sample. */
 
+static inline guint
+gst_bayer2rgb_read_u16 (const guint8 * p, gboolean bigendian)
+{
+  return bigendian ? GST_READ_UINT16_BE (p) : GST_READ_UINT16_LE (p);
+}
 
+static void
+gst_bayer2rgb_process_16 (GstBayer2RGB * bayer2rgb, guint8 * dest,
+    int dest_stride, const guint8 * src, int src_stride)
+{
+  const int width = bayer2rgb->width;
+  const int height = bayer2rgb->height;
+  const gboolean be = bayer2rgb->bigendian;
+  const int r_off = bayer2rgb->r_off;
+  const int g_off = bayer2rgb->g_off;
+  const int b_off = bayer2rgb->b_off;
+  /* the four byte offsets sum to 6, whichever is left over is alpha */
+  const int a_off = 6 - r_off - g_off - b_off;
+  int red_y, red_x;
+  int j, x;
+
+  /* row/column parity of the red samples for each arrangement */
+  red_y = (bayer2rgb->format == GST_BAYER_2_RGB_FORMAT_BGGR ||
+      bayer2rgb->format == GST_BAYER_2_RGB_FORMAT_GBRG) ? 1 : 0;
+  red_x = (bayer2rgb->format == GST_BAYER_2_RGB_FORMAT_BGGR ||
+      bayer2rgb->format == GST_BAYER_2_RGB_FORMAT_GRBG) ? 1 : 0;
+
+  for (j = 0; j < height; j++) {
+    /* mirror the frame edges by one sample so neighbours keep the
+     * parity, and thus the color, the interpolation expects */
+    const guint8 *cur = src + j * src_stride;
+    const guint8 *up = (j > 0) ? cur - src_stride : cur + src_stride;
+    const guint8 *down = (j < height - 1) ? cur + src_stride : cur - src_stride;
+    guint8 *d = dest + j * dest_stride;
+
+    for (x = 0; x < width; x++, d += 4) {
+      int l = 2 * ((x > 0) ? x - 1 : x + 1);
+      int r = 2 * ((x < width - 1) ? x + 1 : x - 1);
+      int c = 2 * x;
+      guint rv, gv, bv;
+
+      if (((j ^ red_y) & 1) == 0) {
+        if (((x ^ red_x) & 1) == 0) {
+          /* red sample */
+          rv = gst_bayer2rgb_read_u16 (cur + c, be);
+          gv = (gst_bayer2rgb_read_u16 (cur + l, be) +
+              gst_bayer2rgb_read_u16 (cur + r, be) +
+              gst_bayer2rgb_read_u16 (up + c, be) +
+              gst_bayer2rgb_read_u16 (down + c, be) + 2) >> 2;
+          bv = (gst_bayer2rgb_read_u16 (up + l, be) +
+              gst_bayer2rgb_read_u16 (up + r, be) +
+              gst_bayer2rgb_read_u16 (down + l, be) +
+              gst_bayer2rgb_read_u16 (down + r, be) + 2) >> 2;
+        } else {
+          /* green sample in a red row */
+          gv = gst_bayer2rgb_read_u16 (cur + c, be);
+          rv = (gst_bayer2rgb_read_u16 (cur + l, be) +
+              gst_bayer2rgb_read_u16 (cur + r, be) + 1) >> 1;
+          bv = (gst_bayer2rgb_read_u16 (up + c, be) +
+              gst_bayer2rgb_read_u16 (down + c, be) + 1) >> 1;
+        }
+      } else {
+        if (((x ^ red_x) & 1) == 0) {
+          /* green sample in a blue row */
+          gv = gst_bayer2rgb_read_u16 (cur + c, be);
+          bv = (gst_bayer2rgb_read_u16 (cur + l, be) +
+              gst_bayer2rgb_read_u16 (cur + r, be) + 1) >> 1;
+          rv = (gst_bayer2rgb_read_u16 (up + c, be) +
+              gst_bayer2rgb_read_u16 (down + c, be) + 1) >> 1;
+        } else {
+          /* blue sample */
+          bv = gst_bayer2rgb_read_u16 (cur + c, be);
+          gv = (gst_bayer2rgb_read_u16 (cur + l, be) +
+              gst_bayer2rgb_read_u16 (cur + r, be) +
+              gst_bayer2rgb_read_u16 (up + c, be) +
+              gst_bayer2rgb_read_u16 (down + c, be) + 2) >> 2;
+          rv = (gst_bayer2rgb_read_u16 (up + l, be) +
+              gst_bayer2rgb_read_u16 (up + r, be) +
+              gst_bayer2rgb_read_u16 (down + l, be) +
+              gst_bayer2rgb_read_u16 (down + r, be) + 2) >> 2;
+        }
+      }
+
+      d[r_off] = rv >> 8;
+      d[g_off] = gv >> 8;
+      d[b_off] = bv >> 8;
+      d[a_off] = 0xff;
+    }
+  }
+}
 
 static GstFlowReturn
 gst_bayer2rgb_transform (GstBaseTransform * base, GstBuffer * inbuf,
@@ -470,8 +589,12 @@ gst_bayer2rgb_transform (GstBaseTransform * base, GstBuffer * inbuf,
   }
 
   output = GST_VIDEO_FRAME_PLANE_DATA (&frame, 0);
-  gst_bayer2rgb_process (filter, output, frame.info.stride[0],
-      map.data, GST_ROUND_UP_4 (filter->width));
+  if (filter->bpp == 16)
+    gst_bayer2rgb_process_16 (filter, output, frame.info.stride[0],
+        map.data, GST_ROUND_UP_4 (filter->width * 2));
+  else
+    gst_bayer2rgb_process (filter, output, frame.info.stride[0],
+        map.data, GST_ROUND_UP_4 (filter->width));
 
   gst_video_frame_unmap (&frame);
   gst_buffer_unmap (inbuf, &map);
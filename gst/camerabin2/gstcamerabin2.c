@@ -373,6 +373,12 @@ gst_camera_bin_start_capture (GstCameraBin2 * camerabin)
     camerabin->image_location_list =
         g_slist_append (camerabin->image_location_list, g_strdup (location));
     g_mutex_unlock (&camerabin->image_capture_mutex);
+
+    /* Advance the index here instead of from the ready-for-capture notify:
+     * captures queued while the source is still busy with the previous one
+     * never toggle ready-for-capture, but each of them gets its own
+     * location from the list above */
+    camerabin->capture_index++;
   }
 
   if (camerabin->post_previews) {
@@ -487,9 +493,9 @@ gst_camera_bin_src_notify_readyforcapture (GObject * obj, GParamSpec * pspec,
          * and could cause problems in a camerabin2 state change */
         gst_element_set_state (camera->videosink, GST_STATE_NULL);
       }
-    }
 
-    camera->capture_index++;
+      camera->capture_index++;
+    }
   }
 }
 
@@ -1034,6 +1034,27 @@ gst_wrapper_camera_bin_src_start_capture (GstBaseCameraSrc * camerasrc)
   return ret;
 }
 
+static gboolean
+gst_wrapper_camera_bin_src_queue_capture (GstBaseCameraSrc * camerasrc)
+{
+  GstWrapperCameraBinSrc *src = GST_WRAPPER_CAMERA_BIN_SRC (camerasrc);
+
+  /* Video recordings are ended with stop-capture, so piling up extra
+   * starts makes no sense for them */
+  if (src->mode != MODE_IMAGE)
+    return FALSE;
+
+  /* The source is already linked to imgsrc and negotiated to the capture
+   * caps (or about to be, if the idle probe hasn't run yet), so a burst
+   * capture only needs the imgsrc probe to let one more buffer through
+   * before it switches back to the viewfinder. Called with the
+   * capturing_mutex held, like the probe. */
+  src->image_capture_count++;
+  GST_DEBUG_OBJECT (src, "Queueing image capture, %d now pending",
+      src->image_capture_count);
+  return TRUE;
+}
+
 static void
 gst_wrapper_camera_bin_src_stop_capture (GstBaseCameraSrc * camerasrc)
 {
@@ -1120,6 +1141,8 @@ gst_wrapper_camera_bin_src_class_init (GstWrapperCameraBinSrcClass * klass)
       gst_wrapper_camera_bin_src_start_capture;
   gstbasecamerasrc_class->stop_capture =
       gst_wrapper_camera_bin_src_stop_capture;
+  gstbasecamerasrc_class->queue_capture =
+      gst_wrapper_camera_bin_src_queue_capture;
 
   GST_DEBUG_CATEGORY_INIT (wrapper_camera_bin_src_debug, "wrappercamerabinsrc",
       0, "wrapper camera src");
@@ -21,6 +21,7 @@
 #  include "config.h"
 #endif
 
+#define GST_USE_UNSTABLE_API
 #include <gst/gst.h>
 
 GType gst_checksum_sink_get_type (void);
@@ -32,6 +33,7 @@ GType gst_error_ignore_get_type (void);
 GType gst_watchdog_get_type (void);
 GType gst_fake_video_sink_get_type (void);
 GType gst_test_src_bin_get_type (void);
+GType gst_proctime_tracer_get_type (void);
 
 static gboolean
 plugin_init (GstPlugin * plugin)
@@ -55,6 +57,8 @@ plugin_init (GstPlugin * plugin)
   gst_element_register (plugin, "testsrcbin", GST_RANK_NONE,
       gst_test_src_bin_get_type ());
 
+  gst_tracer_register (plugin, "proctime", gst_proctime_tracer_get_type ());
+
   return TRUE;
 }
 
@@ -0,0 +1,225 @@
+/* GStreamer
+ * Copyright (C) 2019 GStreamer developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * SECTION:tracer-proctime
+ * @title: proctime
+ *
+ * Logs the time each element spends processing a buffer, measured from
+ * the moment data is pushed into the element's sink pad to the moment
+ * the element pushes its next output. Unlike the core latency tracer
+ * this excludes time spent downstream, so it attributes cycles to the
+ * element that actually burned them.
+ *
+ * Enable for all elements with:
+ * |[
+ * GST_TRACERS="proctime" GST_DEBUG="GST_TRACER:7" gst-launch-1.0 ...
+ * ]|
+ * or restrict it to specific element names, separated by semicolons:
+ * |[
+ * GST_TRACERS="proctime(h264parse0;tsdemux0)" ...
+ * ]|
+ *
+ * The measurement only makes sense for elements that process data on
+ * the streaming thread that feeds their sink pad; for elements with
+ * their own streaming threads (queues, demuxers with task pads) the
+ * reported span includes the queueing time.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#define GST_USE_UNSTABLE_API
+#include "gstproctimetracer.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_proctime_tracer_debug);
+#define GST_CAT_DEFAULT gst_proctime_tracer_debug
+
+#define _do_init \
+    GST_DEBUG_CATEGORY_INIT (gst_proctime_tracer_debug, "proctime", 0, \
+        "processing time tracer");
+#define gst_proctime_tracer_parent_class parent_class
+G_DEFINE_TYPE_WITH_CODE (GstProctimeTracer, gst_proctime_tracer,
+    GST_TYPE_TRACER, _do_init);
+
+static GstTracerRecord *tr_proctime;
+
+/* qdata on the element holding the time data last entered its sink pad,
+ * GST_CLOCK_TIME_NONE once the span has been logged */
+static GQuark entry_time_quark;
+
+static GstElement *
+get_real_pad_parent (GstPad * pad)
+{
+  GstObject *parent;
+
+  if (!pad)
+    return NULL;
+
+  parent = GST_OBJECT_PARENT (pad);
+
+  /* if parent of pad is a ghost-pad, then pad is a proxy_pad */
+  if (parent && GST_IS_GHOST_PAD (parent)) {
+    pad = GST_PAD_CAST (parent);
+    parent = GST_OBJECT_PARENT (pad);
+  }
+  return GST_ELEMENT_CAST (parent);
+}
+
+static gboolean
+element_is_traced (GstProctimeTracer * self, GstElement * element)
+{
+  guint i;
+
+  if (self->filter == NULL)
+    return TRUE;
+
+  for (i = 0; self->filter[i]; i++) {
+    if (strcmp (self->filter[i], GST_ELEMENT_NAME (element)) == 0)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+static void
+open_span (GstProctimeTracer * self, GstElement * element, GstClockTime ts)
+{
+  guint64 *entry;
+
+  if (!element_is_traced (self, element))
+    return;
+
+  entry = g_object_get_qdata (G_OBJECT (element), entry_time_quark);
+  if (G_UNLIKELY (entry == NULL)) {
+    entry = g_new (guint64, 1);
+    if (!g_object_replace_qdata (G_OBJECT (element), entry_time_quark,
+            NULL, entry, g_free, NULL)) {
+      /* another streaming thread attached the slot first */
+      g_free (entry);
+      entry = g_object_get_qdata (G_OBJECT (element), entry_time_quark);
+    }
+  }
+  *entry = ts;
+}
+
+static void
+close_span (GstProctimeTracer * self, GstElement * element, GstClockTime ts)
+{
+  guint64 *entry;
+
+  entry = g_object_get_qdata (G_OBJECT (element), entry_time_quark);
+  if (entry == NULL || *entry == GST_CLOCK_TIME_NONE)
+    return;
+
+  gst_tracer_record_log (tr_proctime, GST_ELEMENT_NAME (element),
+      (guint64) (ts - *entry));
+  /* only the first output closes the span, otherwise an element pushing
+   * several buffers per input would also be billed for downstream work */
+  *entry = GST_CLOCK_TIME_NONE;
+}
+
+static void
+trace_push (GstProctimeTracer * self, GstClockTime ts, GstPad * pad)
+{
+  GstPad *peer = GST_PAD_PEER (pad);
+  GstElement *element = get_real_pad_parent (pad);
+  GstElement *peer_element = get_real_pad_parent (peer);
+
+  /* data leaving @element: close the span opened when data entered it,
+   * before opening the downstream element's span */
+  if (element && !GST_IS_BIN (element) && GST_PAD_IS_SRC (pad))
+    close_span (self, element, ts);
+
+  if (peer_element && !GST_IS_BIN (peer_element) && GST_PAD_IS_SINK (peer))
+    open_span (self, peer_element, ts);
+}
+
+static void
+do_push_buffer_pre (GObject * obj, GstClockTime ts, GstPad * pad,
+    GstBuffer * buffer)
+{
+  trace_push (GST_PROCTIME_TRACER (obj), ts, pad);
+}
+
+static void
+do_push_buffer_list_pre (GObject * obj, GstClockTime ts, GstPad * pad,
+    GstBufferList * list)
+{
+  trace_push (GST_PROCTIME_TRACER (obj), ts, pad);
+}
+
+static void
+gst_proctime_tracer_constructed (GObject * object)
+{
+  GstProctimeTracer *self = GST_PROCTIME_TRACER (object);
+  gchar *params = NULL;
+
+  G_OBJECT_CLASS (parent_class)->constructed (object);
+
+  g_object_get (self, "params", &params, NULL);
+  if (params && *params)
+    self->filter = g_strsplit (params, ";", -1);
+  g_free (params);
+}
+
+static void
+gst_proctime_tracer_finalize (GObject * object)
+{
+  GstProctimeTracer *self = GST_PROCTIME_TRACER (object);
+
+  g_strfreev (self->filter);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+gst_proctime_tracer_class_init (GstProctimeTracerClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+
+  gobject_class->constructed = gst_proctime_tracer_constructed;
+  gobject_class->finalize = gst_proctime_tracer_finalize;
+
+  entry_time_quark = g_quark_from_static_string ("proctime.entry-time");
+
+  tr_proctime = gst_tracer_record_new ("proctime.class",
+      "element", GST_TYPE_STRUCTURE, gst_structure_new ("scope",
+          "type", G_TYPE_GTYPE, G_TYPE_STRING,
+          "related-to", GST_TYPE_TRACER_VALUE_SCOPE,
+          GST_TRACER_VALUE_SCOPE_ELEMENT, NULL),
+      "time", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING,
+          "time spent processing before the next output in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64, NULL), NULL);
+}
+
+static void
+gst_proctime_tracer_init (GstProctimeTracer * self)
+{
+  GstTracer *tracer = GST_TRACER (self);
+
+  gst_tracing_register_hook (tracer, "pad-push-pre",
+      G_CALLBACK (do_push_buffer_pre));
+  gst_tracing_register_hook (tracer, "pad-push-list-pre",
+      G_CALLBACK (do_push_buffer_list_pre));
+}
@@ -0,0 +1,55 @@
+/* GStreamer
+ * Copyright (C) 2019 GStreamer developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _GST_PROCTIME_TRACER_H_
+#define _GST_PROCTIME_TRACER_H_
+
+#include <gst/gst.h>
+#include <gst/gsttracer.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_PROCTIME_TRACER   (gst_proctime_tracer_get_type())
+#define GST_PROCTIME_TRACER(obj)   (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_PROCTIME_TRACER,GstProctimeTracer))
+#define GST_PROCTIME_TRACER_CLASS(klass)   (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_PROCTIME_TRACER,GstProctimeTracerClass))
+#define GST_IS_PROCTIME_TRACER(obj)   (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_PROCTIME_TRACER))
+#define GST_IS_PROCTIME_TRACER_CLASS(obj)   (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_PROCTIME_TRACER))
+
+typedef struct _GstProctimeTracer GstProctimeTracer;
+typedef struct _GstProctimeTracerClass GstProctimeTracerClass;
+
+struct _GstProctimeTracer
+{
+  GstTracer tracer;
+
+  /* factory names to restrict tracing to, NULL-terminated; NULL traces
+   * every element */
+  gchar **filter;
+};
+
+struct _GstProctimeTracerClass
+{
+  GstTracerClass tracer_class;
+};
+
+GType gst_proctime_tracer_get_type (void);
+
+G_END_DECLS
+
+#endif
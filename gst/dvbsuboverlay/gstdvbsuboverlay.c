@@ -935,9 +935,9 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     GstBuffer *buf;
     gint w, h;
     guint8 *in_data;
-    guint32 *palette, *data;
+    guint32 palette[256], *data;
     gint rx, ry, rw, rh, stride;
-    gint k, l;
+    gint k, l, palette_size;
     GstMapInfo map;
 
     GST_LOG_OBJECT (overlay, "rectangle %d: %dx%d @ (%d, %d)", i,
@@ -946,18 +946,21 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     w = srect->w;
     h = srect->h;
 
+    /* pre-swap the palette to the big-endian layout the overlay format
+     * expects, so the per-pixel loop below is a plain lookup and store
+     * instead of a byte-wise write for every pixel */
+    palette_size = 1 << srect->pict.palette_bits_count;
+    for (k = 0; k < palette_size; k++)
+      palette[k] = GUINT32_TO_BE (srect->pict.palette[k]);
+
     buf = gst_buffer_new_and_alloc (w * h * 4);
     gst_buffer_map (buf, &map, GST_MAP_WRITE);
     data = (guint32 *) map.data;
     in_data = srect->pict.data;
-    palette = srect->pict.palette;
     stride = srect->pict.rowstride;
     for (k = 0; k < h; k++) {
       for (l = 0; l < w; l++) {
-        guint32 ayuv;
-
-        ayuv = palette[*in_data];
-        GST_WRITE_UINT32_BE (data, ayuv);
+        *data = palette[*in_data];
         in_data++;
         data++;
       }
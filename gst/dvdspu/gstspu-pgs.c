@@ -266,17 +266,43 @@ pgs_composition_object_render (PgsCompositionObject * obj, SpuState * state,
 
     colour = &state->pgs.palette[pal_id];
     if (colour->A) {
-      guint32 inv_A = 0xff - colour->A;
       if (G_UNLIKELY (x + run_len > max_x))
         run_len = (max_x - x);
 
-      for (i = 0; i < run_len; i++) {
-        planes[0][x] = (inv_A * planes[0][x] + colour->Y) / 0xff;
+      if (colour->A == 0xff) {
+        /* Fully opaque run: the output luma doesn't depend on the video
+         * underneath, and each sub-sampled comp entry covers two pixels */
+        guint run_end = x + run_len;
+
+        memset (planes[0] + x, colour->Y / 0xff, run_len);
+        if (x & 1) {
+          state->comp_bufs[0][x / 2] += colour->U;
+          state->comp_bufs[1][x / 2] += colour->V;
+          state->comp_bufs[2][x / 2] += colour->A;
+          x++;
+        }
+        for (; x + 1 < run_end; x += 2) {
+          state->comp_bufs[0][x / 2] += colour->U * 2;
+          state->comp_bufs[1][x / 2] += colour->V * 2;
+          state->comp_bufs[2][x / 2] += colour->A * 2;
+        }
+        if (x < run_end) {
+          state->comp_bufs[0][x / 2] += colour->U;
+          state->comp_bufs[1][x / 2] += colour->V;
+          state->comp_bufs[2][x / 2] += colour->A;
+          x++;
+        }
+      } else {
+        guint32 inv_A = 0xff - colour->A;
+
+        for (i = 0; i < run_len; i++) {
+          planes[0][x] = (inv_A * planes[0][x] + colour->Y) / 0xff;
 
-        state->comp_bufs[0][x / 2] += colour->U;
-        state->comp_bufs[1][x / 2] += colour->V;
-        state->comp_bufs[2][x / 2] += colour->A;
-        x++;
+          state->comp_bufs[0][x / 2] += colour->U;
+          state->comp_bufs[1][x / 2] += colour->V;
+          state->comp_bufs[2][x / 2] += colour->A;
+          x++;
+        }
       }
     } else {
       x += run_len;
@@ -178,16 +178,37 @@ gstspu_vobsub_draw_rle_run (SpuState * state, gint16 x, gint16 end,
 #endif
 
   if (colour->A != 0) {
-    guint32 inv_A = 0xff - colour->A;
-
-    /* FIXME: This could be more efficient */
-    while (x < end) {
-      state->vobsub.out_Y[x] =
-          (inv_A * state->vobsub.out_Y[x] + colour->Y) / 0xff;
-      state->vobsub.out_U[x / 2] += colour->U;
-      state->vobsub.out_V[x / 2] += colour->V;
-      state->vobsub.out_A[x / 2] += colour->A;
-      x++;
+    if (colour->A == 0xff) {
+      /* Fully opaque run: the output luma doesn't depend on the video
+       * underneath, and each sub-sampled UV entry covers two pixels */
+      memset (state->vobsub.out_Y + x, colour->Y / 0xff, end - x);
+      if (x & 1) {
+        state->vobsub.out_U[x / 2] += colour->U;
+        state->vobsub.out_V[x / 2] += colour->V;
+        state->vobsub.out_A[x / 2] += colour->A;
+        x++;
+      }
+      for (; x + 1 < end; x += 2) {
+        state->vobsub.out_U[x / 2] += colour->U * 2;
+        state->vobsub.out_V[x / 2] += colour->V * 2;
+        state->vobsub.out_A[x / 2] += colour->A * 2;
+      }
+      if (x < end) {
+        state->vobsub.out_U[x / 2] += colour->U;
+        state->vobsub.out_V[x / 2] += colour->V;
+        state->vobsub.out_A[x / 2] += colour->A;
+      }
+    } else {
+      guint32 inv_A = 0xff - colour->A;
+
+      while (x < end) {
+        state->vobsub.out_Y[x] =
+            (inv_A * state->vobsub.out_Y[x] + colour->Y) / 0xff;
+        state->vobsub.out_U[x / 2] += colour->U;
+        state->vobsub.out_V[x / 2] += colour->V;
+        state->vobsub.out_A[x / 2] += colour->A;
+        x++;
+      }
     }
     /* Update the compositing buffer so we know how much to blend later */
     *(state->vobsub.comp_last_x_ptr) = end - 1; /* end is the start of the *next* run */
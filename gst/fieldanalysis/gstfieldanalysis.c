@@ -1054,6 +1054,9 @@ block_score_for_row_32detect (GstFieldAnalysis * filter,
       GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame) -
       (GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame) % block_width);
 
+  /* scores are per row of blocks, the scratch array is reused for each row */
+  memset (block_scores, 0, (width / block_width) * sizeof (guint));
+
   fjm2 = base_fj - stridex2;
   fjm1 = base_fjp1 - stridex2;
   fj = base_fj;
@@ -1063,6 +1066,7 @@ block_score_for_row_32detect (GstFieldAnalysis * filter,
     /* we have to work one result ahead of ourselves which results in some small
      * peculiarities below */
     gint diff1, diff2;
+    guint64 res_idx = 0, block_pos = 0;
 
     diff1 = fj[0] - fjm1[0];
     diff2 = fj[0] - fjp1[0];
@@ -1076,7 +1080,6 @@ block_score_for_row_32detect (GstFieldAnalysis * filter,
 
     for (i = 1; i < width; i++) {
       const guint64 idx = i * incr;
-      const guint64 res_idx = (i - 1) / block_width;
 
       diff1 = fj[idx] - fjm1[idx];
       diff2 = fj[idx] - fjp1[idx];
@@ -1100,6 +1103,12 @@ block_score_for_row_32detect (GstFieldAnalysis * filter,
       } else if (comb_mask[i - 2] && comb_mask[i - 1] && comb_mask[i]) {
         block_scores[res_idx]++;
       }
+
+      /* track (i - 1) / block_width incrementally */
+      if (++block_pos == block_width) {
+        block_pos = 0;
+        res_idx++;
+      }
     }
     /* advance down a line */
     fjm2 = fjm1;
@@ -1114,8 +1123,6 @@ block_score_for_row_32detect (GstFieldAnalysis * filter,
       block_score = block_scores[i];
   }
 
-  g_free (block_scores);
-  g_free (comb_mask);
   return block_score;
 }
 
@@ -1142,6 +1149,9 @@ block_score_for_row_iscombed (GstFieldAnalysis * filter,
       GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame) -
       (GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame) % block_width);
 
+  /* scores are per row of blocks, the scratch array is reused for each row */
+  memset (block_scores, 0, (width / block_width) * sizeof (guint));
+
   fjm1 = base_fjp1 - stridex2;
   fj = base_fj;
   fjp1 = base_fjp1;
@@ -1150,6 +1160,7 @@ block_score_for_row_iscombed (GstFieldAnalysis * filter,
     /* we have to work one result ahead of ourselves which results in some small
      * peculiarities below */
     gint diff1, diff2;
+    guint64 res_idx = 0, block_pos = 0;
 
     diff1 = fj[0] - fjm1[0];
     diff2 = fj[0] - fjp1[0];
@@ -1164,7 +1175,6 @@ block_score_for_row_iscombed (GstFieldAnalysis * filter,
 
     for (i = 1; i < width; i++) {
       const guint64 idx = i * incr;
-      const guint64 res_idx = (i - 1) / block_width;
 
       diff1 = fj[idx] - fjm1[idx];
       diff2 = fj[idx] - fjp1[idx];
@@ -1189,6 +1199,12 @@ block_score_for_row_iscombed (GstFieldAnalysis * filter,
       } else if (comb_mask[i - 2] && comb_mask[i - 1] && comb_mask[i]) {
         block_scores[res_idx]++;
       }
+
+      /* track (i - 1) / block_width incrementally */
+      if (++block_pos == block_width) {
+        block_pos = 0;
+        res_idx++;
+      }
     }
     /* advance down a line */
     fjm1 = fj;
@@ -1202,8 +1218,6 @@ block_score_for_row_iscombed (GstFieldAnalysis * filter,
       block_score = block_scores[i];
   }
 
-  g_free (block_scores);
-  g_free (comb_mask);
   return block_score;
 }
 
@@ -1231,6 +1245,9 @@ block_score_for_row_5_tap (GstFieldAnalysis * filter,
       (GST_VIDEO_FRAME_WIDTH (&(*history)[0].frame) % block_width);
 
 
+  /* scores are per row of blocks, the scratch array is reused for each row */
+  memset (block_scores, 0, (width / block_width) * sizeof (guint));
+
   fjm2 = base_fj - stridex2;
   fjm1 = base_fjp1 - stridex2;
   fj = base_fj;
@@ -1241,6 +1258,7 @@ block_score_for_row_5_tap (GstFieldAnalysis * filter,
     /* we have to work one result ahead of ourselves which results in some small
      * peculiarities below */
     gint diff1, diff2;
+    guint64 res_idx = 0, block_pos = 0;
 
     diff1 = fj[0] - fjm1[0];
     diff2 = fj[0] - fjp1[0];
@@ -1273,7 +1291,6 @@ block_score_for_row_5_tap (GstFieldAnalysis * filter,
 
     for (i = 1; i < width; i++) {
       const guint64 idx = i * incr;
-      const guint64 res_idx = (i - 1) / block_width;
 
       diff1 = fj[idx] - fjm1[idx];
       diff2 = fj[idx] - fjp1[idx];
@@ -1298,6 +1315,12 @@ block_score_for_row_5_tap (GstFieldAnalysis * filter,
       } else if (comb_mask[i - 2] && comb_mask[i - 1] && comb_mask[i]) {
         block_scores[res_idx]++;
       }
+
+      /* track (i - 1) / block_width incrementally */
+      if (++block_pos == block_width) {
+        block_pos = 0;
+        res_idx++;
+      }
     }
     /* advance down a line */
     fjm2 = fjm1;
@@ -1313,8 +1336,6 @@ block_score_for_row_5_tap (GstFieldAnalysis * filter,
       block_score = block_scores[i];
   }
 
-  g_free (block_scores);
-  g_free (comb_mask);
   return block_score;
 }
 
@@ -195,17 +195,30 @@ freeverb_allpass_getfeedback(freeverb_allpass* allpass)
   return allpass->feedback;
 }*/
 
-#define freeverb_allpass_process(_allpass, _input_1) \
-{ \
-  gfloat output; \
-  gfloat bufout; \
-  bufout = _allpass.buffer[_allpass.bufidx]; \
-  output = bufout-_input_1; \
-  _allpass.buffer[_allpass.bufidx] = _input_1 + (bufout * _allpass.feedback); \
-  if (++_allpass.bufidx >= _allpass.bufsize) { \
-    _allpass.bufidx = 0; \
-  } \
-  _input_1 = output; \
+/* Process a whole block through one allpass filter in place. Keeping the
+ * filter state in locals for the duration of the block lets the compiler
+ * hold it in registers, which it cannot do with per-sample struct access
+ * since the delay line stores alias the state members */
+static void
+freeverb_allpass_process_block (freeverb_allpass * allpass, gfloat * data,
+    guint num_samples)
+{
+  gfloat feedback = allpass->feedback;
+  gfloat *buffer = allpass->buffer;
+  gint bufsize = allpass->bufsize;
+  gint bufidx = allpass->bufidx;
+  guint k;
+
+  for (k = 0; k < num_samples; k++) {
+    gfloat input = data[k];
+    gfloat bufout = buffer[bufidx];
+
+    data[k] = bufout - input;
+    buffer[bufidx] = input + (bufout * feedback);
+    if (++bufidx >= bufsize)
+      bufidx = 0;
+  }
+  allpass->bufidx = bufidx;
 }
 
 /* comb filter */
@@ -274,15 +287,33 @@ freeverb_comb_getfeedback(freeverb_comb* comb)
   return comb->feedback;
 }*/
 
-#define freeverb_comb_process(_comb, _input_1, _output) \
-{ \
-  gfloat _tmp = _comb.buffer[_comb.bufidx]; \
-  _comb.filterstore = (_tmp * _comb.damp2) + (_comb.filterstore * _comb.damp1); \
-  _comb.buffer[_comb.bufidx] = _input_1 + (_comb.filterstore * _comb.feedback); \
-  if (++_comb.bufidx >= _comb.bufsize) { \
-    _comb.bufidx = 0; \
-  } \
-  _output += _tmp; \
+/* Process a whole block through one comb filter, accumulating into the
+ * output block. See freeverb_allpass_process_block() for why the state is
+ * kept in locals for the duration of the block */
+static void
+freeverb_comb_process_block (freeverb_comb * comb, const gfloat * input,
+    gfloat * output, guint num_samples)
+{
+  gfloat feedback = comb->feedback;
+  gfloat filterstore = comb->filterstore;
+  gfloat damp1 = comb->damp1;
+  gfloat damp2 = comb->damp2;
+  gfloat *buffer = comb->buffer;
+  gint bufsize = comb->bufsize;
+  gint bufidx = comb->bufidx;
+  guint k;
+
+  for (k = 0; k < num_samples; k++) {
+    gfloat tmp = buffer[bufidx];
+
+    filterstore = (tmp * damp2) + (filterstore * damp1);
+    buffer[bufidx] = input[k] + (filterstore * feedback);
+    if (++bufidx >= bufsize)
+      bufidx = 0;
+    output[k] += tmp;
+  }
+  comb->filterstore = filterstore;
+  comb->bufidx = bufidx;
 }
 
 #define numcombs 8
@@ -342,12 +373,26 @@ struct _GstFreeverbPrivate
   /* Allpass filters */
   freeverb_allpass allpassL[numallpasses];
   freeverb_allpass allpassR[numallpasses];
+  /* Scratch blocks for batched filter processing: input left/right and
+   * output left/right, each scratch_samples floats */
+  gfloat *scratch;
+  guint scratch_samples;
 };
 
 G_DEFINE_TYPE_WITH_CODE (GstFreeverb, gst_freeverb, GST_TYPE_BASE_TRANSFORM,
     G_ADD_PRIVATE (GstFreeverb)
     G_IMPLEMENT_INTERFACE (GST_TYPE_PRESET, NULL));
 
+static gfloat *
+freeverb_ensure_scratch (GstFreeverbPrivate * priv, guint num_samples)
+{
+  if (priv->scratch_samples < num_samples) {
+    priv->scratch = g_renew (gfloat, priv->scratch, 4 * num_samples);
+    priv->scratch_samples = num_samples;
+  }
+  return priv->scratch;
+}
+
 static void
 freeverb_revmodel_init (GstFreeverb * filter)
 {
@@ -455,6 +500,7 @@ gst_freeverb_finalize (GObject * object)
   GstFreeverb *filter = GST_FREEVERB (object);
 
   freeverb_revmodel_free (filter);
+  g_free (filter->priv->scratch);
 
   G_OBJECT_CLASS (gst_freeverb_parent_class)->finalize (object);
 }
@@ -690,35 +736,40 @@ gst_freeverb_transform_m2s_int (GstFreeverb * filter,
     gint16 * idata, gint16 * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1;
-  gfloat out_l2, out_r2, input_2;
+  gfloat *scratch = freeverb_ensure_scratch (priv, num_samples);
+  gfloat *input_1 = scratch;
+  gfloat *out_l = scratch + 2 * num_samples;
+  gfloat *out_r = scratch + 3 * num_samples;
+  gfloat out_l1, out_r1, out_l2, out_r2, input_2;
+  gint i;
+  guint k;
   gboolean drained = TRUE;
 
-  for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
-
-    /* The original Freeverb code expects a stereo signal and 'input_1'
-     * is set to the sum of the left and right input_1 sample. Since
-     * this code works on a mono signal, 'input_1' is set to twice the
-     * input_1 sample. */
-    input_2 = (gfloat) * idata++;
-    input_1 = (2.0f * input_2 + DC_OFFSET) * priv->gain;
-
-    /* Accumulate comb filters in parallel */
-    for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1, out_r1);
-    }
-    /* Feed through allpasses in series */
-    for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
-    }
+  /* The original Freeverb code expects a stereo signal and 'input_1'
+   * is set to the sum of the left and right input_1 sample. Since
+   * this code works on a mono signal, 'input_1' is set to twice the
+   * input_1 sample. */
+  for (k = 0; k < num_samples; k++)
+    input_1[k] = (2.0f * (gfloat) idata[k] + DC_OFFSET) * priv->gain;
+  memset (out_l, 0, num_samples * sizeof (gfloat));
+  memset (out_r, 0, num_samples * sizeof (gfloat));
+
+  /* Accumulate comb filters in parallel */
+  for (i = 0; i < numcombs; i++) {
+    freeverb_comb_process_block (&priv->combL[i], input_1, out_l, num_samples);
+    freeverb_comb_process_block (&priv->combR[i], input_1, out_r, num_samples);
+  }
+  /* Feed through allpasses in series */
+  for (i = 0; i < numallpasses; i++) {
+    freeverb_allpass_process_block (&priv->allpassL[i], out_l, num_samples);
+    freeverb_allpass_process_block (&priv->allpassR[i], out_r, num_samples);
+  }
 
+  for (k = 0; k < num_samples; k++) {
     /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
+    out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+    out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+    input_2 = (gfloat) idata[k];
 
     /* Calculate output */
     out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2 * priv->dry;
@@ -739,33 +790,40 @@ gst_freeverb_transform_s2s_int (GstFreeverb * filter,
     gint16 * idata, gint16 * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1l, input_1r;
-  gfloat out_l2, out_r2, input_2l, input_2r;
+  gfloat *scratch = freeverb_ensure_scratch (priv, num_samples);
+  gfloat *input_1l = scratch;
+  gfloat *input_1r = scratch + num_samples;
+  gfloat *out_l = scratch + 2 * num_samples;
+  gfloat *out_r = scratch + 3 * num_samples;
+  gfloat out_l1, out_r1, out_l2, out_r2, input_2l, input_2r;
+  gint i;
+  guint k;
   gboolean drained = TRUE;
 
   for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
-
-    input_2l = (gfloat) * idata++;
-    input_2r = (gfloat) * idata++;
-    input_1l = (input_2l + DC_OFFSET) * priv->gain;
-    input_1r = (input_2r + DC_OFFSET) * priv->gain;
+    input_1l[k] = ((gfloat) idata[2 * k] + DC_OFFSET) * priv->gain;
+    input_1r[k] = ((gfloat) idata[2 * k + 1] + DC_OFFSET) * priv->gain;
+  }
+  memset (out_l, 0, num_samples * sizeof (gfloat));
+  memset (out_r, 0, num_samples * sizeof (gfloat));
 
-    /* Accumulate comb filters in parallel */
-    for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1l, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1r, out_r1);
-    }
-    /* Feed through allpasses in series */
-    for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
-    }
+  /* Accumulate comb filters in parallel */
+  for (i = 0; i < numcombs; i++) {
+    freeverb_comb_process_block (&priv->combL[i], input_1l, out_l, num_samples);
+    freeverb_comb_process_block (&priv->combR[i], input_1r, out_r, num_samples);
+  }
+  /* Feed through allpasses in series */
+  for (i = 0; i < numallpasses; i++) {
+    freeverb_allpass_process_block (&priv->allpassL[i], out_l, num_samples);
+    freeverb_allpass_process_block (&priv->allpassR[i], out_r, num_samples);
+  }
 
+  for (k = 0; k < num_samples; k++) {
     /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
+    out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+    out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+    input_2l = (gfloat) idata[2 * k];
+    input_2r = (gfloat) idata[2 * k + 1];
 
     /* Calculate output */
     out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2l * priv->dry;
@@ -786,35 +844,40 @@ gst_freeverb_transform_m2s_float (GstFreeverb * filter,
     gfloat * idata, gfloat * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1;
-  gfloat out_l2, out_r2, input_2;
+  gfloat *scratch = freeverb_ensure_scratch (priv, num_samples);
+  gfloat *input_1 = scratch;
+  gfloat *out_l = scratch + 2 * num_samples;
+  gfloat *out_r = scratch + 3 * num_samples;
+  gfloat out_l1, out_r1, out_l2, out_r2, input_2;
+  gint i;
+  guint k;
   gboolean drained = TRUE;
 
-  for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
-
-    /* The original Freeverb code expects a stereo signal and 'input_1'
-     * is set to the sum of the left and right input_1 sample. Since
-     * this code works on a mono signal, 'input_1' is set to twice the
-     * input_1 sample. */
-    input_2 = *idata++;
-    input_1 = (2.0f * input_2 + DC_OFFSET) * priv->gain;
-
-    /* Accumulate comb filters in parallel */
-    for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1, out_r1);
-    }
-    /* Feed through allpasses in series */
-    for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
-    }
+  /* The original Freeverb code expects a stereo signal and 'input_1'
+   * is set to the sum of the left and right input_1 sample. Since
+   * this code works on a mono signal, 'input_1' is set to twice the
+   * input_1 sample. */
+  for (k = 0; k < num_samples; k++)
+    input_1[k] = (2.0f * idata[k] + DC_OFFSET) * priv->gain;
+  memset (out_l, 0, num_samples * sizeof (gfloat));
+  memset (out_r, 0, num_samples * sizeof (gfloat));
 
+  /* Accumulate comb filters in parallel */
+  for (i = 0; i < numcombs; i++) {
+    freeverb_comb_process_block (&priv->combL[i], input_1, out_l, num_samples);
+    freeverb_comb_process_block (&priv->combR[i], input_1, out_r, num_samples);
+  }
+  /* Feed through allpasses in series */
+  for (i = 0; i < numallpasses; i++) {
+    freeverb_allpass_process_block (&priv->allpassL[i], out_l, num_samples);
+    freeverb_allpass_process_block (&priv->allpassR[i], out_r, num_samples);
+  }
+
+  for (k = 0; k < num_samples; k++) {
     /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
+    out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+    out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+    input_2 = idata[k];
 
     /* Calculate output */
     out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2 * priv->dry;
@@ -833,33 +896,40 @@ gst_freeverb_transform_s2s_float (GstFreeverb * filter,
     gfloat * idata, gfloat * odata, guint num_samples)
 {
   GstFreeverbPrivate *priv = filter->priv;
-  gint i, k;
-  gfloat out_l1, out_r1, input_1l, input_1r;
-  gfloat out_l2, out_r2, input_2l, input_2r;
+  gfloat *scratch = freeverb_ensure_scratch (priv, num_samples);
+  gfloat *input_1l = scratch;
+  gfloat *input_1r = scratch + num_samples;
+  gfloat *out_l = scratch + 2 * num_samples;
+  gfloat *out_r = scratch + 3 * num_samples;
+  gfloat out_l1, out_r1, out_l2, out_r2, input_2l, input_2r;
+  gint i;
+  guint k;
   gboolean drained = TRUE;
 
   for (k = 0; k < num_samples; k++) {
-    out_l1 = out_r1 = 0.0;
-
-    input_2l = *idata++;
-    input_2r = *idata++;
-    input_1l = (input_2l + DC_OFFSET) * priv->gain;
-    input_1r = (input_2r + DC_OFFSET) * priv->gain;
+    input_1l[k] = (idata[2 * k] + DC_OFFSET) * priv->gain;
+    input_1r[k] = (idata[2 * k + 1] + DC_OFFSET) * priv->gain;
+  }
+  memset (out_l, 0, num_samples * sizeof (gfloat));
+  memset (out_r, 0, num_samples * sizeof (gfloat));
 
-    /* Accumulate comb filters in parallel */
-    for (i = 0; i < numcombs; i++) {
-      freeverb_comb_process (priv->combL[i], input_1l, out_l1);
-      freeverb_comb_process (priv->combR[i], input_1r, out_r1);
-    }
-    /* Feed through allpasses in series */
-    for (i = 0; i < numallpasses; i++) {
-      freeverb_allpass_process (priv->allpassL[i], out_l1);
-      freeverb_allpass_process (priv->allpassR[i], out_r1);
-    }
+  /* Accumulate comb filters in parallel */
+  for (i = 0; i < numcombs; i++) {
+    freeverb_comb_process_block (&priv->combL[i], input_1l, out_l, num_samples);
+    freeverb_comb_process_block (&priv->combR[i], input_1r, out_r, num_samples);
+  }
+  /* Feed through allpasses in series */
+  for (i = 0; i < numallpasses; i++) {
+    freeverb_allpass_process_block (&priv->allpassL[i], out_l, num_samples);
+    freeverb_allpass_process_block (&priv->allpassR[i], out_r, num_samples);
+  }
 
+  for (k = 0; k < num_samples; k++) {
     /* Remove the DC offset */
-    out_l1 -= (gfloat) DC_OFFSET;
-    out_r1 -= (gfloat) DC_OFFSET;
+    out_l1 = out_l[k] - (gfloat) DC_OFFSET;
+    out_r1 = out_r[k] - (gfloat) DC_OFFSET;
+    input_2l = idata[2 * k];
+    input_2r = idata[2 * k + 1];
 
     /* Calculate output */
     out_l2 = out_l1 * priv->wet1 + out_r1 * priv->wet2 + input_2l * priv->dry;
@@ -186,6 +186,8 @@ gst_chromium_init (GstChromium * filter)
   filter->edge_a = DEFAULT_EDGE_A;
   filter->edge_b = DEFAULT_EDGE_B;
 
+  gst_gaudi_gate_init (&filter->gate);
+
   setup_cos_table ();
 }
 
@@ -232,6 +234,10 @@ gst_chromium_get_property (GObject * object, guint prop_id,
 static void
 gst_chromium_finalize (GObject * object)
 {
+  GstChromium *filter = GST_CHROMIUM (object);
+
+  gst_gaudi_gate_reset (&filter->gate);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -268,10 +274,16 @@ gst_chromium_transform_frame (GstVideoFilter * vfilter,
   edge_b = filter->edge_b;
   GST_OBJECT_UNLOCK (filter);
 
+  if (gst_gaudi_gate_skip (&filter->gate, (edge_a << 9) ^ edge_b, in_frame,
+          out_frame))
+    return GST_FLOW_OK;
+
   video_size = GST_VIDEO_FRAME_WIDTH (in_frame) *
       GST_VIDEO_FRAME_HEIGHT (in_frame);
   transform (src, dest, video_size, edge_a, edge_b);
 
+  gst_gaudi_gate_store (&filter->gate, out_frame);
+
   return GST_FLOW_OK;
 }
 
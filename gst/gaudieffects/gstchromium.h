@@ -50,6 +50,8 @@
 #include <gst/video/video.h>
 #include <gst/video/gstvideofilter.h>
 
+#include "gstgaudigate.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_CHROMIUM (gst_chromium_get_type())
@@ -71,6 +73,8 @@ struct _GstChromium
 
   /* < private > */
   gint edge_a, edge_b;
+
+  GstGaudiGate gate;
 };
 
 struct _GstChromiumClass
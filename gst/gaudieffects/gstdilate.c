@@ -166,6 +166,8 @@ static void
 gst_dilate_init (GstDilate * filter)
 {
   filter->erode = DEFAULT_ERODE;
+
+  gst_gaudi_gate_init (&filter->gate);
 }
 
 static void
@@ -205,6 +207,10 @@ gst_dilate_get_property (GObject * object, guint prop_id,
 static void
 gst_dilate_finalize (GObject * object)
 {
+  GstDilate *filter = GST_DILATE (object);
+
+  gst_gaudi_gate_reset (&filter->gate);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -244,9 +250,14 @@ gst_dilate_transform_frame (GstVideoFilter * vfilter,
   erode = filter->erode;
   GST_OBJECT_UNLOCK (filter);
 
+  if (gst_gaudi_gate_skip (&filter->gate, erode, in_frame, out_frame))
+    return GST_FLOW_OK;
+
   video_size = width * height;
   transform (src, dest, video_size, width, height, erode);
 
+  gst_gaudi_gate_store (&filter->gate, out_frame);
+
   return GST_FLOW_OK;
 }
 
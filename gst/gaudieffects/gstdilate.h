@@ -51,6 +51,8 @@
 #include <gst/video/video.h>
 #include <gst/video/gstvideofilter.h>
 
+#include "gstgaudigate.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_DILATE \
@@ -73,6 +75,8 @@ struct _GstDilate
 
   /* < private > */
   gboolean erode;
+
+  GstGaudiGate gate;
 };
 
 struct _GstDilateClass
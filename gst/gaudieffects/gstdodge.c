@@ -236,28 +236,38 @@ gst_dodge_plugin_init (GstPlugin * dodge)
 
 /*** Now the image processing work.... ***/
 
+/* The dodge curve has no parameters, so the per-byte mapping is built
+ * once and every frame is a table lookup per color sample. */
+static guint8 dodge_lut[256];
+
+static void
+dodge_lut_init (void)
+{
+  gint v, out;
+
+  for (v = 0; v < 256; v++) {
+    out = (256 * v) / (256 - v);
+    dodge_lut[v] = CLAMP (out, 0, 255);
+  }
+}
+
 /* Transform processes each frame. */
 static void
 transform (guint32 * src, guint32 * dest, gint video_area)
 {
+  static gsize lut_once = 0;
   guint32 in;
-  gint x, red, green, blue;
+  gint x;
+
+  if (g_once_init_enter (&lut_once)) {
+    dodge_lut_init ();
+    g_once_init_leave (&lut_once, 1);
+  }
 
   for (x = 0; x < video_area; x++) {
     in = *src++;
 
-    red = (in >> 16) & 0xff;
-    green = (in >> 8) & 0xff;
-    blue = (in) & 0xff;
-
-    red = (256 * red) / (256 - red);
-    green = (256 * green) / (256 - green);
-    blue = (256 * blue) / (256 - blue);
-
-    red = CLAMP (red, 0, 255);
-    green = CLAMP (green, 0, 255);
-    blue = CLAMP (blue, 0, 255);
-
-    *dest++ = (red << 16) | (green << 8) | blue;
+    *dest++ = ((guint32) dodge_lut[(in >> 16) & 0xff] << 16) |
+        ((guint32) dodge_lut[(in >> 8) & 0xff] << 8) | dodge_lut[in & 0xff];
   }
 }
@@ -0,0 +1,125 @@
+/*
+ * GStreamer
+ * Copyright (C) <2010> Luis de Bethencourt <luis@debethencourt.com>
+ *
+ * Frame-delta gate shared by the gaudieffects elements.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * Alternatively, the contents of this file may be used under the
+ * GNU Lesser General Public License Version 2.1 (the "LGPL"), in
+ * which case the following provisions apply instead of the ones
+ * mentioned above:
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif
+
+#include <string.h>
+
+#include "gstgaudigate.h"
+
+void
+gst_gaudi_gate_init (GstGaudiGate * gate)
+{
+  gate->checksum = 0;
+  gate->valid = FALSE;
+  gate->last_output = NULL;
+}
+
+void
+gst_gaudi_gate_reset (GstGaudiGate * gate)
+{
+  gst_buffer_replace (&gate->last_output, NULL);
+  gate->valid = FALSE;
+}
+
+/* FNV-1a over the input pixels, seeded with the effect parameters so a
+ * property change invalidates the cached output as well */
+static guint32
+gst_gaudi_gate_checksum (guint32 params_hash, GstVideoFrame * frame)
+{
+  const guint8 *data = GST_VIDEO_FRAME_PLANE_DATA (frame, 0);
+  gsize size = GST_VIDEO_FRAME_SIZE (frame);
+  gsize i, words = size / 4;
+  guint32 hash = 2166136261u ^ params_hash;
+
+  for (i = 0; i < words; i++) {
+    hash = (hash ^ GST_READ_UINT32_LE (data + 4 * i)) * 16777619u;
+  }
+  for (i = 4 * words; i < size; i++) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+
+  return hash;
+}
+
+/* Returns TRUE when the input is unchanged and the previous output was
+ * replayed into @out_frame, in which case the caller can skip its
+ * transform. Returns FALSE otherwise; the caller must then run the
+ * transform and hand the result to gst_gaudi_gate_store(). */
+gboolean
+gst_gaudi_gate_skip (GstGaudiGate * gate, guint32 params_hash,
+    GstVideoFrame * in_frame, GstVideoFrame * out_frame)
+{
+  guint32 checksum = gst_gaudi_gate_checksum (params_hash, in_frame);
+
+  if (gate->valid && checksum == gate->checksum && gate->last_output) {
+    GstMapInfo info;
+
+    if (gst_buffer_map (gate->last_output, &info, GST_MAP_READ)) {
+      if (info.size == GST_VIDEO_FRAME_SIZE (out_frame)) {
+        memcpy (GST_VIDEO_FRAME_PLANE_DATA (out_frame, 0), info.data,
+            info.size);
+        gst_buffer_unmap (gate->last_output, &info);
+        return TRUE;
+      }
+      gst_buffer_unmap (gate->last_output, &info);
+    }
+  }
+
+  gate->checksum = checksum;
+  gate->valid = FALSE;
+  return FALSE;
+}
+
+void
+gst_gaudi_gate_store (GstGaudiGate * gate, GstVideoFrame * out_frame)
+{
+  /* the extra ref keeps the buffer from becoming writable again, so the
+   * cached pixels cannot change behind our back */
+  gst_buffer_replace (&gate->last_output, out_frame->buffer);
+  gate->valid = TRUE;
+}
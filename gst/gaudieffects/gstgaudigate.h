@@ -0,0 +1,72 @@
+/*
+ * GStreamer
+ * Copyright (C) <2010> Luis de Bethencourt <luis@debethencourt.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * Alternatively, the contents of this file may be used under the
+ * GNU Lesser General Public License Version 2.1 (the "LGPL"), in
+ * which case the following provisions apply instead of the ones
+ * mentioned above:
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_GAUDI_GATE_H__
+#define __GST_GAUDI_GATE_H__
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+
+G_BEGIN_DECLS
+
+/* Frame-delta gate shared by the gaudieffects elements. The effects are
+ * pure functions of the input pixels and their properties, so when neither
+ * changed since the previous frame the previous output can be replayed
+ * instead of recomputing the per-pixel transform, which is the common
+ * case for signage-style static content. */
+typedef struct
+{
+  guint32 checksum;
+  gboolean valid;
+  GstBuffer *last_output;
+} GstGaudiGate;
+
+void gst_gaudi_gate_init (GstGaudiGate * gate);
+void gst_gaudi_gate_reset (GstGaudiGate * gate);
+gboolean gst_gaudi_gate_skip (GstGaudiGate * gate, guint32 params_hash,
+    GstVideoFrame * in_frame, GstVideoFrame * out_frame);
+void gst_gaudi_gate_store (GstGaudiGate * gate, GstVideoFrame * out_frame);
+
+G_END_DECLS
+
+#endif /* __GST_GAUDI_GATE_H__ */
@@ -96,8 +96,10 @@ enum
 #define DEFAULT_START 50
 #define DEFAULT_END 185
 
+static void solarize_update_lut (GstSolarize * filter, gint threshold,
+    gint start, gint end);
 static void transform (guint32 * src, guint32 * dest, gint video_area,
-    gint threshold, gint start, gint end);
+    const guint8 * lut);
 
 /* The capabilities of the inputs and outputs. */
 
@@ -273,7 +275,11 @@ gst_solarize_transform_frame (GstVideoFilter * vfilter,
   video_size = GST_VIDEO_FRAME_WIDTH (in_frame) *
       GST_VIDEO_FRAME_HEIGHT (in_frame);
 
-  transform (src, dest, video_size, threshold, start, end);
+  if (!filter->lut_valid || threshold != filter->lut_threshold ||
+      start != filter->lut_start || end != filter->lut_end)
+    solarize_update_lut (filter, threshold, start, end);
+
+  transform (src, dest, video_size, filter->lut);
 
   return GST_FLOW_OK;
 }
@@ -293,15 +299,15 @@ gst_solarize_plugin_init (GstPlugin * solarize)
 
 /*** Now the image processing work.... ***/
 
-/* Transform processes each frame. */
+/* The mapping only depends on the sample value and the three properties,
+ * so it is collapsed into a 256-entry table and rebuilt when a property
+ * changes instead of being recomputed per pixel. */
 static void
-transform (guint32 * src, guint32 * dest, gint video_area,
-    gint threshold, gint start, gint end)
+solarize_update_lut (GstSolarize * filter, gint threshold, gint start,
+    gint end)
 {
-  guint32 in;
-  guint32 color[3];
   gint period = 1, up_length = 1, down_length = 1;
-  gint x, c;
+  gint v;
   gint param;
   static const guint ceiling = 255;
 
@@ -314,37 +320,47 @@ transform (guint32 * src, guint32 * dest, gint video_area,
   if (threshold != end)
     down_length = end - threshold;
 
+  for (v = 0; v < 256; v++) {
+    guint32 color;
+
+    param = v;
+    param += 256;
+    param -= start;
+    param %= period;
+
+    if (param < up_length) {
+      color = param * ceiling;
+      color /= up_length;
+    } else {
+      color = down_length - (param - up_length);
+      color *= ceiling;
+      color /= down_length;
+    }
+
+    if (G_UNLIKELY (color > 255))
+      color = 255;
+
+    filter->lut[v] = color;
+  }
+
+  filter->lut_threshold = threshold;
+  filter->lut_start = start;
+  filter->lut_end = end;
+  filter->lut_valid = TRUE;
+}
+
+/* Transform processes each frame. */
+static void
+transform (guint32 * src, guint32 * dest, gint video_area, const guint8 * lut)
+{
+  guint32 in;
+  gint x;
+
   /* Loop through pixels. */
   for (x = 0; x < video_area; x++) {
     in = *src++;
 
-    color[0] = (in >> 16) & 0xff;
-    color[1] = (in >> 8) & 0xff;
-    color[2] = (in) & 0xff;
-
-    /* Loop through colors. */
-    for (c = 0; c < 3; c++) {
-      param = color[c];
-      param += 256;
-      param -= start;
-      param %= period;
-
-      if (param < up_length) {
-        color[c] = param * ceiling;
-        color[c] /= up_length;
-      } else {
-        color[c] = down_length - (param - up_length);
-        color[c] *= ceiling;
-        color[c] /= down_length;
-      }
-    }
-
-    /* Clamp colors */
-    for (c = 0; c < 3; c++) {
-      if (G_UNLIKELY (color[c] > 255))
-        color[c] = 255;
-    }
-
-    *dest++ = (color[0] << 16) | (color[1] << 8) | color[2];
+    *dest++ = ((guint32) lut[(in >> 16) & 0xff] << 16) |
+        ((guint32) lut[(in >> 8) & 0xff] << 8) | lut[in & 0xff];
   }
 }
@@ -73,6 +73,12 @@ struct _GstSolarize
 
   /* < private > */
   gint threshold, start, end;
+
+  /* per-byte mapping for the current property values, rebuilt only
+   * when they change */
+  guint8 lut[256];
+  gint lut_threshold, lut_start, lut_end;
+  gboolean lut_valid;
 };
 
 struct _GstSolarizeClass
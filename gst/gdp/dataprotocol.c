@@ -508,14 +508,44 @@ gst_dp_buffer_from_header (guint header_length, const guint8 * header,
       gst_buffer_new_allocate (allocator,
       (guint) GST_DP_HEADER_PAYLOAD_LENGTH (header), allocation_params);
 
+  gst_dp_buffer_set_meta_from_header (buffer, header_length, header);
+
+  return buffer;
+}
+
+/**
+ * gst_dp_buffer_set_meta_from_header:
+ * @buffer: a writable #GstBuffer to set the metadata on
+ * @header_length: the length of the packet header
+ * @header: the byte array of the packet header
+ *
+ * Sets the buffer metadata (timestamps, offsets and flags) described by
+ * @header on @buffer.
+ *
+ * Use this function if you already have a buffer containing the packet
+ * payload, for example one taken out of an adapter without copying, and
+ * only need the header metadata applied to it.
+ *
+ * This function does not check the header passed to it, use
+ * gst_dp_validate_header() first if the header data is unchecked.
+ */
+void
+gst_dp_buffer_set_meta_from_header (GstBuffer * buffer, guint header_length,
+    const guint8 * header)
+{
+  g_return_if_fail (buffer != NULL);
+  g_return_if_fail (gst_buffer_is_writable (buffer));
+  g_return_if_fail (header != NULL);
+  g_return_if_fail (header_length >= GST_DP_HEADER_LENGTH);
+  g_return_if_fail (GST_DP_HEADER_PAYLOAD_TYPE (header) ==
+      GST_DP_PAYLOAD_BUFFER);
+
   GST_BUFFER_TIMESTAMP (buffer) = GST_DP_HEADER_TIMESTAMP (header);
   GST_BUFFER_DTS (buffer) = GST_DP_HEADER_DTS (header);
   GST_BUFFER_DURATION (buffer) = GST_DP_HEADER_DURATION (header);
   GST_BUFFER_OFFSET (buffer) = GST_DP_HEADER_OFFSET (header);
   GST_BUFFER_OFFSET_END (buffer) = GST_DP_HEADER_OFFSET_END (header);
   GST_BUFFER_FLAGS (buffer) = GST_DP_HEADER_BUFFER_FLAGS (header);
-
-  return buffer;
 }
 
 /**
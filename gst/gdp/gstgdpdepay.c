@@ -362,21 +362,34 @@ gst_gdp_depay_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
           goto no_caps;
 
         GST_LOG_OBJECT (this, "reading GDP buffer from adapter");
-        buf =
-            gst_dp_buffer_from_header (GST_DP_HEADER_LENGTH, this->header,
-            this->allocator, &this->allocation_params);
-        if (!buf)
-          goto buffer_failed;
-
-        /* now take the payload if there is any */
-        if (this->payload_length > 0) {
-          GstMapInfo map;
-
-          gst_buffer_map (buf, &map, GST_MAP_WRITE);
-          gst_adapter_copy (this->adapter, map.data, 0, this->payload_length);
-          gst_buffer_unmap (buf, &map);
-
-          gst_adapter_flush (this->adapter, this->payload_length);
+        if (this->payload_length > 0 && this->allocator == NULL) {
+          /* take the payload out of the adapter without copying; we only
+           * have to do the copy dance when downstream provided a specific
+           * allocator to put the data in */
+          buf = gst_adapter_take_buffer_fast (this->adapter,
+              this->payload_length);
+          if (!buf)
+            goto buffer_failed;
+
+          gst_dp_buffer_set_meta_from_header (buf, GST_DP_HEADER_LENGTH,
+              this->header);
+        } else {
+          buf =
+              gst_dp_buffer_from_header (GST_DP_HEADER_LENGTH, this->header,
+              this->allocator, &this->allocation_params);
+          if (!buf)
+            goto buffer_failed;
+
+          /* now take the payload if there is any */
+          if (this->payload_length > 0) {
+            GstMapInfo map;
+
+            gst_buffer_map (buf, &map, GST_MAP_WRITE);
+            gst_adapter_copy (this->adapter, map.data, 0, this->payload_length);
+            gst_buffer_unmap (buf, &map);
+
+            gst_adapter_flush (this->adapter, this->payload_length);
+          }
         }
 
         if (GST_BUFFER_TIMESTAMP (buf) > -this->ts_offset)
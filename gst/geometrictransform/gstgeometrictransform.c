@@ -206,6 +206,49 @@ gst_geometric_transform_do_map (GstGeometricTransform * gt, guint8 * in_data,
   }
 }
 
+static void
+gst_geometric_transform_process_rows (GstGeometricTransform * gt,
+    guint8 * in_data, guint8 * out_data, gint y0, gint y1)
+{
+  gdouble *ptr = gt->map + (gsize) y0 * gt->width * 2;
+  gint x, y;
+
+  for (y = y0; y < y1; y++) {
+    for (x = 0; x < gt->width; x++) {
+      /* do the mapping */
+      gst_geometric_transform_do_map (gt, in_data, out_data, x, y, ptr[0],
+          ptr[1]);
+      ptr += 2;
+    }
+  }
+}
+
+/* one horizontal band of output rows; bands are independent since every
+ * output pixel only reads from the input frame through the map */
+typedef struct
+{
+  GstGeometricTransform *gt;
+  guint8 *in_data;
+  guint8 *out_data;
+  gint y0, y1;
+} GstGeometricTransformTask;
+
+static void
+gst_geometric_transform_task_func (gpointer data, gpointer user_data)
+{
+  GstGeometricTransformTask *task = data;
+  GstGeometricTransform *gt = task->gt;
+
+  gst_geometric_transform_process_rows (gt, task->in_data, task->out_data,
+      task->y0, task->y1);
+  g_slice_free (GstGeometricTransformTask, task);
+
+  g_mutex_lock (&gt->task_lock);
+  if (--gt->tasks_pending == 0)
+    g_cond_signal (&gt->task_cond);
+  g_mutex_unlock (&gt->task_lock);
+}
+
 static void
 gst_geometric_transform_before_transform (GstBaseTransform * trans,
     GstBuffer * outbuf)
@@ -231,7 +274,6 @@ gst_geometric_transform_transform_frame (GstVideoFilter * vfilter,
   GstGeometricTransformClass *klass;
   gint x, y, i;
   GstFlowReturn ret = GST_FLOW_OK;
-  gdouble *ptr;
   guint8 *in_data;
   guint8 *out_data;
 
@@ -262,14 +304,32 @@ gst_geometric_transform_transform_frame (GstVideoFilter * vfilter,
       gst_geometric_transform_generate_map (gt);
     }
     g_return_val_if_fail (gt->map, GST_FLOW_ERROR);
-    ptr = gt->map;
-    for (y = 0; y < gt->height; y++) {
-      for (x = 0; x < gt->width; x++) {
-        /* do the mapping */
-        gst_geometric_transform_do_map (gt, in_data, out_data, x, y, ptr[0],
-            ptr[1]);
-        ptr += 2;
+    if (gt->worker_pool && gt->height >= (gint) (8 * gt->n_workers)) {
+      guint b, n_bands = gt->n_workers;
+
+      g_mutex_lock (&gt->task_lock);
+      gt->tasks_pending = n_bands;
+      g_mutex_unlock (&gt->task_lock);
+
+      for (b = 0; b < n_bands; b++) {
+        GstGeometricTransformTask *task =
+            g_slice_new (GstGeometricTransformTask);
+
+        task->gt = gt;
+        task->in_data = in_data;
+        task->out_data = out_data;
+        task->y0 = gt->height * b / n_bands;
+        task->y1 = gt->height * (b + 1) / n_bands;
+        g_thread_pool_push (gt->worker_pool, task, NULL);
       }
+
+      g_mutex_lock (&gt->task_lock);
+      while (gt->tasks_pending > 0)
+        g_cond_wait (&gt->task_cond, &gt->task_lock);
+      g_mutex_unlock (&gt->task_lock);
+    } else {
+      gst_geometric_transform_process_rows (gt, in_data, out_data, 0,
+          gt->height);
     }
   } else {
     for (y = 0; y < gt->height; y++) {
@@ -331,6 +391,30 @@ gst_geometric_transform_get_property (GObject * object, guint prop_id,
 }
 
 
+/* more workers than this stop paying off: the per-band work becomes too
+ * small compared to the dispatch/wakeup cost even at 2160p */
+#define GST_GT_MAX_WORKERS 8
+
+static gboolean
+gst_geometric_transform_start (GstBaseTransform * trans)
+{
+  GstGeometricTransform *gt = GST_GEOMETRIC_TRANSFORM_CAST (trans);
+
+  gt->n_workers = MIN (g_get_num_processors (), GST_GT_MAX_WORKERS);
+  if (gt->n_workers > 1) {
+    gt->worker_pool = g_thread_pool_new (gst_geometric_transform_task_func,
+        gt, gt->n_workers, TRUE, NULL);
+    if (gt->worker_pool == NULL) {
+      GST_WARNING_OBJECT (gt,
+          "failed to create worker pool, mapping single-threaded");
+      gt->n_workers = 1;
+    }
+  }
+  gt->tasks_pending = 0;
+
+  return TRUE;
+}
+
 static gboolean
 gst_geometric_transform_stop (GstBaseTransform * trans)
 {
@@ -338,6 +422,11 @@ gst_geometric_transform_stop (GstBaseTransform * trans)
 
   GST_INFO_OBJECT (gt, "Deleting transform map");
 
+  if (gt->worker_pool) {
+    g_thread_pool_free (gt->worker_pool, FALSE, TRUE);
+    gt->worker_pool = NULL;
+  }
+
   gt->width = 0;
   gt->height = 0;
 
@@ -347,6 +436,17 @@ gst_geometric_transform_stop (GstBaseTransform * trans)
   return TRUE;
 }
 
+static void
+gst_geometric_transform_finalize (GObject * object)
+{
+  GstGeometricTransform *gt = GST_GEOMETRIC_TRANSFORM_CAST (object);
+
+  g_mutex_clear (&gt->task_lock);
+  g_cond_clear (&gt->task_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 static void
 gst_geometric_transform_base_init (gpointer g_class)
 {
@@ -373,7 +473,9 @@ gst_geometric_transform_class_init (gpointer klass, gpointer class_data)
 
   obj_class->set_property = gst_geometric_transform_set_property;
   obj_class->get_property = gst_geometric_transform_get_property;
+  obj_class->finalize = gst_geometric_transform_finalize;
 
+  trans_class->start = GST_DEBUG_FUNCPTR (gst_geometric_transform_start);
   trans_class->stop = GST_DEBUG_FUNCPTR (gst_geometric_transform_stop);
   trans_class->before_transform =
       GST_DEBUG_FUNCPTR (gst_geometric_transform_before_transform);
@@ -398,6 +500,9 @@ gst_geometric_transform_init (GTypeInstance * instance, gpointer g_class)
   gt->off_edge_pixels = DEFAULT_OFF_EDGE_PIXELS;
   gt->precalc_map = TRUE;
   gt->needs_remap = TRUE;
+
+  g_mutex_init (&gt->task_lock);
+  g_cond_init (&gt->task_cond);
 }
 
 GType
@@ -101,6 +101,13 @@ struct _GstGeometricTransform {
   gint off_edge_pixels;
 
   gdouble *map;
+
+  /* row-band parallelism over the precalculated map */
+  GThreadPool *worker_pool;
+  guint n_workers;
+  GMutex task_lock;
+  GCond task_cond;
+  guint tasks_pending;
 };
 
 struct _GstGeometricTransformClass {
@@ -64,12 +64,14 @@ enum
   PROP_0,
   PROP_WRITE_V1,
   PROP_WRITE_V2,
-  PROP_V2_MAJOR_VERSION
+  PROP_V2_MAJOR_VERSION,
+  PROP_V2_PADDING
 };
 
 #define DEFAULT_WRITE_V1 FALSE
 #define DEFAULT_WRITE_V2 TRUE
 #define DEFAULT_V2_MAJOR_VERSION 3
+#define DEFAULT_V2_PADDING 0
 
 static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
@@ -118,6 +120,22 @@ gst_id3_mux_class_init (GstId3MuxClass * klass)
           3, 4, DEFAULT_V2_MAJOR_VERSION,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstId3Mux:v2-padding:
+   *
+   * Extra zero padding (in bytes) to reserve at the end of the id3v2 tag,
+   * so that applications can later rewrite the tag in place without
+   * rewriting the whole file, as long as the new tag still fits. The tag
+   * is always padded up to the next 1024 byte boundary on top of this.
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, PROP_V2_PADDING,
+      g_param_spec_uint ("v2-padding", "Padding in id3v2 tag",
+          "Extra padding (in bytes) to reserve in the id3v2 tag for "
+          "later in-place tag rewrites", 0, G_MAXINT, DEFAULT_V2_PADDING,
+          G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
   GST_TAG_MUX_CLASS (klass)->render_start_tag =
       GST_DEBUG_FUNCPTR (gst_id3_mux_render_v2_tag);
   GST_TAG_MUX_CLASS (klass)->render_end_tag =
@@ -140,6 +158,7 @@ gst_id3_mux_init (GstId3Mux * id3mux)
   id3mux->write_v2 = DEFAULT_WRITE_V2;
 
   id3mux->v2_major_version = DEFAULT_V2_MAJOR_VERSION;
+  id3mux->v2_padding = DEFAULT_V2_PADDING;
 }
 
 static void
@@ -158,6 +177,9 @@ gst_id3_mux_set_property (GObject * object, guint prop_id,
     case PROP_V2_MAJOR_VERSION:
       mux->v2_major_version = g_value_get_int (value);
       break;
+    case PROP_V2_PADDING:
+      mux->v2_padding = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -180,6 +202,9 @@ gst_id3_mux_get_property (GObject * object, guint prop_id,
     case PROP_V2_MAJOR_VERSION:
       g_value_set_int (value, mux->v2_major_version);
       break;
+    case PROP_V2_PADDING:
+      g_value_set_uint (value, mux->v2_padding);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -192,7 +217,8 @@ gst_id3_mux_render_v2_tag (GstTagMux * mux, const GstTagList * taglist)
   GstId3Mux *id3mux = GST_ID3_MUX (mux);
 
   if (id3mux->write_v2)
-    return id3_mux_render_v2_tag (mux, taglist, id3mux->v2_major_version);
+    return id3_mux_render_v2_tag (mux, taglist, id3mux->v2_major_version,
+        id3mux->v2_padding);
   else
     return NULL;
 }
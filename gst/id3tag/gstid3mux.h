@@ -38,6 +38,7 @@ struct _GstId3Mux {
   gboolean write_v2;
 
   gint     v2_major_version;
+  guint    v2_padding;
 };
 
 struct _GstId3MuxClass {
@@ -189,7 +189,7 @@ id3v2_tag_unset (GstId3v2Tag * tag)
 #endif
 
 static GstBuffer *
-id3v2_tag_to_buffer (GstId3v2Tag * tag)
+id3v2_tag_to_buffer (GstId3v2Tag * tag, guint padding)
 {
   GstByteWriter *w;
   GstMapInfo info;
@@ -207,7 +207,10 @@ id3v2_tag_to_buffer (GstId3v2Tag * tag)
     size_frames += id3v2_frame_get_size (tag, frame);
   }
 
-  size = GST_ROUND_UP_1024 (10 + size_frames);
+  /* reserve the requested padding on top of the frames, so that a later
+   * metadata-only change can be rewritten in place as long as it still
+   * fits, and round up so the tag size stays stable for small changes */
+  size = GST_ROUND_UP_1024 (10 + size_frames + padding);
 
   w = gst_byte_writer_new (10);
   gst_byte_writer_write_uint8 (w, 'I');
@@ -1229,7 +1232,8 @@ foreach_add_tag (const GstTagList * list, const gchar * tag, gpointer userdata)
 }
 
 GstBuffer *
-id3_mux_render_v2_tag (GstTagMux * mux, const GstTagList * taglist, int version)
+id3_mux_render_v2_tag (GstTagMux * mux, const GstTagList * taglist, int version,
+    guint padding)
 {
   GstId3v2Tag tag;
   GstBuffer *buf;
@@ -1255,7 +1259,7 @@ id3_mux_render_v2_tag (GstTagMux * mux, const GstTagList * taglist, int version)
 #endif
 
   /* Create buffer with tag */
-  buf = id3v2_tag_to_buffer (&tag);
+  buf = id3v2_tag_to_buffer (&tag, padding);
   GST_LOG_OBJECT (mux, "tag size = %d bytes", (int) gst_buffer_get_size (buf));
 
   id3v2_tag_unset (&tag);
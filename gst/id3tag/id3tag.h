@@ -26,7 +26,8 @@ G_BEGIN_DECLS
 
 GstBuffer * id3_mux_render_v2_tag (GstTagMux        * mux,
                                    const GstTagList * taglist,
-                                   int                version);
+                                   int                version,
+                                   guint              padding);
 
 GstBuffer * id3_mux_render_v1_tag (GstTagMux        * mux,
                                    const GstTagList * taglist);
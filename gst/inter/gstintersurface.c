@@ -25,23 +25,24 @@
 
 #include "gstintersurface.h"
 
-static GList *list;
+/* name -> GstInterSurface, keys owned by the surfaces */
+static GHashTable *surfaces;
 static GMutex mutex;
 
 GstInterSurface *
 gst_inter_surface_get (const char *name)
 {
-  GList *g;
   GstInterSurface *surface;
 
   g_mutex_lock (&mutex);
-  for (g = list; g; g = g_list_next (g)) {
-    surface = g->data;
-    if (strcmp (name, surface->name) == 0) {
-      surface->ref_count++;
-      g_mutex_unlock (&mutex);
-      return surface;
-    }
+  if (G_UNLIKELY (surfaces == NULL))
+    surfaces = g_hash_table_new (g_str_hash, g_str_equal);
+
+  surface = g_hash_table_lookup (surfaces, name);
+  if (surface) {
+    surface->ref_count++;
+    g_mutex_unlock (&mutex);
+    return surface;
   }
 
   surface = g_malloc0 (sizeof (GstInterSurface));
@@ -52,8 +53,9 @@ gst_inter_surface_get (const char *name)
   surface->audio_buffer_time = DEFAULT_AUDIO_BUFFER_TIME;
   surface->audio_latency_time = DEFAULT_AUDIO_LATENCY_TIME;
   surface->audio_period_time = DEFAULT_AUDIO_PERIOD_TIME;
+  g_queue_init (&surface->video_queue);
 
-  list = g_list_append (list, surface);
+  g_hash_table_insert (surfaces, surface->name, surface);
   g_mutex_unlock (&mutex);
 
   return surface;
@@ -64,22 +66,16 @@ gst_inter_surface_unref (GstInterSurface * surface)
 {
   /* Mutex needed here, otherwise refcount might become 0
    * and someone else requests the same surface again before
-   * we remove it from the list */
+   * we remove it from the table */
   g_mutex_lock (&mutex);
   if ((--surface->ref_count) == 0) {
-    GList *g;
-
-    for (g = list; g; g = g_list_next (g)) {
-      GstInterSurface *tmp = g->data;
-      if (strcmp (tmp->name, surface->name) == 0) {
-        list = g_list_delete_link (list, g);
-        break;
-      }
-    }
+    g_hash_table_remove (surfaces, surface->name);
 
     g_mutex_clear (&surface->mutex);
     gst_buffer_replace (&surface->video_buffer, NULL);
     gst_buffer_replace (&surface->sub_buffer, NULL);
+    g_queue_foreach (&surface->video_queue, (GFunc) gst_buffer_unref, NULL);
+    g_queue_clear (&surface->video_queue);
     gst_object_unref (surface->audio_adapter);
     g_free (surface->name);
     g_free (surface);
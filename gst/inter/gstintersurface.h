@@ -48,6 +48,10 @@ struct _GstInterSurface
   GstBuffer *video_buffer;
   GstBuffer *sub_buffer;
   GstAdapter *audio_adapter;
+
+  /* queue of pending video frames from the sink; video_buffer holds the
+   * last popped frame so the src can repeat it when the queue runs dry */
+  GQueue video_queue;
 };
 
 #define DEFAULT_AUDIO_BUFFER_TIME  (GST_SECOND)
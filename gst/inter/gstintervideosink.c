@@ -66,10 +66,12 @@ static GstFlowReturn gst_inter_video_sink_show_frame (GstVideoSink * sink,
 enum
 {
   PROP_0,
-  PROP_CHANNEL
+  PROP_CHANNEL,
+  PROP_QUEUE_DEPTH
 };
 
 #define DEFAULT_CHANNEL ("default")
+#define DEFAULT_QUEUE_DEPTH (1)
 
 /* pad templates */
 static GstStaticPadTemplate gst_inter_video_sink_sink_template =
@@ -118,12 +120,20 @@ gst_inter_video_sink_class_init (GstInterVideoSinkClass * klass)
       g_param_spec_string ("channel", "Channel",
           "Channel name to match inter src and sink elements",
           DEFAULT_CHANNEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_QUEUE_DEPTH,
+      g_param_spec_uint ("queue-depth", "Queue depth",
+          "Maximum number of frames queued towards the src before the "
+          "oldest one is dropped",
+          1, G_MAXUINT, DEFAULT_QUEUE_DEPTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
 gst_inter_video_sink_init (GstInterVideoSink * intervideosink)
 {
   intervideosink->channel = g_strdup (DEFAULT_CHANNEL);
+  intervideosink->queue_depth = DEFAULT_QUEUE_DEPTH;
 }
 
 void
@@ -137,6 +147,9 @@ gst_inter_video_sink_set_property (GObject * object, guint property_id,
       g_free (intervideosink->channel);
       intervideosink->channel = g_value_dup_string (value);
       break;
+    case PROP_QUEUE_DEPTH:
+      intervideosink->queue_depth = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -153,6 +166,9 @@ gst_inter_video_sink_get_property (GObject * object, guint property_id,
     case PROP_CHANNEL:
       g_value_set_string (value, intervideosink->channel);
       break;
+    case PROP_QUEUE_DEPTH:
+      g_value_set_uint (value, intervideosink->queue_depth);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -214,6 +230,9 @@ gst_inter_video_sink_stop (GstBaseSink * sink)
     gst_buffer_unref (intervideosink->surface->video_buffer);
   }
   intervideosink->surface->video_buffer = NULL;
+  g_queue_foreach (&intervideosink->surface->video_queue,
+      (GFunc) gst_buffer_unref, NULL);
+  g_queue_clear (&intervideosink->surface->video_queue);
   memset (&intervideosink->surface->video_info, 0, sizeof (GstVideoInfo));
   g_mutex_unlock (&intervideosink->surface->mutex);
 
@@ -251,11 +270,15 @@ gst_inter_video_sink_show_frame (GstVideoSink * sink, GstBuffer * buffer)
       GST_TIME_ARGS (GST_BUFFER_PTS (buffer)));
 
   g_mutex_lock (&intervideosink->surface->mutex);
-  if (intervideosink->surface->video_buffer) {
-    gst_buffer_unref (intervideosink->surface->video_buffer);
+  while (g_queue_get_length (&intervideosink->surface->video_queue) >=
+      intervideosink->queue_depth) {
+    GstBuffer *old = g_queue_pop_head (&intervideosink->surface->video_queue);
+
+    GST_LOG_OBJECT (intervideosink, "dropping unconsumed frame %p", old);
+    gst_buffer_unref (old);
   }
-  intervideosink->surface->video_buffer = gst_buffer_ref (buffer);
-  intervideosink->surface->video_buffer_count = 0;
+  g_queue_push_tail (&intervideosink->surface->video_queue,
+      gst_buffer_ref (buffer));
   g_mutex_unlock (&intervideosink->surface->mutex);
 
   return GST_FLOW_OK;
@@ -40,6 +40,7 @@ struct _GstInterVideoSink
 
   GstInterSurface *surface;
   char *channel;
+  guint queue_depth;
 
   GstVideoInfo info;
 };
@@ -360,6 +360,16 @@ gst_inter_video_src_create (GstBaseSrc * src, guint64 offset, guint size,
     }
   }
 
+  if (!g_queue_is_empty (&intervideosrc->surface->video_queue)) {
+    /* A fresh frame from the sink; it becomes the frame we repeat if the
+     * queue runs dry later on */
+    if (intervideosrc->surface->video_buffer)
+      gst_buffer_unref (intervideosrc->surface->video_buffer);
+    intervideosrc->surface->video_buffer =
+        g_queue_pop_head (&intervideosrc->surface->video_queue);
+    intervideosrc->surface->video_buffer_count = 0;
+  }
+
   if (intervideosrc->surface->video_buffer) {
     /* We have a buffer to push */
     buffer = gst_buffer_ref (intervideosrc->surface->video_buffer);
@@ -442,10 +452,14 @@ gst_inter_video_src_create (GstBaseSrc * src, guint64 offset, guint size,
   }
 
   if (buffer == NULL) {
-    GST_DEBUG_OBJECT (intervideosrc, "Creating black frame");
-    buffer = gst_buffer_copy (intervideosrc->black_frame);
+    /* the black frame was pre-rendered in set_caps(); push it by ref
+     * like a repeated frame instead of regenerating it */
+    GST_DEBUG_OBJECT (intervideosrc, "Pushing black frame");
+    buffer = gst_buffer_ref (intervideosrc->black_frame);
   }
 
+  /* only copies the buffer metadata, the frame memory stays shared with
+   * the stored or black frame */
   buffer = gst_buffer_make_writable (buffer);
 
   if (is_gap)
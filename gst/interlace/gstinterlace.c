@@ -59,6 +59,7 @@
 
 #include <gst/gst.h>
 #include <gst/video/video.h>
+#include <gst/video/gstvideopool.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -105,6 +106,7 @@ struct _GstInterlace
   int fields_since_timebase;
   guint pattern_offset;         /* initial offset into the pattern */
   gboolean passthrough;
+  GstBufferPool *srcpool;       /* pool for the assembled output frames */
 };
 
 struct _GstInterlaceClass
@@ -416,6 +418,28 @@ gst_interlace_setcaps (GstInterlace * interlace, GstCaps * caps)
   }
 
   ret = gst_pad_set_caps (interlace->srcpad, othercaps);
+
+  /* Output frames in the copy path are assembled from fields of two
+   * different source frames, so they can never reuse an input buffer.
+   * Serve them from our own pool instead of allocating each one */
+  if (interlace->srcpool) {
+    gst_buffer_pool_set_active (interlace->srcpool, FALSE);
+    gst_object_unref (interlace->srcpool);
+    interlace->srcpool = NULL;
+  }
+  if (ret && !interlace->passthrough) {
+    GstStructure *config;
+
+    interlace->srcpool = gst_video_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (interlace->srcpool);
+    gst_buffer_pool_config_set_params (config, othercaps, info.size, 2, 0);
+    if (!gst_buffer_pool_set_config (interlace->srcpool, config) ||
+        !gst_buffer_pool_set_active (interlace->srcpool, TRUE)) {
+      GST_WARNING_OBJECT (interlace, "Failed to activate the output pool");
+      gst_object_unref (interlace->srcpool);
+      interlace->srcpool = NULL;
+    }
+  }
   gst_caps_unref (othercaps);
 
   interlace->info = info;
@@ -785,47 +809,55 @@ gst_interlace_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
   return ret;
 }
 
+/* Assembles an interlaced frame from two source frames in one pass:
+ * @field_index selects which field comes from @first, the other field is
+ * taken from @second. Mapping all three buffers only once (instead of
+ * mapping the destination again for every field) matters at 1080i sizes */
 static void
-copy_field (GstInterlace * interlace, GstBuffer * dest, GstBuffer * src,
-    int field_index)
+copy_fields (GstInterlace * interlace, GstBuffer * dest, GstBuffer * first,
+    GstBuffer * second, int field_index)
 {
   GstVideoInfo *info = &interlace->info;
   gint i, j, n_planes;
-  guint8 *d, *s;
-  GstVideoFrame dframe, sframe;
+  GstVideoFrame dframe, fframe, sframe;
 
   if (!gst_video_frame_map (&dframe, info, dest, GST_MAP_WRITE))
     goto dest_map_failed;
 
-  if (!gst_video_frame_map (&sframe, info, src, GST_MAP_READ))
-    goto src_map_failed;
+  if (!gst_video_frame_map (&fframe, info, first, GST_MAP_READ))
+    goto first_map_failed;
+
+  if (!gst_video_frame_map (&sframe, info, second, GST_MAP_READ))
+    goto second_map_failed;
 
   n_planes = GST_VIDEO_FRAME_N_PLANES (&dframe);
 
   for (i = 0; i < n_planes; i++) {
+    guint8 *d, *f, *s;
     gint cheight, cwidth;
-    gint ss, ds;
+    gint ds, fs, ss;
 
     d = GST_VIDEO_FRAME_PLANE_DATA (&dframe, i);
+    f = GST_VIDEO_FRAME_PLANE_DATA (&fframe, i);
     s = GST_VIDEO_FRAME_PLANE_DATA (&sframe, i);
 
     ds = GST_VIDEO_FRAME_PLANE_STRIDE (&dframe, i);
+    fs = GST_VIDEO_FRAME_PLANE_STRIDE (&fframe, i);
     ss = GST_VIDEO_FRAME_PLANE_STRIDE (&sframe, i);
 
-    d += field_index * ds;
-    s += field_index * ss;
-
     cheight = GST_VIDEO_FRAME_COMP_HEIGHT (&dframe, i);
-    cwidth = MIN (ABS (ss), ABS (ds));
+    cwidth = MIN (ABS (fs), MIN (ABS (ss), ABS (ds)));
 
-    for (j = field_index; j < cheight; j += 2) {
-      memcpy (d, s, cwidth);
-      d += ds * 2;
-      s += ss * 2;
+    for (j = 0; j < cheight; j++) {
+      if ((j & 1) == field_index)
+        memcpy (d + j * ds, f + j * fs, cwidth);
+      else
+        memcpy (d + j * ds, s + j * ss, cwidth);
     }
   }
 
   gst_video_frame_unmap (&dframe);
+  gst_video_frame_unmap (&fframe);
   gst_video_frame_unmap (&sframe);
   return;
 
@@ -834,12 +866,19 @@ dest_map_failed:
     GST_ERROR_OBJECT (interlace, "failed to map dest");
     return;
   }
-src_map_failed:
+first_map_failed:
   {
-    GST_ERROR_OBJECT (interlace, "failed to map src");
+    GST_ERROR_OBJECT (interlace, "failed to map first src");
     gst_video_frame_unmap (&dframe);
     return;
   }
+second_map_failed:
+  {
+    GST_ERROR_OBJECT (interlace, "failed to map second src");
+    gst_video_frame_unmap (&dframe);
+    gst_video_frame_unmap (&fframe);
+    return;
+  }
 }
 
 
@@ -920,13 +959,15 @@ gst_interlace_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
     if (interlace->stored_fields > 0) {
       GST_DEBUG ("1 field from stored, 1 from current");
 
-      output_buffer = gst_buffer_new_and_alloc (gst_buffer_get_size (buffer));
-      /* take the first field from the stored frame */
-      copy_field (interlace, output_buffer, interlace->stored_frame,
+      output_buffer = NULL;
+      if (interlace->srcpool == NULL ||
+          gst_buffer_pool_acquire_buffer (interlace->srcpool, &output_buffer,
+              NULL) != GST_FLOW_OK)
+        output_buffer = gst_buffer_new_and_alloc (gst_buffer_get_size (buffer));
+      /* first field from the stored frame, second from the incoming buffer */
+      copy_fields (interlace, output_buffer, interlace->stored_frame, buffer,
           interlace->field_index);
       interlace->stored_fields--;
-      /* take the second field from the incoming buffer */
-      copy_field (interlace, output_buffer, buffer, interlace->field_index ^ 1);
       current_fields--;
       n_output_fields = 2;
       interlaced = TRUE;
@@ -1040,11 +1081,16 @@ gst_interlace_get_property (GObject * object,
 static GstStateChangeReturn
 gst_interlace_change_state (GstElement * element, GstStateChange transition)
 {
-  //GstInterlace *interlace = GST_INTERLACE (element);
+  GstInterlace *interlace = GST_INTERLACE (element);
 
   switch (transition) {
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       //gst_interlace_reset (interlace);
+      if (interlace->srcpool) {
+        gst_buffer_pool_set_active (interlace->srcpool, FALSE);
+        gst_object_unref (interlace->srcpool);
+        interlace->srcpool = NULL;
+      }
       break;
     default:
       break;
@@ -82,7 +82,9 @@ enum
 
 /* pad templates */
 
-#define MAX_WIDTH 2048
+#define MAX_WIDTH 4096
+/* comb score above which a field pair is considered combed */
+#define THRESHOLD 100
 #define VIDEO_CAPS \
   "video/x-raw, " \
   "format = (string) { I420, Y444, Y42B }, " \
@@ -582,7 +584,6 @@ gst_ivtc_construct_frame (GstIvtc * ivtc, GstBuffer * outbuf)
   gst_video_frame_map (&dest_frame, &ivtc->src_video_info, outbuf,
       GST_MAP_WRITE);
 
-#define THRESHOLD 100
   if (prev_score < THRESHOLD) {
     if (forward_ok && next_score < prev_score) {
       reconstruct (ivtc, &dest_frame, anchor_index, anchor_index + 1);
@@ -634,6 +635,7 @@ get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom)
 {
   int j;
   int thisline[MAX_WIDTH];
+  guint8 combed[MAX_WIDTH];
   int score = 0;
   int height;
   int width;
@@ -641,6 +643,8 @@ get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom)
 
   height = GST_VIDEO_FRAME_COMP_HEIGHT (top, 0);
   width = GST_VIDEO_FRAME_COMP_WIDTH (top, 0);
+  if (width > MAX_WIDTH)
+    width = MAX_WIDTH;
 
   memset (thisline, 0, sizeof (thisline));
 
@@ -652,22 +656,42 @@ get_comb_score (GstVideoFrame * top, GstVideoFrame * bottom)
     guint8 *src2 = GET_LINE_IL (top, bottom, 0, j);
     guint8 *src3 = GET_LINE_IL (top, bottom, 0, j + 1);
     int i;
+    int any = 0;
+
+    /* the comb test is independent per pixel, so do it in its own pass
+     * that the compiler can vectorize, then run the sequential run-length
+     * scoring only on lines that have combed pixels at all */
+    for (i = 0; i < width; i++) {
+      combed[i] = src2[i] < MIN (src1[i], src3[i]) - 5 ||
+          src2[i] > MAX (src1[i], src3[i]) + 5;
+      any += combed[i];
+    }
+
+    if (!any) {
+      memset (thisline, 0, width * sizeof (int));
+      continue;
+    }
 
     for (i = 0; i < width; i++) {
-      if (src2[i] < MIN (src1[i], src3[i]) - 5 ||
-          src2[i] > MAX (src1[i], src3[i]) + 5) {
+      if (combed[i]) {
         if (i > 0) {
           thisline[i] += thisline[i - 1];
         }
         thisline[i]++;
         if (thisline[i] > 1000)
           thisline[i] = 1000;
+        if (thisline[i] > 100)
+          score++;
       } else {
         thisline[i] = 0;
       }
-      if (thisline[i] > 100) {
-        score++;
-      }
+    }
+
+    /* every decision made with this score only distinguishes values up to
+     * twice the comb threshold, so clearly combed pairs can stop early */
+    if (score > 2 * THRESHOLD) {
+      score = 2 * THRESHOLD + 1;
+      break;
     }
   }
 
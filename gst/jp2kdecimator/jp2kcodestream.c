@@ -22,6 +22,8 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include "jp2kcodestream.h"
 
 GST_DEBUG_CATEGORY_EXTERN (gst_jp2k_decimator_debug);
@@ -981,7 +983,20 @@ parse_packet (GstJP2kDecimator * self, GstByteReader * reader,
           break;
       }
 
-      gst_byte_reader_skip_unchecked (reader, 1);
+      /* Not a marker here; jump to the next 0xFF that could start one
+       * instead of re-peeking a marker at every byte position */
+      {
+        const guint8 *data = reader->data + reader->byte;
+        const guint8 *next = memchr (data + 1, 0xFF,
+            reader->size - reader->byte - 1);
+
+        if (next == NULL) {
+          GST_ERROR_OBJECT (self, "Truncated file");
+          ret = GST_FLOW_ERROR;
+          goto done;
+        }
+        gst_byte_reader_skip_unchecked (reader, next - data);
+      }
     }
   } else {
     GST_ERROR_OBJECT (self, "Either PLT or SOP are required");
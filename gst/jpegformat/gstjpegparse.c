@@ -284,22 +284,33 @@ gst_jpeg_parse_get_image_length (GstJpegParse * parse, GstMapInfo * mapinfo)
 
     if (gst_jpeg_parse_parse_tag_has_entropy_segment (value)) {
       guint eseglen = parse->last_entropy_len;
+      const guint8 *data = mapinfo->data;
 
       GST_DEBUG ("0x%08x: finding entropy segment length", offset + 2);
       noffset = offset + 2 + frame_len + eseglen;
       while (1) {
-        noffset = gst_byte_reader_masked_scan_uint32_peek (&reader, 0x0000ff00,
-            0x0000ff00, noffset, size - noffset, &value);
-        if (noffset < 0) {
+        const guint8 *match;
+
+        /* entropy coded data makes up nearly all of a typical image, so
+         * scan for the next 0xff byte with memchr(), which the C library
+         * vectorizes, instead of going byte by byte through the reader;
+         * we need the byte following the 0xff, hence the - 3 */
+        if (noffset + 4 > (gint) size)
+          match = NULL;
+        else
+          match = memchr (data + noffset + 2, 0xff, size - noffset - 3);
+        if (match == NULL) {
           /* need more data */
           parse->last_entropy_len = size - offset - 4 - frame_len - 2;
           goto need_more_data;
         }
-        if ((value & 0xff) != 0x00) {
+        noffset = match - data - 2;
+        if (data[noffset + 3] != 0x00) {
           eseglen = noffset - offset - frame_len - 2;
           break;
         }
-        noffset++;
+        /* stuffed 0x00 byte, continue after it */
+        noffset += 2;
       }
       parse->last_entropy_len = 0;
       frame_len += eseglen;
@@ -76,9 +76,8 @@ static gboolean gst_rfb_src_negotiate (GstBaseSrc * bsrc);
 static gboolean gst_rfb_src_stop (GstBaseSrc * bsrc);
 static gboolean gst_rfb_src_event (GstBaseSrc * bsrc, GstEvent * event);
 static gboolean gst_rfb_src_unlock (GstBaseSrc * bsrc);
-static gboolean gst_rfb_src_decide_allocation (GstBaseSrc * bsrc,
-    GstQuery * query);
-static GstFlowReturn gst_rfb_src_fill (GstPushSrc * psrc, GstBuffer * outbuf);
+static GstFlowReturn gst_rfb_src_create (GstPushSrc * psrc,
+    GstBuffer ** outbuf);
 
 #define gst_rfb_src_parent_class parent_class
 G_DEFINE_TYPE (GstRfbSrc, gst_rfb_src, GST_TYPE_PUSH_SRC);
@@ -152,9 +151,7 @@ gst_rfb_src_class_init (GstRfbSrcClass * klass)
   gstbasesrc_class->stop = GST_DEBUG_FUNCPTR (gst_rfb_src_stop);
   gstbasesrc_class->event = GST_DEBUG_FUNCPTR (gst_rfb_src_event);
   gstbasesrc_class->unlock = GST_DEBUG_FUNCPTR (gst_rfb_src_unlock);
-  gstpushsrc_class->fill = GST_DEBUG_FUNCPTR (gst_rfb_src_fill);
-  gstbasesrc_class->decide_allocation =
-      GST_DEBUG_FUNCPTR (gst_rfb_src_decide_allocation);
+  gstpushsrc_class->create = GST_DEBUG_FUNCPTR (gst_rfb_src_create);
 
   gstelement_class = GST_ELEMENT_CLASS (klass);
 
@@ -338,56 +335,6 @@ gst_rfb_src_get_property (GObject * object, guint prop_id,
   }
 }
 
-static gboolean
-gst_rfb_src_decide_allocation (GstBaseSrc * bsrc, GstQuery * query)
-{
-  GstBufferPool *pool = NULL;
-  guint size, min = 1, max = 0;
-  GstStructure *config;
-  GstCaps *caps;
-  GstVideoInfo info;
-  gboolean ret;
-
-  gst_query_parse_allocation (query, &caps, NULL);
-
-  if (!caps || !gst_video_info_from_caps (&info, caps))
-    return FALSE;
-
-  while (gst_query_get_n_allocation_pools (query) > 0) {
-    gst_query_parse_nth_allocation_pool (query, 0, &pool, &size, &min, &max);
-
-    /* TODO We restrict to the exact size as we don't support strides or
-     * special padding */
-    if (size == info.size)
-      break;
-
-    gst_query_remove_nth_allocation_pool (query, 0);
-    gst_object_unref (pool);
-    pool = NULL;
-  }
-
-  if (pool == NULL) {
-    /* we did not get a pool, make one ourselves then */
-    pool = gst_video_buffer_pool_new ();
-    size = info.size;
-    min = 1;
-    max = 0;
-
-    if (gst_query_get_n_allocation_pools (query) > 0)
-      gst_query_set_nth_allocation_pool (query, 0, pool, size, min, max);
-    else
-      gst_query_add_allocation_pool (query, pool, size, min, max);
-  }
-
-  config = gst_buffer_pool_get_config (pool);
-  gst_buffer_pool_config_set_params (config, caps, size, min, max);
-
-  ret = gst_buffer_pool_set_config (pool, config);
-  gst_object_unref (pool);
-
-  return ret;
-}
-
 static gboolean
 gst_rfb_src_negotiate (GstBaseSrc * bsrc)
 {
@@ -472,6 +419,11 @@ gst_rfb_src_negotiate (GstBaseSrc * bsrc)
   if (decoder->use_copyrect)
     decoder->prev_frame = g_malloc (vinfo.size);
 
+  /* the framebuffer is pushed downstream wrapped in a buffer, without
+   * copying; the buffer owns the memory */
+  src->frame_size = vinfo.size;
+  src->frame_buffer = gst_buffer_new_wrapped (decoder->frame, vinfo.size);
+
   caps = gst_video_info_to_caps (&vinfo);
 
   gst_base_src_set_caps (bsrc, caps);
@@ -488,7 +440,12 @@ gst_rfb_src_stop (GstBaseSrc * bsrc)
 
   rfb_decoder_disconnect (src->decoder);
 
-  if (src->decoder->frame) {
+  if (src->frame_buffer) {
+    /* the buffer owns the framebuffer memory */
+    gst_buffer_unref (src->frame_buffer);
+    src->frame_buffer = NULL;
+    src->decoder->frame = NULL;
+  } else if (src->decoder->frame) {
     g_free (src->decoder->frame);
     src->decoder->frame = NULL;
   }
@@ -502,11 +459,22 @@ gst_rfb_src_stop (GstBaseSrc * bsrc)
 }
 
 static GstFlowReturn
-gst_rfb_src_fill (GstPushSrc * psrc, GstBuffer * outbuf)
+gst_rfb_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
 {
   GstRfbSrc *src = GST_RFB_SRC (psrc);
   RfbDecoder *decoder = src->decoder;
-  GstMapInfo info;
+
+  /* copy on write: if downstream still holds a ref to the buffer we
+   * pushed last time, leave that memory to it and decode the next update
+   * into a fresh copy of the framebuffer */
+  if (!gst_buffer_is_writable (src->frame_buffer)) {
+    guint8 *frame = g_malloc (src->frame_size);
+
+    memcpy (frame, decoder->frame, src->frame_size);
+    gst_buffer_unref (src->frame_buffer);
+    decoder->frame = frame;
+    src->frame_buffer = gst_buffer_new_wrapped (frame, src->frame_size);
+  }
 
   rfb_decoder_send_update_request (decoder, src->incremental_update,
       decoder->offset_x, decoder->offset_y, decoder->rect_width,
@@ -527,19 +495,11 @@ gst_rfb_src_fill (GstPushSrc * psrc, GstBuffer * outbuf)
     }
   }
 
-  if (!gst_buffer_map (outbuf, &info, GST_MAP_WRITE)) {
-    GST_ELEMENT_ERROR (src, RESOURCE, WRITE,
-        ("Could not map the output frame"), (NULL));
-    return GST_FLOW_ERROR;
-  }
-
-  memcpy (info.data, decoder->frame, info.size);
-
-  GST_BUFFER_PTS (outbuf) =
+  GST_BUFFER_PTS (src->frame_buffer) =
       gst_clock_get_time (GST_ELEMENT_CLOCK (src)) -
       GST_ELEMENT_CAST (src)->base_time;
 
-  gst_buffer_unmap (outbuf, &info);
+  *outbuf = gst_buffer_ref (src->frame_buffer);
 
   return GST_FLOW_OK;
 }
@@ -59,6 +59,11 @@ struct _GstRfbSrc
   gboolean incremental_update;
   gboolean view_only;
 
+  /* buffer wrapping the decoder framebuffer, pushed downstream without a
+   * copy; replaced by a fresh copy when downstream still holds a ref */
+  GstBuffer *frame_buffer;
+  gsize frame_size;
+
   guint button_mask;
 
   /* protocol version */
@@ -64,6 +64,11 @@
 
 #define DURATION_SCAN_LIMIT         4 * 1024 * 1024
 
+/* Minimum SCR distance between two entries of the seek index, one entry
+ * per second keeps the index small while still landing a seek within one
+ * scan of the target */
+#define SCR_INDEX_SPACING           CLOCK_FREQ
+
 typedef enum
 {
   SCAN_SCR,
@@ -71,6 +76,13 @@ typedef enum
   SCAN_PTS
 } SCAN_MODE;
 
+/* An SCR observed at a byte offset, recorded while playing or seeking */
+typedef struct
+{
+  guint64 scr;
+  guint64 offset;
+} GstPsDemuxIndexEntry;
+
 /* We clamp scr delta with 0 so negative bytes won't be possible */
 #define GSTTIME_TO_BYTES(time) \
   ((time != -1) ? gst_util_uint64_scale (MAX(0,(gint64) (GSTTIME_TO_MPEGTIME(time))), demux->scr_rate_n, demux->scr_rate_d) : -1)
@@ -277,6 +289,8 @@ gst_ps_demux_init (GstPsDemux * demux)
   demux->adapter = gst_adapter_new ();
   demux->rev_adapter = gst_adapter_new ();
   demux->flowcombiner = gst_flow_combiner_new ();
+  demux->scr_index =
+      g_array_new (FALSE, FALSE, sizeof (GstPsDemuxIndexEntry));
 
   gst_ps_demux_reset (demux);
 }
@@ -291,6 +305,7 @@ gst_ps_demux_finalize (GstPsDemux * demux)
   gst_flow_combiner_free (demux->flowcombiner);
   g_object_unref (demux->adapter);
   g_object_unref (demux->rev_adapter);
+  g_array_free (demux->scr_index, TRUE);
 
   G_OBJECT_CLASS (parent_class)->finalize (G_OBJECT (demux));
 }
@@ -324,6 +339,7 @@ gst_ps_demux_reset (GstPsDemux * demux)
 
   gst_adapter_clear (demux->adapter);
   gst_adapter_clear (demux->rev_adapter);
+  g_array_set_size (demux->scr_index, 0);
 
   demux->adapter_offset = G_MAXUINT64;
   demux->first_scr = G_MAXUINT64;
@@ -1127,6 +1143,101 @@ not_supported:
   }
 }
 
+/* Record an SCR/byte-offset pair in the seek index, keeping the array
+ * sorted by SCR. Entries closer than SCR_INDEX_SPACING to an existing one
+ * are dropped to keep the index sparse. While playing forward this is a
+ * plain append, only seeks insert in the middle. */
+static void
+gst_ps_demux_index_add (GstPsDemux * demux, guint64 scr, guint64 offset)
+{
+  GArray *index = demux->scr_index;
+  GstPsDemuxIndexEntry entry, *neighbour;
+  guint lo, hi;
+
+  entry.scr = scr;
+  entry.offset = offset;
+
+  if (index->len == 0) {
+    g_array_append_val (index, entry);
+    return;
+  }
+
+  /* common case during playback, we are past the last entry */
+  neighbour = &g_array_index (index, GstPsDemuxIndexEntry, index->len - 1);
+  if (scr >= neighbour->scr) {
+    if (scr - neighbour->scr >= SCR_INDEX_SPACING
+        && offset > neighbour->offset)
+      g_array_append_val (index, entry);
+    return;
+  }
+
+  /* find the first entry with a larger SCR */
+  lo = 0;
+  hi = index->len;
+  while (lo < hi) {
+    guint mid = (lo + hi) / 2;
+
+    if (g_array_index (index, GstPsDemuxIndexEntry, mid).scr <= scr)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  /* only insert if both neighbours agree, an SCR discont could otherwise
+   * break the ordering the lookup relies on */
+  if (lo > 0) {
+    neighbour = &g_array_index (index, GstPsDemuxIndexEntry, lo - 1);
+    if (scr - neighbour->scr < SCR_INDEX_SPACING
+        || offset <= neighbour->offset)
+      return;
+  }
+  neighbour = &g_array_index (index, GstPsDemuxIndexEntry, lo);
+  if (neighbour->scr - scr < SCR_INDEX_SPACING || offset >= neighbour->offset)
+    return;
+
+  g_array_insert_val (index, lo, entry);
+}
+
+/* Tighten the search window around the requested SCR with the closest
+ * entries of the seek index */
+static void
+gst_ps_demux_index_search (GstPsDemux * demux, guint64 scr,
+    guint64 * min_scr, guint64 * min_scr_offset,
+    guint64 * max_scr, guint64 * max_scr_offset)
+{
+  GArray *index = demux->scr_index;
+  guint lo = 0, hi = index->len;
+
+  /* find the first entry with a larger SCR */
+  while (lo < hi) {
+    guint mid = (lo + hi) / 2;
+
+    if (g_array_index (index, GstPsDemuxIndexEntry, mid).scr <= scr)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo > 0) {
+    GstPsDemuxIndexEntry *entry =
+        &g_array_index (index, GstPsDemuxIndexEntry, lo - 1);
+
+    if (entry->scr > *min_scr) {
+      *min_scr = entry->scr;
+      *min_scr_offset = entry->offset;
+    }
+  }
+  if (lo < index->len) {
+    GstPsDemuxIndexEntry *entry =
+        &g_array_index (index, GstPsDemuxIndexEntry, lo);
+
+    if (entry->scr < *max_scr) {
+      *max_scr = entry->scr;
+      *max_scr_offset = entry->offset;
+    }
+  }
+}
+
 #define MAX_RECURSION_COUNT 100
 
 /* Binary search for requested SCR */
@@ -1148,8 +1259,11 @@ find_offset (GstPsDemux * demux, guint64 scr,
       MIN (gst_util_uint64_scale (scr - min_scr, scr_rate_n,
           scr_rate_d), demux->sink_segment.stop);
 
-  if (!gst_ps_demux_scan_forward_ts (demux, &offset, SCAN_SCR, &fscr, 0)) {
-    gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
+  if (gst_ps_demux_scan_forward_ts (demux, &offset, SCAN_SCR, &fscr, 0) ||
+      gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0)) {
+    /* remember what this probe found so later seeks nearby start from
+     * here instead of interpolating from scratch */
+    gst_ps_demux_index_add (demux, fscr, offset);
   }
 
   if (fscr == scr || fscr == min_scr || fscr == max_scr) {
@@ -1170,6 +1284,7 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
 {
   gboolean found;
   guint64 fscr, offset;
+  guint64 min_scr, min_scr_offset, max_scr, max_scr_offset;
   guint64 scr = GSTTIME_TO_MPEGTIME (seeksegment->position + demux->base_time);
 
   /* In some clips the PTS values are completely unaligned with SCR values.
@@ -1185,9 +1300,22 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
   GST_INFO_OBJECT (demux, "sink segment configured %" GST_SEGMENT_FORMAT
       ", trying to go at SCR: %" G_GUINT64_FORMAT, &demux->sink_segment, scr);
 
-  offset =
-      find_offset (demux, scr, demux->first_scr, demux->first_scr_offset,
-      demux->last_scr, demux->last_scr_offset, 0);
+  /* start from the whole stream and let the index collected so far narrow
+   * the window, with a populated index this converges in a single probe */
+  min_scr = demux->first_scr;
+  min_scr_offset = demux->first_scr_offset;
+  max_scr = demux->last_scr;
+  max_scr_offset = demux->last_scr_offset;
+  gst_ps_demux_index_search (demux, scr, &min_scr, &min_scr_offset,
+      &max_scr, &max_scr_offset);
+
+  if (max_scr > min_scr) {
+    offset = find_offset (demux, scr, min_scr, min_scr_offset,
+        max_scr, max_scr_offset, 0);
+  } else {
+    /* the index already knows this exact SCR */
+    offset = min_scr_offset;
+  }
 
   if (offset == (guint64) - 1) {
     return FALSE;
@@ -1207,6 +1335,9 @@ gst_ps_demux_do_seek (GstPsDemux * demux, GstSegment * seeksegment)
     found = gst_ps_demux_scan_backward_ts (demux, &offset, SCAN_SCR, &fscr, 0);
   }
 
+  if (found)
+    gst_ps_demux_index_add (demux, fscr, offset);
+
   GST_INFO_OBJECT (demux, "doing seek at offset %" G_GUINT64_FORMAT
       " SCR: %" G_GUINT64_FORMAT " %" GST_TIME_FORMAT,
       offset, fscr, GST_TIME_ARGS (MPEGTIME_TO_GSTTIME (fscr)));
@@ -1831,6 +1962,12 @@ gst_ps_demux_parse_pack_start (GstPsDemux * demux)
     }
   }
 
+  /* remember where we saw this SCR, a later seek can then binary search
+   * the index instead of scanning the file. The index stores unadjusted
+   * SCRs, the same timeline the seek scans observe */
+  if (demux->adapter_offset != G_MAXUINT64)
+    gst_ps_demux_index_add (demux, scr, demux->cur_scr_offset);
+
   /* update the current_scr and rate members */
   demux->mux_rate = new_rate;
   demux->current_scr = scr_adjusted;
@@ -134,6 +134,10 @@ struct _GstPsDemux
   guint64 last_scr_offset;
   guint64 cur_scr_offset;
 
+  /* sparse SCR/byte-offset index collected while playing and seeking,
+   * sorted by SCR, used to narrow the search window of later seeks */
+  GArray *scr_index;
+
   guint64 first_pts;
   guint64 last_pts;
 
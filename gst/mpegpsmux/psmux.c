@@ -54,7 +54,7 @@
 #include "psmux.h"
 #include "crc.h"
 
-static gboolean psmux_packet_out (PsMux * mux);
+static gboolean psmux_packet_out (PsMux * mux, GstBuffer * buf);
 static gboolean psmux_write_pack_header (PsMux * mux);
 static gboolean psmux_write_system_header (PsMux * mux);
 static gboolean psmux_write_program_stream_map (PsMux * mux);
@@ -114,8 +114,15 @@ psmux_set_write_func (PsMux * mux, PsMuxWriteFunc func, void *user_data)
 gboolean
 psmux_write_end_code (PsMux * mux)
 {
-  guint8 end_code[4] = { 0, 0, 1, PSMUX_PROGRAM_END };
-  return mux->write_func (end_code, 4, mux->write_func_data);
+  static const guint8 end_code[4] = { 0, 0, 1, PSMUX_PROGRAM_END };
+  GstBuffer *buf;
+
+  if (G_UNLIKELY (mux->write_func == NULL))
+    return TRUE;
+
+  buf = gst_buffer_new_allocate (NULL, 4, NULL);
+  gst_buffer_fill (buf, 0, end_code, 4);
+  return mux->write_func (buf, mux->write_func_data);
 }
 
 
@@ -147,6 +154,11 @@ psmux_free (PsMux * mux)
   if (mux->psm != NULL)
     gst_buffer_unref (mux->psm);
 
+  if (mux->packet_pool != NULL) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+  }
+
   g_slice_free (PsMux, mux);
 }
 
@@ -202,20 +214,54 @@ psmux_create_stream (PsMux * mux, PsMuxStreamType stream_type)
   return stream;
 }
 
+/* Get a buffer to write the next packet into. Packets are served from a
+ * pool of PSMUX_MAX_PACKET_LEN sized buffers and trimmed down to the
+ * written length before they are handed to the write func */
+static GstBuffer *
+psmux_packet_buffer_new (PsMux * mux)
+{
+  GstBuffer *buf = NULL;
+
+  if (G_UNLIKELY (mux->packet_pool == NULL)) {
+    GstStructure *config;
+
+    mux->packet_pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (mux->packet_pool);
+    gst_buffer_pool_config_set_params (config, NULL, PSMUX_MAX_PACKET_LEN,
+        2, 0);
+    if (!gst_buffer_pool_set_config (mux->packet_pool, config) ||
+        !gst_buffer_pool_set_active (mux->packet_pool, TRUE)) {
+      GST_WARNING ("Failed to activate the packet pool");
+      gst_object_unref (mux->packet_pool);
+      mux->packet_pool = NULL;
+    }
+  }
+
+  if (mux->packet_pool == NULL ||
+      gst_buffer_pool_acquire_buffer (mux->packet_pool, &buf,
+          NULL) != GST_FLOW_OK)
+    buf = gst_buffer_new_and_alloc (PSMUX_MAX_PACKET_LEN);
+
+  return buf;
+}
+
+/* Pass @buf to the write func, transferring ownership */
 static gboolean
-psmux_packet_out (PsMux * mux)
+psmux_packet_out (PsMux * mux, GstBuffer * buf)
 {
   gboolean res;
-  if (G_UNLIKELY (mux->write_func == NULL))
+  gsize size = gst_buffer_get_size (buf);
+
+  if (G_UNLIKELY (mux->write_func == NULL)) {
+    gst_buffer_unref (buf);
     return TRUE;
+  }
 
-  res = mux->write_func (mux->packet_buf, mux->packet_bytes_written,
-      mux->write_func_data);
+  res = mux->write_func (buf, mux->write_func_data);
 
   if (res) {
-    mux->bit_size += mux->packet_bytes_written;
+    mux->bit_size += size;
   }
-  mux->packet_bytes_written = 0;
   return res;
 }
 
@@ -280,13 +326,28 @@ psmux_write_stream_packet (PsMux * mux, PsMuxStream * stream)
   }
 
   /* Write the packet */
-  if (!(mux->packet_bytes_written =
-          psmux_stream_get_data (stream, mux->packet_buf,
-              mux->pes_max_payload + PSMUX_PES_MAX_HDR_LEN))) {
-    return FALSE;
-  }
+  {
+    GstBuffer *buf = psmux_packet_buffer_new (mux);
+    GstMapInfo map;
+    guint len;
+
+    if (!gst_buffer_map (buf, &map, GST_MAP_WRITE)) {
+      gst_buffer_unref (buf);
+      return FALSE;
+    }
 
-  res = psmux_packet_out (mux);
+    len = psmux_stream_get_data (stream, map.data,
+        mux->pes_max_payload + PSMUX_PES_MAX_HDR_LEN);
+    gst_buffer_unmap (buf, &map);
+
+    if (len == 0) {
+      gst_buffer_unref (buf);
+      return FALSE;
+    }
+
+    gst_buffer_set_size (buf, len);
+    res = psmux_packet_out (mux, buf);
+  }
   if (!res) {
     GST_DEBUG_OBJECT (mux, "packet write false");
     return FALSE;
@@ -301,12 +362,20 @@ static gboolean
 psmux_write_pack_header (PsMux * mux)
 {
   bits_buffer_t bw;
+  GstBuffer *buf;
+  GstMapInfo map;
   guint64 scr = mux->pts;       /* XXX: is this correct? necessary to put any offset? */
   if (mux->pts == -1)
     scr = 0;
 
+  buf = psmux_packet_buffer_new (mux);
+  if (!gst_buffer_map (buf, &map, GST_MAP_WRITE)) {
+    gst_buffer_unref (buf);
+    return FALSE;
+  }
+
   /* pack_start_code */
-  bits_initwrite (&bw, 14, mux->packet_buf);
+  bits_initwrite (&bw, 14, map.data);
   bits_write (&bw, 24, PSMUX_START_CODE_PREFIX);
   bits_write (&bw, 8, PSMUX_PACK_HEADER);
 
@@ -334,8 +403,9 @@ psmux_write_pack_header (PsMux * mux)
   bits_write (&bw, 5, 0x1f);
   bits_write (&bw, 3, 0);       /* pack_stuffing_length */
 
-  mux->packet_bytes_written = 14;
-  return psmux_packet_out (mux);
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_set_size (buf, 14);
+  return psmux_packet_out (mux, buf);
 }
 
 static void
@@ -396,16 +466,10 @@ psmux_ensure_system_header (PsMux * mux)
 static gboolean
 psmux_write_system_header (PsMux * mux)
 {
-  GstMapInfo map;
-
   psmux_ensure_system_header (mux);
 
-  gst_buffer_map (mux->sys_header, &map, GST_MAP_READ);
-  memcpy (mux->packet_buf, map.data, map.size);
-  mux->packet_bytes_written = map.size;
-  gst_buffer_unmap (mux->sys_header, &map);
-
-  return psmux_packet_out (mux);
+  /* the cached header is passed out as-is, no copy needed */
+  return psmux_packet_out (mux, gst_buffer_ref (mux->sys_header));
 }
 
 static void
@@ -480,16 +544,10 @@ psmux_ensure_program_stream_map (PsMux * mux)
 static gboolean
 psmux_write_program_stream_map (PsMux * mux)
 {
-  GstMapInfo map;
-
   psmux_ensure_program_stream_map (mux);
 
-  gst_buffer_map (mux->psm, &map, GST_MAP_READ);
-  memcpy (mux->packet_buf, map.data, map.size);
-  mux->packet_bytes_written = map.size;
-  gst_buffer_unmap (mux->psm, &map);
-
-  return psmux_packet_out (mux);
+  /* the cached map is passed out as-is, no copy needed */
+  return psmux_packet_out (mux, gst_buffer_ref (mux->psm));
 }
 
 GList *
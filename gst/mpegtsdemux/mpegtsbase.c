@@ -63,6 +63,7 @@ enum
 {
   PROP_0,
   PROP_PARSE_PRIVATE_SECTIONS,
+  PROP_STATISTICS,
   /* FILL ME */
 };
 
@@ -141,6 +142,10 @@ mpegts_base_class_init (MpegTSBaseClass * klass)
       g_param_spec_boolean ("parse-private-sections", "Parse private sections",
           "Parse private sections", FALSE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_STATISTICS,
+      g_param_spec_boxed ("statistics", "Statistics",
+          "Various PCR health statistics of the incoming stream",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
   klass->sink_query = GST_DEBUG_FUNCPTR (mpegts_base_default_sink_query);
 }
@@ -170,6 +175,10 @@ mpegts_base_get_property (GObject * object, guint prop_id,
     case PROP_PARSE_PRIVATE_SECTIONS:
       g_value_set_boolean (value, base->parse_private_sections);
       break;
+    case PROP_STATISTICS:
+      g_value_take_boxed (value,
+          mpegts_packetizer_get_statistics (base->packetizer));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -182,23 +191,23 @@ mpegts_base_reset (MpegTSBase * base)
   MpegTSBaseClass *klass = GST_MPEGTS_BASE_GET_CLASS (base);
 
   mpegts_packetizer_clear (base->packetizer);
-  memset (base->is_pes, 0, 1024);
-  memset (base->known_psi, 0, 1024);
+  memset (base->is_pes, 0, 8192);
+  memset (base->known_psi, 0, 8192);
 
   /* FIXME : Actually these are not *always* know SI streams
    * depending on the variant of mpeg-ts being used. */
 
   /* Known PIDs : PAT, TSDT, IPMP CIT */
-  MPEGTS_BIT_SET (base->known_psi, 0);
-  MPEGTS_BIT_SET (base->known_psi, 2);
-  MPEGTS_BIT_SET (base->known_psi, 3);
+  MPEGTS_PID_SET (base->known_psi, 0);
+  MPEGTS_PID_SET (base->known_psi, 2);
+  MPEGTS_PID_SET (base->known_psi, 3);
   /* TDT, TOT, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x14);
+  MPEGTS_PID_SET (base->known_psi, 0x14);
   /* network synchronization */
-  MPEGTS_BIT_SET (base->known_psi, 0x15);
+  MPEGTS_PID_SET (base->known_psi, 0x15);
 
   /* ATSC */
-  MPEGTS_BIT_SET (base->known_psi, 0x1ffb);
+  MPEGTS_PID_SET (base->known_psi, 0x1ffb);
 
   if (base->pat) {
     g_ptr_array_unref (base->pat);
@@ -242,8 +251,8 @@ mpegts_base_init (MpegTSBase * base)
       NULL, (GDestroyNotify) mpegts_base_free_program);
 
   base->parse_private_sections = FALSE;
-  base->is_pes = g_new0 (guint8, 1024);
-  base->known_psi = g_new0 (guint8, 1024);
+  base->is_pes = g_new0 (guint8, 8192);
+  base->known_psi = g_new0 (guint8, 8192);
   base->program_size = sizeof (MpegTSBaseProgram);
   base->stream_size = sizeof (MpegTSBaseStream);
 
@@ -417,11 +426,11 @@ mpegts_base_add_program (MpegTSBase * base,
   program = mpegts_base_new_program (base, program_number, pmt_pid);
 
   /* Mark the PMT PID as being a known PSI PID */
-  if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi, pmt_pid))) {
+  if (G_UNLIKELY (MPEGTS_PID_IS_SET (base->known_psi, pmt_pid))) {
     GST_FIXME ("Refcounting. Setting twice a PID (0x%04x) as known PSI",
         pmt_pid);
   }
-  MPEGTS_BIT_SET (base->known_psi, pmt_pid);
+  MPEGTS_PID_SET (base->known_psi, pmt_pid);
 
   g_hash_table_insert (base->programs,
       GINT_TO_POINTER (program_number), program);
@@ -856,9 +865,9 @@ mpegts_base_deactivate_program (MpegTSBase * base, MpegTSBaseProgram * program)
       if (!mpegts_pid_in_active_programs (base, stream->pid)) {
         if (_stream_is_private_section (stream)) {
           if (base->parse_private_sections)
-            MPEGTS_BIT_UNSET (base->known_psi, stream->pid);
+            MPEGTS_PID_UNSET (base->known_psi, stream->pid);
         } else {
-          MPEGTS_BIT_UNSET (base->is_pes, stream->pid);
+          MPEGTS_PID_UNSET (base->is_pes, stream->pid);
         }
       }
     }
@@ -867,7 +876,7 @@ mpegts_base_deactivate_program (MpegTSBase * base, MpegTSBaseProgram * program)
     /* FIXME : This might actually be shared with another stream ? */
     mpegts_base_program_remove_stream (base, program, program->pcr_pid);
     if (!mpegts_pid_in_active_programs (base, program->pcr_pid))
-      MPEGTS_BIT_UNSET (base->is_pes, program->pcr_pid);
+      MPEGTS_PID_UNSET (base->is_pes, program->pcr_pid);
 
     GST_DEBUG ("program stream_list is now %p", program->stream_list);
   }
@@ -909,19 +918,19 @@ mpegts_base_activate_program (MpegTSBase * base, MpegTSBaseProgram * program,
     GstMpegtsPMTStream *stream = g_ptr_array_index (pmt->streams, i);
     if (_stream_is_private_section (stream)) {
       if (base->parse_private_sections)
-        MPEGTS_BIT_SET (base->known_psi, stream->pid);
+        MPEGTS_PID_SET (base->known_psi, stream->pid);
     } else {
-      if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->is_pes, stream->pid)))
+      if (G_UNLIKELY (MPEGTS_PID_IS_SET (base->is_pes, stream->pid)))
         GST_FIXME
             ("Refcounting issue. Setting twice a PID (0x%04x) as known PES",
             stream->pid);
-      if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi, stream->pid))) {
+      if (G_UNLIKELY (MPEGTS_PID_IS_SET (base->known_psi, stream->pid))) {
         GST_FIXME
             ("Refcounting issue. Setting a known PSI PID (0x%04x) as known PES",
             stream->pid);
-        MPEGTS_BIT_UNSET (base->known_psi, stream->pid);
+        MPEGTS_PID_UNSET (base->known_psi, stream->pid);
       }
-      MPEGTS_BIT_SET (base->is_pes, stream->pid);
+      MPEGTS_PID_SET (base->is_pes, stream->pid);
     }
     mpegts_base_program_add_stream (base, program,
         stream->pid, stream->stream_type, stream);
@@ -929,7 +938,7 @@ mpegts_base_activate_program (MpegTSBase * base, MpegTSBaseProgram * program,
   /* We add the PCR pid last. If that PID is already used by one of the media
    * streams above, no new stream will be created */
   mpegts_base_program_add_stream (base, program, pmt->pcr_pid, -1, NULL);
-  MPEGTS_BIT_SET (base->is_pes, pmt->pcr_pid);
+  MPEGTS_PID_SET (base->is_pes, pmt->pcr_pid);
 
   program->active = TRUE;
   program->initial_program = initial_program;
@@ -980,15 +989,15 @@ mpegts_base_apply_pat (MpegTSBase * base, GstMpegtsSection * section)
           /* FIXME: when this happens it may still be pmt pid of another
            * program, so setting to False may make it go through expensive
            * path in is_psi unnecessarily */
-          MPEGTS_BIT_UNSET (base->known_psi, program->pmt_pid);
+          MPEGTS_PID_UNSET (base->known_psi, program->pmt_pid);
         }
 
         program->pmt_pid = patp->network_or_program_map_PID;
-        if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi, program->pmt_pid)))
+        if (G_UNLIKELY (MPEGTS_PID_IS_SET (base->known_psi, program->pmt_pid)))
           GST_FIXME
               ("Refcounting issue. Setting twice a PMT PID (0x%04x) as know PSI",
               program->pmt_pid);
-        MPEGTS_BIT_SET (base->known_psi, patp->network_or_program_map_PID);
+        MPEGTS_PID_SET (base->known_psi, patp->network_or_program_map_PID);
       }
     } else {
       /* Create a new program */
@@ -1034,13 +1043,13 @@ mpegts_base_apply_pat (MpegTSBase * base, GstMpegtsSection * section)
       /* FIXME: when this happens it may still be pmt pid of another
        * program, so setting to False may make it go through expensive
        * path in is_psi unnecessarily */
-      if (G_UNLIKELY (MPEGTS_BIT_IS_SET (base->known_psi,
+      if (G_UNLIKELY (MPEGTS_PID_IS_SET (base->known_psi,
                   patp->network_or_program_map_PID))) {
         GST_FIXME
             ("Program refcounting : Setting twice a pid (0x%04x) as known PSI",
             patp->network_or_program_map_PID);
       }
-      MPEGTS_BIT_SET (base->known_psi, patp->network_or_program_map_PID);
+      MPEGTS_PID_SET (base->known_psi, patp->network_or_program_map_PID);
       mpegts_packetizer_remove_stream (base->packetizer,
           patp->network_or_program_map_PID);
     }
@@ -1204,7 +1213,7 @@ mpegts_base_parse_atsc_mgt (MpegTSBase * base, GstMpegtsSection * section)
             table->table_type <= GST_MPEGTS_ATSC_MGT_TABLE_TYPE_EIT127) ||
         (table->table_type >= GST_MPEGTS_ATSC_MGT_TABLE_TYPE_ETT0 &&
             table->table_type <= GST_MPEGTS_ATSC_MGT_TABLE_TYPE_ETT127)) {
-      MPEGTS_BIT_SET (base->known_psi, table->pid);
+      MPEGTS_PID_SET (base->known_psi, table->pid);
     }
   }
 
@@ -1434,12 +1443,12 @@ mpegts_base_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       klass->inspect_packet (base, &packet);
 
     /* If it's a known PES, push it */
-    if (MPEGTS_BIT_IS_SET (base->is_pes, packet.pid)) {
+    if (MPEGTS_PID_IS_SET (base->is_pes, packet.pid)) {
       /* push the packet downstream */
       if (base->push_data)
         res = klass->push (base, &packet, NULL);
     } else if (packet.payload
-        && MPEGTS_BIT_IS_SET (base->known_psi, packet.pid)) {
+        && MPEGTS_PID_IS_SET (base->known_psi, packet.pid)) {
       /* base PSI data */
       GList *others, *tmp;
       GstMpegtsSection *section;
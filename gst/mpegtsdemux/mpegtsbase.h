@@ -127,8 +127,9 @@ struct _MpegTSBase {
   GPtrArray  *pat;
   MpegTSPacketizer2 *packetizer;
 
-  /* arrays that say whether a pid is a known psi pid or a pes pid */
-  /* Use MPEGTS_BIT_* to set/unset/check the values */
+  /* flat one-byte-per-PID tables that say whether a pid is a known psi
+   * pid or a pes pid */
+  /* Use MPEGTS_PID_* to set/unset/check the values */
   guint8 *known_psi;
   guint8 *is_pes;
 
@@ -216,9 +217,12 @@ struct _MpegTSBaseClass {
   gboolean (*sink_query) (MpegTSBase *base, GstQuery * query);
 };
 
-#define MPEGTS_BIT_SET(field, offs)    ((field)[(offs) >> 3] |=  (1 << ((offs) & 0x7)))
-#define MPEGTS_BIT_UNSET(field, offs)  ((field)[(offs) >> 3] &= ~(1 << ((offs) & 0x7)))
-#define MPEGTS_BIT_IS_SET(field, offs) ((field)[(offs) >> 3] &   (1 << ((offs) & 0x7)))
+/* The known_psi/is_pes tables use one byte per PID so that the per-packet
+ * fast path is a direct indexed load instead of a shift/mask on a packed
+ * bit array. 8192 entries keeps each table well within the L1 cache. */
+#define MPEGTS_PID_SET(table, pid)    ((table)[(pid)] = 1)
+#define MPEGTS_PID_UNSET(table, pid)  ((table)[(pid)] = 0)
+#define MPEGTS_PID_IS_SET(table, pid) ((table)[(pid)])
 
 G_GNUC_INTERNAL GType mpegts_base_get_type(void);
 
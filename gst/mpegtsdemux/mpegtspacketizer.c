@@ -49,6 +49,9 @@ G_DEFINE_TYPE_EXTENDED (MpegTSPacketizer2, mpegts_packetizer, G_TYPE_OBJECT, 0,
 #define PACKETIZER_GROUP_UNLOCK(p) g_mutex_unlock(&((p)->group_lock))
 
 static void mpegts_packetizer_dispose (GObject * object);
+static void
+mpegts_packetizer_stream_subtable_free (MpegTSPacketizerStreamSubtable *
+    subtable);
 static void mpegts_packetizer_finalize (GObject * object);
 static GstClockTime calculate_skew (MpegTSPacketizer2 * packetizer,
     MpegTSPCR * pcr, guint64 pcrtime, GstClockTime time);
@@ -83,6 +86,7 @@ get_pcr_table (MpegTSPacketizer2 * packetizer, guint16 pid)
     res->base_time = GST_CLOCK_TIME_NONE;
     res->base_pcrtime = GST_CLOCK_TIME_NONE;
     res->last_pcrtime = GST_CLOCK_TIME_NONE;
+    res->stat_last_pcrtime = GST_CLOCK_TIME_NONE;
     res->window_pos = 0;
     res->window_filling = TRUE;
     res->window_min = 0;
@@ -134,21 +138,84 @@ mpegts_packetizer_get_current_time (MpegTSPacketizer2 * packetizer,
       pcr_pid);
 }
 
-static inline MpegTSPacketizerStreamSubtable *
-find_subtable (GSList * subtables, guint8 table_id, guint16 subtable_extension)
+/* Update the PCR health statistics with a newly observed PCR.
+ * Must be called with the group lock taken */
+static void
+record_pcr_stats (MpegTSPacketizer2 * packetizer, MpegTSPCR * pcrtable,
+    guint64 pcr)
 {
-  GSList *tmp;
+  GstClockTime pcrtime = PCRTIME_TO_GSTTIME (pcr);
+
+  packetizer->stat_pcr_count += 1;
 
-  /* FIXME: Make this an array ! */
-  for (tmp = subtables; tmp; tmp = tmp->next) {
-    MpegTSPacketizerStreamSubtable *sub =
-        (MpegTSPacketizerStreamSubtable *) tmp->data;
-    if (sub->table_id == table_id
-        && sub->subtable_extension == subtable_extension)
-      return sub;
+  if (GST_CLOCK_TIME_IS_VALID (pcrtable->stat_last_pcrtime)) {
+    if (G_UNLIKELY (pcrtime < pcrtable->stat_last_pcrtime)) {
+      /* Backwards PCR are either a wraparound (the 33/9 bit PCR rolls
+       * over roughly every 26.5h) or a genuine discontinuity */
+      if (pcrtable->stat_last_pcrtime - pcrtime > PCR_GST_MAX_VALUE / 2)
+        packetizer->stat_pcr_wraparounds += 1;
+      else
+        packetizer->stat_pcr_disconts += 1;
+    } else {
+      GstClockTime interval = pcrtime - pcrtable->stat_last_pcrtime;
+
+      if (G_UNLIKELY (interval > 500 * GST_MSECOND)) {
+        packetizer->stat_pcr_disconts += 1;
+      } else if (interval < 20 * GST_MSECOND) {
+        packetizer->stat_pcr_interval_histogram[0] += 1;
+      } else if (interval < 40 * GST_MSECOND) {
+        packetizer->stat_pcr_interval_histogram[1] += 1;
+      } else if (interval < 100 * GST_MSECOND) {
+        packetizer->stat_pcr_interval_histogram[2] += 1;
+      } else {
+        packetizer->stat_pcr_interval_histogram[3] += 1;
+      }
+    }
   }
 
-  return NULL;
+  pcrtable->stat_last_pcrtime = pcrtime;
+}
+
+GstStructure *
+mpegts_packetizer_get_statistics (MpegTSPacketizer2 * packetizer)
+{
+  GstStructure *res;
+  guint64 group_count = 0;
+  guint i;
+
+  PACKETIZER_GROUP_LOCK (packetizer);
+
+  for (i = 0; i < packetizer->lastobsid; i++)
+    group_count += g_list_length (packetizer->observations[i]->groups);
+
+  res = gst_structure_new ("mpegts-packetizer-statistics",
+      "pcr-count", G_TYPE_UINT64, packetizer->stat_pcr_count,
+      "pcr-intervals-0-20ms", G_TYPE_UINT64,
+      packetizer->stat_pcr_interval_histogram[0],
+      "pcr-intervals-20-40ms", G_TYPE_UINT64,
+      packetizer->stat_pcr_interval_histogram[1],
+      "pcr-intervals-40-100ms", G_TYPE_UINT64,
+      packetizer->stat_pcr_interval_histogram[2],
+      "pcr-intervals-above-100ms", G_TYPE_UINT64,
+      packetizer->stat_pcr_interval_histogram[3],
+      "pcr-discontinuities", G_TYPE_UINT64, packetizer->stat_pcr_disconts,
+      "pcr-wraparounds", G_TYPE_UINT64, packetizer->stat_pcr_wraparounds,
+      "pcr-offset-group-count", G_TYPE_UINT64, group_count, NULL);
+
+  PACKETIZER_GROUP_UNLOCK (packetizer);
+
+  return res;
+}
+
+#define SUBTABLE_KEY(table_id, subtable_extension) \
+  GUINT_TO_POINTER (((guint) (table_id) << 16) | (subtable_extension))
+
+static inline MpegTSPacketizerStreamSubtable *
+find_subtable (GHashTable * subtables, guint8 table_id,
+    guint16 subtable_extension)
+{
+  return g_hash_table_lookup (subtables,
+      SUBTABLE_KEY (table_id, subtable_extension));
 }
 
 static gboolean
@@ -199,7 +266,8 @@ mpegts_packetizer_stream_new (guint16 pid)
 
   stream = (MpegTSPacketizerStream *) g_new0 (MpegTSPacketizerStream, 1);
   stream->continuity_counter = CONTINUITY_UNSET;
-  stream->subtables = NULL;
+  stream->subtables = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+      NULL, (GDestroyNotify) mpegts_packetizer_stream_subtable_free);
   stream->table_id = TABLE_ID_UNSET;
   stream->pid = pid;
   return stream;
@@ -227,9 +295,7 @@ static void
 mpegts_packetizer_stream_free (MpegTSPacketizerStream * stream)
 {
   mpegts_packetizer_clear_section (stream);
-  g_slist_foreach (stream->subtables,
-      (GFunc) mpegts_packetizer_stream_subtable_free, NULL);
-  g_slist_free (stream->subtables);
+  g_hash_table_unref (stream->subtables);
   g_free (stream);
 }
 
@@ -393,17 +459,15 @@ mpegts_packetizer_parse_adaptation_field_control (MpegTSPacketizer2 *
         GST_TIME_ARGS (PCRTIME_TO_GSTTIME (packet->pcr)), packet->offset);
 
     PACKETIZER_GROUP_LOCK (packetizer);
+    pcrtable = get_pcr_table (packetizer, packet->pid);
+    record_pcr_stats (packetizer, pcrtable, packet->pcr);
     if (packetizer->calculate_skew
         && GST_CLOCK_TIME_IS_VALID (packetizer->last_in_time)) {
-      pcrtable = get_pcr_table (packetizer, packet->pid);
       calculate_skew (packetizer, pcrtable, packet->pcr,
           packetizer->last_in_time);
     }
-    if (packetizer->calculate_offset) {
-      if (!pcrtable)
-        pcrtable = get_pcr_table (packetizer, packet->pid);
+    if (packetizer->calculate_offset)
       record_pcr (packetizer, pcrtable, packet->pcr, packet->offset);
-    }
     PACKETIZER_GROUP_UNLOCK (packetizer);
   }
 #ifndef GST_DISABLE_GST_DEBUG
@@ -516,7 +580,8 @@ mpegts_packetizer_parse_section_header (MpegTSPacketizer2 * packetizer,
         stream->subtable_extension, stream->last_section_number);
     subtable->version_number = stream->version_number;
 
-    stream->subtables = g_slist_prepend (stream->subtables, subtable);
+    g_hash_table_insert (stream->subtables,
+        SUBTABLE_KEY (stream->table_id, stream->subtable_extension), subtable);
   }
 
   GST_MEMDUMP ("Full section data", stream->section_data,
@@ -739,9 +804,16 @@ mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
   data = packetizer->map_data + packetizer->map_offset;
 
   for (i = 0; i + 3 * MPEGTS_MAX_PACKETSIZE < size; i++) {
-    /* find a sync byte */
-    if (data[i] != PACKET_SYNC_BYTE)
-      continue;
+    /* find the next sync byte. memchr() is vectorized in any modern libc,
+     * which makes skipping over garbage much cheaper than a byte loop */
+    guint8 *pos = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 3 * MPEGTS_MAX_PACKETSIZE - i);
+
+    if (pos == NULL) {
+      i = size - 3 * MPEGTS_MAX_PACKETSIZE;
+      break;
+    }
+    i = pos - data;
 
     /* check for 4 consecutive sync bytes with each possible packet size */
     for (j = 0; j < G_N_ELEMENTS (psizes); j++) {
@@ -797,8 +869,18 @@ mpegts_packetizer_sync (MpegTSPacketizer2 * packetizer)
     sync_offset = 0;
 
   for (i = sync_offset; i + 2 * packet_size < size; i++) {
-    if (data[i] == PACKET_SYNC_BYTE &&
-        data[i + packet_size] == PACKET_SYNC_BYTE &&
+    /* let memchr() (vectorized in the libc) locate the next sync byte
+     * candidate instead of testing every byte ourselves */
+    guint8 *pos = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 2 * packet_size - i);
+
+    if (pos == NULL) {
+      i = size - 2 * packet_size;
+      break;
+    }
+    i = pos - data;
+
+    if (data[i + packet_size] == PACKET_SYNC_BYTE &&
         data[i + 2 * packet_size] == PACKET_SYNC_BYTE) {
       found = TRUE;
       break;
@@ -85,7 +85,8 @@ typedef struct
   guint8  section_number;
   guint8  last_section_number;
 
-  GSList *subtables;
+  /* Seen subtables, keyed by (table_id << 16) | subtable_extension */
+  GHashTable *subtables;
 
   /* Upstream offset of the data contained in the section */
   guint64 offset;
@@ -239,8 +240,17 @@ typedef struct _MpegTSPCR
 
   /* Current PCR/offset observations (used to update pcroffsets) */
   PCROffsetCurrent *current;
+
+  /* Last PCR time seen for statistics, regardless of whether skew or
+   * offset calculation is active */
+  GstClockTime stat_last_pcrtime;
 } MpegTSPCR;
 
+/* Number of buckets in the PCR interval histogram. The boundaries are
+ * chosen around the specified maximum PCR intervals (40ms for DVB,
+ * 100ms for ATSC): 0-20ms, 20-40ms, 40-100ms, more than 100ms */
+#define PCR_INTERVAL_HISTOGRAM_N 4
+
 struct _MpegTSPacketizer2 {
   GObject     parent;
 
@@ -283,6 +293,12 @@ struct _MpegTSPacketizer2 {
   MpegTSPCR *observations[MAX_PCR_OBS_CHANNELS];
   guint8 lastobsid;
   GstClockTime pcr_discont_threshold;
+
+  /* PCR health statistics, protected by group_lock */
+  guint64 stat_pcr_count;
+  guint64 stat_pcr_interval_histogram[PCR_INTERVAL_HISTOGRAM_N];
+  guint64 stat_pcr_disconts;
+  guint64 stat_pcr_wraparounds;
 };
 
 struct _MpegTSPacketizer2Class {
@@ -376,6 +392,8 @@ mpegts_packetizer_set_reference_offset (MpegTSPacketizer2 * packetizer,
 G_GNUC_INTERNAL void
 mpegts_packetizer_set_pcr_discont_threshold (MpegTSPacketizer2 * packetizer,
 					GstClockTime threshold);
+G_GNUC_INTERNAL GstStructure *
+mpegts_packetizer_get_statistics (MpegTSPacketizer2 * packetizer);
 G_END_DECLS
 
 #endif /* GST_MPEGTS_PACKETIZER_H */
@@ -217,25 +217,25 @@ mpegts_parse_reset (MpegTSBase * base)
   /* Set the various know PIDs we are interested in */
 
   /* CAT */
-  MPEGTS_BIT_SET (base->known_psi, 1);
+  MPEGTS_PID_SET (base->known_psi, 1);
   /* NIT, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x10);
+  MPEGTS_PID_SET (base->known_psi, 0x10);
   /* SDT, BAT, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x11);
+  MPEGTS_PID_SET (base->known_psi, 0x11);
   /* EIT, ST, CIT (TS 102 323) */
-  MPEGTS_BIT_SET (base->known_psi, 0x12);
+  MPEGTS_PID_SET (base->known_psi, 0x12);
   /* RST, ST */
-  MPEGTS_BIT_SET (base->known_psi, 0x13);
+  MPEGTS_PID_SET (base->known_psi, 0x13);
   /* RNT (TS 102 323) */
-  MPEGTS_BIT_SET (base->known_psi, 0x16);
+  MPEGTS_PID_SET (base->known_psi, 0x16);
   /* inband signalling */
-  MPEGTS_BIT_SET (base->known_psi, 0x1c);
+  MPEGTS_PID_SET (base->known_psi, 0x1c);
   /* measurement */
-  MPEGTS_BIT_SET (base->known_psi, 0x1d);
+  MPEGTS_PID_SET (base->known_psi, 0x1d);
   /* DIT */
-  MPEGTS_BIT_SET (base->known_psi, 0x1e);
+  MPEGTS_PID_SET (base->known_psi, 0x1e);
   /* SIT */
-  MPEGTS_BIT_SET (base->known_psi, 0x1f);
+  MPEGTS_PID_SET (base->known_psi, 0x1f);
 
   parse->first = TRUE;
   parse->have_group_id = FALSE;
@@ -168,6 +168,9 @@ struct _TSDemuxStream
   guint current_size;
   /* Size of ->data */
   guint allocated_size;
+  /* Size of the biggest unbounded PES seen so far, used to size the
+   * initial allocation for the following ones (0 if none seen yet) */
+  guint allocation_hint;
 
   /* Current PTS/DTS for this stream (in running time) */
   GstClockTime pts;
@@ -2349,11 +2352,13 @@ gst_ts_demux_parse_pes_header (GstTSDemux * demux, TSDemuxStream * stream,
   data += header.header_size;
   length -= header.header_size;
 
-  /* Create the output buffer */
+  /* Create the output buffer. For unbounded PES (i.e. video) start out
+   * with the size of the previous ones, so that steady-state streams
+   * assemble without any realloc/copy cycle */
   if (stream->expected_size)
     stream->allocated_size = MAX (stream->expected_size, length);
   else
-    stream->allocated_size = MAX (8192, length);
+    stream->allocated_size = MAX (MAX (8192, stream->allocation_hint), length);
 
   g_assert (stream->data == NULL);
   stream->data = g_malloc (stream->allocated_size);
@@ -2877,6 +2882,12 @@ gst_ts_demux_push_pending_data (GstTSDemux * demux, TSDemuxStream * stream,
     goto beach;
   }
 
+  /* Remember how big unbounded PES get on this stream so the next one
+   * can be allocated to fit from the start */
+  if (stream->expected_size == 0)
+    stream->allocation_hint = MAX (stream->allocation_hint,
+        stream->current_size);
+
   if (G_UNLIKELY (demux->program == NULL)) {
     GST_LOG_OBJECT (demux, "No program");
     g_free (stream->data);
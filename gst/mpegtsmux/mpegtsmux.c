@@ -404,6 +404,12 @@ mpegtsmux_reset (MpegTsMux * mux, gboolean alloc)
   if (mux->out_adapter)
     gst_adapter_clear (mux->out_adapter);
 
+  if (mux->packet_pool) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+    mux->packet_pool = NULL;
+  }
+
   if (mux->tsmux) {
     tsmux_free (mux->tsmux);
     mux->tsmux = NULL;
@@ -1900,13 +1906,37 @@ static void
 alloc_packet_cb (GstBuffer ** _buf, void *user_data)
 {
   MpegTsMux *mux = (MpegTsMux *) user_data;
-  GstBuffer *buf;
-  gint offset = 0;
+  GstBuffer *buf = NULL;
+  guint size;
 
+  size = NORMAL_TS_PACKET_LENGTH;
   if (mux->m2ts_mode == TRUE)
-    offset = 4;
+    size += 4;
+
+  /* High bitrate muxing means tens of thousands of packets per second;
+   * recycle the packet buffers through a pool instead of hitting the
+   * allocator for each one */
+  if (G_UNLIKELY (mux->packet_pool != NULL && mux->packet_pool_size != size)) {
+    gst_buffer_pool_set_active (mux->packet_pool, FALSE);
+    gst_object_unref (mux->packet_pool);
+    mux->packet_pool = NULL;
+  }
+
+  if (G_UNLIKELY (mux->packet_pool == NULL)) {
+    GstStructure *config;
+
+    mux->packet_pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (mux->packet_pool);
+    gst_buffer_pool_config_set_params (config, NULL, size, 64, 0);
+    gst_buffer_pool_set_config (mux->packet_pool, config);
+    gst_buffer_pool_set_active (mux->packet_pool, TRUE);
+    mux->packet_pool_size = size;
+  }
+
+  if (gst_buffer_pool_acquire_buffer (mux->packet_pool, &buf,
+          NULL) != GST_FLOW_OK)
+    buf = gst_buffer_new_and_alloc (size);
 
-  buf = gst_buffer_new_and_alloc (NORMAL_TS_PACKET_LENGTH + offset);
   gst_buffer_set_size (buf, NORMAL_TS_PACKET_LENGTH);
 
   *_buf = buf;
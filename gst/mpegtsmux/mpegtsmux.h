@@ -164,6 +164,10 @@ struct MpegTsMux {
   GstAdapter *out_adapter;
   GstBuffer *out_buffer;
 
+  /* pool recycling the per-packet output buffers */
+  GstBufferPool *packet_pool;
+  guint packet_pool_size;
+
 #if 0
   /* SPN/PTS index handling */
   GstIndex *element_index;
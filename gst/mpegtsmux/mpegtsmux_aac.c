@@ -96,8 +96,7 @@ mpegtsmux_prepare_aac (GstBuffer * buf, MpegTsPadData * data, MpegTsMux * mux)
   gsize out_size = gst_buffer_get_size (buf) + 7;
   GstBuffer *out_buf = gst_buffer_new_and_alloc (out_size);
   gsize out_offset = 0;
-  guint8 rate_idx = 0, channels = 0, obj_type = 0;
-  GstMapInfo codec_data_map;
+  guint8 *adts_static;
   GstMapInfo buf_map;
 
   GST_DEBUG_OBJECT (mux, "Preparing AAC buffer for output");
@@ -105,28 +104,45 @@ mpegtsmux_prepare_aac (GstBuffer * buf, MpegTsPadData * data, MpegTsMux * mux)
   gst_buffer_copy_into (out_buf, buf,
       GST_BUFFER_COPY_METADATA | GST_BUFFER_COPY_TIMESTAMPS, 0, 0);
 
-  gst_buffer_map (data->codec_data, &codec_data_map, GST_MAP_READ);
+  /* The codec-data derived part of the ADTS header never changes for a
+   * stream, parse it only on the first buffer */
+  if (data->prepare_data == NULL) {
+    guint8 rate_idx = 0, channels = 0, obj_type = 0;
+    GstMapInfo codec_data_map;
+
+    gst_buffer_map (data->codec_data, &codec_data_map, GST_MAP_READ);
+
+    obj_type = GST_READ_UINT8 (codec_data_map.data) >> 3;
+    rate_idx = (GST_READ_UINT8 (codec_data_map.data) & 0x7) << 1;
+    rate_idx |= (GST_READ_UINT8 (codec_data_map.data + 1) & 0x80) >> 7;
+    channels = (GST_READ_UINT8 (codec_data_map.data + 1) & 0x78) >> 3;
+    GST_DEBUG_OBJECT (mux, "Rate index %u, channels %u, object type %u",
+        rate_idx, channels, obj_type);
+
+    gst_buffer_unmap (data->codec_data, &codec_data_map);
+
+    adts_static = g_new0 (guint8, 4);
+    /* Sync point over a full byte */
+    adts_static[0] = 0xFF;
+    /* Sync point continued over first 4 bits + static 4 bits
+     * (ID, layer, protection)*/
+    adts_static[1] = 0xF1;
+    /* Object type over first 2 bits */
+    adts_static[2] = (obj_type - 1) << 6;
+    /* rate index over next 4 bits */
+    adts_static[2] |= (rate_idx << 2);
+    /* channels over last 2 bits */
+    adts_static[2] |= (channels & 0x4) >> 2;
+    /* channels continued over next 2 bits + 4 bits at zero */
+    adts_static[3] = (channels & 0x3) << 6;
+
+    data->prepare_data = adts_static;
+    data->free_func = g_free;
+  }
+  adts_static = data->prepare_data;
 
   /* Generate ADTS header */
-  obj_type = GST_READ_UINT8 (codec_data_map.data) >> 3;
-  rate_idx = (GST_READ_UINT8 (codec_data_map.data) & 0x7) << 1;
-  rate_idx |= (GST_READ_UINT8 (codec_data_map.data + 1) & 0x80) >> 7;
-  channels = (GST_READ_UINT8 (codec_data_map.data + 1) & 0x78) >> 3;
-  GST_DEBUG_OBJECT (mux, "Rate index %u, channels %u, object type %u", rate_idx,
-      channels, obj_type);
-  /* Sync point over a full byte */
-  adts_header[0] = 0xFF;
-  /* Sync point continued over first 4 bits + static 4 bits
-   * (ID, layer, protection)*/
-  adts_header[1] = 0xF1;
-  /* Object type over first 2 bits */
-  adts_header[2] = (obj_type - 1) << 6;
-  /* rate index over next 4 bits */
-  adts_header[2] |= (rate_idx << 2);
-  /* channels over last 2 bits */
-  adts_header[2] |= (channels & 0x4) >> 2;
-  /* channels continued over next 2 bits + 4 bits at zero */
-  adts_header[3] = (channels & 0x3) << 6;
+  memcpy (adts_header, adts_static, 4);
   /* frame size over last 2 bits */
   adts_header[3] |= (out_size & 0x1800) >> 11;
   /* frame size continued over full byte */
@@ -148,7 +164,6 @@ mpegtsmux_prepare_aac (GstBuffer * buf, MpegTsPadData * data, MpegTsMux * mux)
   /* Now copy complete frame */
   gst_buffer_fill (out_buf, out_offset, buf_map.data, buf_map.size);
 
-  gst_buffer_unmap (data->codec_data, &codec_data_map);
   gst_buffer_unmap (buf, &buf_map);
 
   return out_buf;
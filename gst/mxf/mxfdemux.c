@@ -116,7 +116,8 @@ enum
   PROP_0,
   PROP_PACKAGE,
   PROP_MAX_DRIFT,
-  PROP_STRUCTURE
+  PROP_STRUCTURE,
+  PROP_PARSE_DESCRIPTIVE_METADATA
 };
 
 static gboolean gst_mxf_demux_sink_event (GstPad * pad, GstObject * parent,
@@ -522,31 +523,39 @@ gst_mxf_demux_resolve_references (GstMXFDemux * demux)
     m->resolved = MXF_METADATA_BASE_RESOLVE_STATE_NONE;
   }
 
-  g_hash_table_iter_init (&iter, demux->metadata);
-  while (g_hash_table_iter_next (&iter, NULL, (gpointer) & m)) {
-    gboolean resolved;
-
-    resolved = mxf_metadata_base_resolve (m, demux->metadata);
+  if (!demux->preface) {
+    GST_ERROR_OBJECT (demux, "No preface");
+    ret = GST_FLOW_ERROR;
+    goto error;
+  }
 
-    /* Resolving can fail for anything but the preface, as the preface
-     * will resolve everything required */
-    if (!resolved && MXF_IS_METADATA_PREFACE (m)) {
-      ret = GST_FLOW_ERROR;
-      goto error;
-    }
+  /* Resolving the preface recursively resolves everything the demuxer
+   * dereferences afterwards. Sets that are not reachable from it (e.g.
+   * unreferenced descriptive metadata) stay unresolved instead of being
+   * resolved up front, which can take seconds on broadcast masters with
+   * large DMS-1 trees */
+  if (!mxf_metadata_base_resolve (MXF_METADATA_BASE (demux->preface),
+          demux->metadata)) {
+    ret = GST_FLOW_ERROR;
+    goto error;
   }
 
   demux->metadata_resolved = TRUE;
 
-  structure =
-      mxf_metadata_base_to_structure (MXF_METADATA_BASE (demux->preface));
-  if (!demux->tags)
-    demux->tags = gst_tag_list_new_empty ();
+  /* Serializing the whole metadata tree into a structure is pure enrichment
+   * and can take longer than everything else here on large files; it stays
+   * available on demand through the "structure" property */
+  if (demux->parse_descriptive_metadata) {
+    structure =
+        mxf_metadata_base_to_structure (MXF_METADATA_BASE (demux->preface));
+    if (!demux->tags)
+      demux->tags = gst_tag_list_new_empty ();
 
-  gst_tag_list_add (demux->tags, GST_TAG_MERGE_REPLACE, GST_TAG_MXF_STRUCTURE,
-      structure, NULL);
+    gst_tag_list_add (demux->tags, GST_TAG_MERGE_REPLACE, GST_TAG_MXF_STRUCTURE,
+        structure, NULL);
 
-  gst_structure_free (structure);
+    gst_structure_free (structure);
+  }
 
   g_rw_lock_writer_unlock (&demux->metadata_lock);
 
@@ -1442,6 +1451,11 @@ gst_mxf_demux_handle_descriptive_metadata (GstMXFDemux * demux,
   GstFlowReturn ret = GST_FLOW_OK;
   MXFDescriptiveMetadata *m = NULL, *old = NULL;
 
+  if (!demux->parse_descriptive_metadata) {
+    GST_DEBUG_OBJECT (demux, "Skipping descriptive metadata");
+    return GST_FLOW_OK;
+  }
+
   scheme = GST_READ_UINT8 (key->u + 12);
   type = GST_READ_UINT24_BE (key->u + 13);
 
@@ -3693,8 +3707,8 @@ collect_index_table_segments (GstMXFDemux * demux)
   for (l = demux->pending_index_table_segments; l; l = l->next) {
     MXFIndexTableSegment *segment = l->data;
     GstMXFDemuxIndexTable *t = NULL;
-    GList *k;
-    guint64 start, end;
+    GList *k, *part_start;
+    guint64 start, end, last_stream_offset;
 
     for (k = demux->index_tables; k; k = k->next) {
       GstMXFDemuxIndexTable *tmp = k->data;
@@ -3726,13 +3740,24 @@ collect_index_table_segments (GstMXFDemux * demux)
     if (t->offsets->len < end)
       g_array_set_size (t->offsets, end);
 
+    /* Stream offsets increase within a segment, so the partition scan for
+     * each entry can resume from the partition found for the previous one
+     * instead of rescanning the whole list. On long files with frequent
+     * body partitions this turns a quadratic walk into a linear one */
+    part_start = demux->partitions;
+    last_stream_offset = 0;
+
     for (i = 0; i < segment->n_index_entries && start + i < t->offsets->len;
         i++) {
       guint64 offset = segment->index_entries[i].stream_offset;
       GList *m;
       GstMXFDemuxPartition *offset_partition = NULL, *next_partition = NULL;
 
-      for (m = demux->partitions; m; m = m->next) {
+      if (G_UNLIKELY (offset < last_stream_offset))
+        part_start = demux->partitions;
+      last_stream_offset = offset;
+
+      for (m = part_start; m; m = m->next) {
         GstMXFDemuxPartition *partition = m->data;
 
         if (!next_partition && offset_partition)
@@ -3745,6 +3770,7 @@ collect_index_table_segments (GstMXFDemux * demux)
 
         offset_partition = partition;
         next_partition = NULL;
+        part_start = m;
       }
 
       if (offset_partition && offset >= offset_partition->partition.body_offset) {
@@ -4549,6 +4575,9 @@ gst_mxf_demux_set_property (GObject * object, guint prop_id,
     case PROP_MAX_DRIFT:
       demux->max_drift = g_value_get_uint64 (value);
       break;
+    case PROP_PARSE_DESCRIPTIVE_METADATA:
+      demux->parse_descriptive_metadata = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -4587,6 +4616,9 @@ gst_mxf_demux_get_property (GObject * object, guint prop_id,
       g_rw_lock_reader_unlock (&demux->metadata_lock);
       break;
     }
+    case PROP_PARSE_DESCRIPTIVE_METADATA:
+      g_value_set_boolean (value, demux->parse_descriptive_metadata);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -4662,6 +4694,15 @@ gst_mxf_demux_class_init (GstMXFDemuxClass * klass)
           "Structural metadata of the MXF file",
           GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class,
+      PROP_PARSE_DESCRIPTIVE_METADATA,
+      g_param_spec_boolean ("parse-descriptive-metadata",
+          "Parse descriptive metadata",
+          "Parse descriptive metadata sets and post the metadata structure "
+          "as a tag. Disabling this speeds up startup on files with large "
+          "DMS-1 trees when only the essence is of interest",
+          TRUE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_mxf_demux_change_state);
   gstelement_class->query = GST_DEBUG_FUNCPTR (gst_mxf_demux_query);
@@ -4693,6 +4734,7 @@ gst_mxf_demux_init (GstMXFDemux * demux)
   gst_element_add_pad (GST_ELEMENT (demux), demux->sinkpad);
 
   demux->max_drift = 500 * GST_MSECOND;
+  demux->parse_descriptive_metadata = TRUE;
 
   demux->adapter = gst_adapter_new ();
   demux->flowcombiner = gst_flow_combiner_new ();
@@ -208,6 +208,7 @@ struct _GstMXFDemux
   /* Properties */
   gchar *requested_package_string;
   GstClockTime max_drift;
+  gboolean parse_descriptive_metadata;
 };
 
 struct _GstMXFDemuxClass
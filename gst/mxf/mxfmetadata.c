@@ -3788,13 +3788,11 @@ mxf_metadata_dm_segment_resolve (MXFMetadataBase * m, GHashTable * metadata)
 
   current = g_hash_table_lookup (metadata, &self->dm_framework_uid);
   if (current && MXF_IS_DESCRIPTIVE_METADATA_FRAMEWORK (current)) {
-    if (mxf_metadata_base_resolve (current, metadata)) {
-      self->dm_framework = MXF_DESCRIPTIVE_METADATA_FRAMEWORK (current);
-    } else {
-      GST_ERROR ("Couldn't resolve DM framework %s",
-          mxf_uuid_to_string (&self->dm_framework_uid, str));
-      return FALSE;
-    }
+    /* Don't resolve the framework eagerly: descriptive trees (e.g. DMS-1)
+     * can be very large and nothing dereferences their children during
+     * track setup. Anything that needs the resolved tree can resolve it
+     * on access via mxf_metadata_base_resolve() */
+    self->dm_framework = MXF_DESCRIPTIVE_METADATA_FRAMEWORK (current);
   } else {
     GST_ERROR ("Couldn't find DM framework %s",
         mxf_uuid_to_string (&self->dm_framework_uid, str));
@@ -191,6 +191,7 @@ static void
 gst_mxf_mux_init (GstMXFMux * mux)
 {
   mux->index_table = g_array_new (FALSE, FALSE, sizeof (MXFIndexTableSegment));
+  mux->rip = g_array_new (FALSE, FALSE, sizeof (MXFRandomIndexPackEntry));
   gst_mxf_mux_reset (mux);
 }
 
@@ -217,6 +218,11 @@ gst_mxf_mux_finalize (GObject * object)
     mux->index_table = NULL;
   }
 
+  if (mux->rip) {
+    g_array_free (mux->rip, TRUE);
+    mux->rip = NULL;
+  }
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -268,6 +274,10 @@ gst_mxf_mux_reset (GstMXFMux * mux)
   g_array_set_size (mux->index_table, 0);
   mux->current_index_pos = 0;
   mux->last_keyframe_pos = 0;
+
+  if (mux->rip)
+    g_array_set_size (mux->rip, 0);
+  mux->body_partition_offset = 0;
 }
 
 static gboolean
@@ -1270,6 +1280,10 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
     MXFIndexTableSegment *segment;
     const gint max_segment_size = G_MAXUINT16 / 11;
 
+    /* stream out finished index segments before the next essence element */
+    if ((ret = gst_mxf_mux_write_completed_index_segments (mux)) != GST_FLOW_OK)
+      return ret;
+
     if (mux->index_table->len == 0 ||
         g_array_index (mux->index_table, MXFIndexTableSegment,
             mux->current_index_pos).index_duration >= max_segment_size) {
@@ -1280,7 +1294,7 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
       if (mux->index_table->len <= mux->current_index_pos) {
         MXFIndexTableSegment s;
 
-        memset (&segment, 0, sizeof (segment));
+        memset (&s, 0, sizeof (s));
 
         mxf_uuid_init (&s.instance_id, mux->metadata);
         memcpy (&s.index_edit_rate, &pad->source_track->edit_rate,
@@ -1288,7 +1302,8 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
         if (mux->index_table->len > 0)
           s.index_start_position =
               g_array_index (mux->index_table, MXFIndexTableSegment,
-              mux->index_table->len - 1).index_start_position;
+              mux->index_table->len - 1).index_start_position +
+              max_segment_size;
         else
           s.index_start_position = 0;
         s.index_duration = 0;
@@ -1335,7 +1350,7 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
           if (pts_index_pos >= mux->index_table->len) {
             MXFIndexTableSegment s;
 
-            memset (&segment, 0, sizeof (segment));
+            memset (&s, 0, sizeof (s));
 
             mxf_uuid_init (&s.instance_id, mux->metadata);
             memcpy (&s.index_edit_rate, &pad->source_track->edit_rate,
@@ -1343,7 +1358,8 @@ gst_mxf_mux_handle_buffer (GstMXFMux * mux, GstMXFMuxPad * pad)
             if (mux->index_table->len > 0)
               s.index_start_position =
                   g_array_index (mux->index_table, MXFIndexTableSegment,
-                  mux->index_table->len - 1).index_start_position;
+                  mux->index_table->len - 1).index_start_position +
+                  max_segment_size;
             else
               s.index_start_position = 0;
             s.index_duration = 0;
@@ -1446,10 +1462,86 @@ gst_mxf_mux_write_body_partition (GstMXFMux * mux)
   mux->partition.body_sid =
       mux->preface->content_storage->essence_container_data[0]->body_sid;
 
+  mux->body_partition_offset = mux->offset;
+  {
+    MXFRandomIndexPackEntry entry;
+
+    entry.offset = mux->offset;
+    entry.body_sid = mux->partition.body_sid;
+    g_array_append_val (mux->rip, entry);
+  }
+
   buf = mxf_partition_pack_to_buffer (&mux->partition);
   return gst_mxf_mux_push (mux, buf);
 }
 
+/* Write all index table segments that can't change anymore into their own
+ * body partition and drop their entries, so the index memory stays bounded
+ * for long recordings and the footer only has to serialize the tail.
+ *
+ * Temporal offsets can be patched up to 127 edit units backwards, so
+ * earlier segments are only final once the current one has grown past
+ * that. */
+static GstFlowReturn
+gst_mxf_mux_write_completed_index_segments (GstMXFMux * mux)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint i;
+
+  if (mux->index_table->len == 0 ||
+      g_array_index (mux->index_table, MXFIndexTableSegment,
+          mux->current_index_pos).n_index_entries < 127)
+    return GST_FLOW_OK;
+
+  for (i = 0; i < mux->current_index_pos; i++) {
+    MXFIndexTableSegment *segment =
+        &g_array_index (mux->index_table, MXFIndexTableSegment, i);
+    MXFRandomIndexPackEntry entry;
+    GstBuffer *buf, *packet;
+
+    if (segment->index_entries == NULL)
+      continue;
+
+    buf = mxf_index_table_segment_to_buffer (segment);
+
+    mux->partition.type = MXF_PARTITION_PACK_BODY;
+    mux->partition.closed = TRUE;
+    mux->partition.complete = TRUE;
+    mux->partition.prev_partition = mux->partition.this_partition;
+    mux->partition.this_partition = mux->offset;
+    mux->partition.footer_partition = 0;
+    mux->partition.header_byte_count = 0;
+    mux->partition.index_byte_count = gst_buffer_get_size (buf);
+    mux->partition.index_sid =
+        mux->preface->content_storage->essence_container_data[0]->index_sid;
+    mux->partition.body_sid =
+        mux->preface->content_storage->essence_container_data[0]->body_sid;
+    /* body_offset keeps counting the essence bytes written so far and the
+     * following essence continues in this partition, so it is left as-is */
+
+    entry.offset = mux->partition.this_partition;
+    entry.body_sid = mux->partition.body_sid;
+    g_array_append_val (mux->rip, entry);
+
+    GST_DEBUG_OBJECT (mux,
+        "Writing index table segment %u in a body partition at offset %"
+        G_GUINT64_FORMAT, i, mux->offset);
+
+    packet = mxf_partition_pack_to_buffer (&mux->partition);
+    if ((ret = gst_mxf_mux_push (mux, packet)) != GST_FLOW_OK) {
+      gst_buffer_unref (buf);
+      return ret;
+    }
+    if ((ret = gst_mxf_mux_push (mux, buf)) != GST_FLOW_OK)
+      return ret;
+
+    g_free (segment->index_entries);
+    segment->index_entries = NULL;
+  }
+
+  return ret;
+}
+
 static GstFlowReturn
 gst_mxf_mux_handle_eos (GstMXFMux * mux)
 {
@@ -1564,8 +1656,7 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
   }
 
   {
-    guint64 body_partition = mux->partition.this_partition;
-    guint32 body_sid = mux->partition.body_sid;
+    guint64 prev_partition = mux->partition.this_partition;
     guint64 footer_partition = mux->offset;
     GArray *rip;
     GstFlowReturn ret;
@@ -1579,8 +1670,14 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
     for (i = 0; i < mux->index_table->len; i++) {
       MXFIndexTableSegment *segment =
           &g_array_index (mux->index_table, MXFIndexTableSegment, i);
-      GstBuffer *segment_buffer = mxf_index_table_segment_to_buffer (segment);
+      GstBuffer *segment_buffer;
 
+      /* segments already streamed into a body partition have no entries
+       * anymore and only the tail is left for the footer */
+      if (segment->index_entries == NULL)
+        continue;
+
+      segment_buffer = mxf_index_table_segment_to_buffer (segment);
       index_byte_count += gst_buffer_get_size (segment_buffer);
       index_entries = g_list_prepend (index_entries, segment_buffer);
     }
@@ -1589,7 +1686,7 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
     mux->partition.closed = TRUE;
     mux->partition.complete = TRUE;
     mux->partition.this_partition = mux->offset;
-    mux->partition.prev_partition = body_partition;
+    mux->partition.prev_partition = prev_partition;
     mux->partition.footer_partition = mux->offset;
     mux->partition.header_byte_count = 0;
     mux->partition.index_byte_count = index_byte_count;
@@ -1608,13 +1705,12 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
     }
     g_list_free (index_entries);
 
-    rip = g_array_sized_new (FALSE, FALSE, sizeof (MXFRandomIndexPackEntry), 3);
+    rip = g_array_sized_new (FALSE, FALSE, sizeof (MXFRandomIndexPackEntry),
+        mux->rip->len + 2);
     entry.offset = 0;
     entry.body_sid = 0;
     g_array_append_val (rip, entry);
-    entry.offset = body_partition;
-    entry.body_sid = body_sid;
-    g_array_append_val (rip, entry);
+    g_array_append_vals (rip, mux->rip->data, mux->rip->len);
     entry.offset = footer_partition;
     entry.body_sid = 0;
     g_array_append_val (rip, entry);
@@ -1648,7 +1744,7 @@ gst_mxf_mux_handle_eos (GstMXFMux * mux)
         return ret;
       }
 
-      g_assert (mux->offset == body_partition);
+      g_assert (mux->offset == mux->body_partition_offset);
 
       mux->partition.type = MXF_PARTITION_PACK_BODY;
       mux->partition.closed = TRUE;
@@ -72,6 +72,11 @@ typedef struct _GstMXFMux {
   GArray *index_table;
   guint current_index_pos;
   guint64 last_keyframe_pos;
+
+  /* body partitions written so far, for the random index pack */
+  GArray *rip;
+  /* offset of the first body partition, rewritten on EOS */
+  guint64 body_partition_offset;
 } GstMXFMux;
 
 typedef struct _GstMXFMuxClass {
@@ -98,8 +98,7 @@ static gboolean
 gst_net_sim_source_dispatch (GSource * source,
     GSourceFunc callback, gpointer user_data)
 {
-  callback (user_data);
-  return FALSE;
+  return callback (user_data);
 }
 
 GSourceFuncs gst_net_sim_source_funcs = {
@@ -159,6 +158,13 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
     if (netsim->main_loop == NULL) {
       GMainContext *main_context = g_main_context_new ();
       netsim->main_loop = g_main_loop_new (main_context, FALSE);
+
+      netsim->delay_source =
+          g_source_new (&gst_net_sim_source_funcs, sizeof (GSource));
+      g_source_set_ready_time (netsim->delay_source, -1);
+      g_source_set_callback (netsim->delay_source,
+          (GSourceFunc) gst_net_sim_push_delayed, netsim, NULL);
+      g_source_attach (netsim->delay_source, main_context);
       g_main_context_unref (main_context);
 
       GST_TRACE_OBJECT (netsim, "ACT: Starting task on srcpad");
@@ -198,6 +204,14 @@ gst_net_sim_src_activatemode (GstPad * pad, GstObject * parent,
       GST_TRACE_OBJECT (netsim, "DEACT: Stopping task on srcpad");
       result = gst_pad_stop_task (netsim->srcpad);
       GST_TRACE_OBJECT (netsim, "DEACT: Mainloop and GstTask stopped");
+
+      g_source_destroy (netsim->delay_source);
+      g_source_unref (netsim->delay_source);
+      netsim->delay_source = NULL;
+
+      g_queue_foreach (&netsim->delayed_packets, (GFunc) push_buffer_ctx_free,
+          NULL);
+      g_queue_clear (&netsim->delayed_packets);
     }
   }
   g_mutex_unlock (&netsim->loop_mutex);
@@ -209,6 +223,7 @@ typedef struct
 {
   GstPad *pad;
   GstBuffer *buf;
+  gint64 ready_time;
 } PushBufferCtx;
 
 G_INLINE_FUNC PushBufferCtx *
@@ -217,6 +232,7 @@ push_buffer_ctx_new (GstPad * pad, GstBuffer * buf)
   PushBufferCtx *ctx = g_slice_new (PushBufferCtx);
   ctx->pad = gst_object_ref (pad);
   ctx->buf = gst_buffer_ref (buf);
+  ctx->ready_time = -1;
   return ctx;
 }
 
@@ -230,12 +246,53 @@ push_buffer_ctx_free (PushBufferCtx * ctx)
   }
 }
 
+static gint
+push_buffer_ctx_compare (gconstpointer a, gconstpointer b, gpointer user_data)
+{
+  const PushBufferCtx *ctx_a = a;
+  const PushBufferCtx *ctx_b = b;
+
+  if (ctx_a->ready_time < ctx_b->ready_time)
+    return -1;
+  if (ctx_a->ready_time > ctx_b->ready_time)
+    return 1;
+  return 0;
+}
+
+/* Called from the loop thread whenever the ready time of the delay source
+ * passes. Releases every packet that is due in one batch and re-arms the
+ * source for the next deadline. */
 static gboolean
-push_buffer_ctx_push (PushBufferCtx * ctx)
+gst_net_sim_push_delayed (GstNetSim * netsim)
 {
-  GST_DEBUG_OBJECT (ctx->pad, "Pushing buffer now");
-  gst_pad_push (ctx->pad, gst_buffer_ref (ctx->buf));
-  return FALSE;
+  GQueue batch = G_QUEUE_INIT;
+  gint64 now_time = g_get_monotonic_time ();
+  PushBufferCtx *ctx;
+
+  g_mutex_lock (&netsim->loop_mutex);
+  while ((ctx = g_queue_peek_head (&netsim->delayed_packets)) != NULL &&
+      ctx->ready_time <= now_time)
+    g_queue_push_tail (&batch, g_queue_pop_head (&netsim->delayed_packets));
+  g_mutex_unlock (&netsim->loop_mutex);
+
+  GST_DEBUG_OBJECT (netsim, "Pushing %u delayed buffers",
+      g_queue_get_length (&batch));
+
+  /* push without holding the lock so the streaming thread can keep
+   * queueing packets while downstream processes these */
+  while ((ctx = g_queue_pop_head (&batch)) != NULL) {
+    gst_pad_push (ctx->pad, gst_buffer_ref (ctx->buf));
+    push_buffer_ctx_free (ctx);
+  }
+
+  g_mutex_lock (&netsim->loop_mutex);
+  ctx = g_queue_peek_head (&netsim->delayed_packets);
+  if (netsim->delay_source != NULL)
+    g_source_set_ready_time (netsim->delay_source,
+        ctx != NULL ? ctx->ready_time : -1);
+  g_mutex_unlock (&netsim->loop_mutex);
+
+  return TRUE;                  /* Keep source */
 }
 
 static gint
@@ -336,7 +393,6 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
       g_rand_double (netsim->rand_seed) < netsim->delay_probability) {
     gint delay;
     PushBufferCtx *ctx;
-    GSource *source;
     gint64 ready_time, now_time;
 
     switch (netsim->delay_distribution) {
@@ -362,7 +418,6 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
 
     ctx = push_buffer_ctx_new (netsim->srcpad, buf);
 
-    source = g_source_new (&gst_net_sim_source_funcs, sizeof (GSource));
     now_time = g_get_monotonic_time ();
     ready_time = now_time + delay * 1000;
     if (!netsim->allow_reordering && ready_time < netsim->last_ready_time)
@@ -372,11 +427,14 @@ gst_net_sim_delay_buffer (GstNetSim * netsim, GstBuffer * buf)
     GST_DEBUG_OBJECT (netsim, "Delaying packet by %" G_GINT64_FORMAT "ms",
         (ready_time - now_time) / 1000);
 
-    g_source_set_ready_time (source, ready_time);
-    g_source_set_callback (source, (GSourceFunc) push_buffer_ctx_push,
-        ctx, (GDestroyNotify) push_buffer_ctx_free);
-    g_source_attach (source, g_main_loop_get_context (netsim->main_loop));
-    g_source_unref (source);
+    ctx->ready_time = ready_time;
+    g_queue_insert_sorted (&netsim->delayed_packets, ctx,
+        push_buffer_ctx_compare, NULL);
+
+    /* only wake the loop thread when this packet became the new head,
+     * otherwise the source is already armed for an earlier deadline */
+    if (g_queue_peek_head (&netsim->delayed_packets) == ctx)
+      g_source_set_ready_time (netsim->delay_source, ready_time);
   } else {
     ret = gst_pad_push (netsim->srcpad, gst_buffer_ref (buf));
   }
@@ -606,6 +664,8 @@ gst_net_sim_init (GstNetSim * netsim)
   netsim->rand_seed = g_rand_new ();
   netsim->main_loop = NULL;
   netsim->prev_time = GST_CLOCK_TIME_NONE;
+  g_queue_init (&netsim->delayed_packets);
+  netsim->delay_source = NULL;
 
   GST_OBJECT_FLAG_SET (netsim->sinkpad,
       GST_PAD_FLAG_PROXY_CAPS | GST_PAD_FLAG_PROXY_ALLOCATION);
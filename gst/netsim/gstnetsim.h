@@ -77,6 +77,11 @@ struct _GstNetSim
   NormalDistributionState delay_state;
   gint64 last_ready_time;
 
+  /* delayed packets sorted by ready time, released in batches by a
+   * single source instead of one timer source per packet */
+  GQueue delayed_packets;
+  GSource *delay_source;
+
   /* properties */
   gint min_delay;
   gint max_delay;
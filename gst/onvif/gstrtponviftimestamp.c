@@ -219,6 +219,9 @@ gst_rtp_onvif_timestamp_finalize (GObject * object)
 {
   GstRtpOnvifTimestamp *self = GST_RTP_ONVIF_TIMESTAMP (object);
 
+  /* in case we are disposed of without ever going through
+   * PAUSED -> READY */
+  purge_cached_buffer_and_events (self);
   g_queue_free (self->event_queue);
 
   G_OBJECT_CLASS (gst_rtp_onvif_timestamp_parent_class)->finalize (object);
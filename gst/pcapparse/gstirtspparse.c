@@ -167,21 +167,22 @@ gst_irtsp_parse_handle_frame (GstBaseParse * parse,
   if (G_UNLIKELY (map.size < 4))
     goto exit;
 
-  gst_byte_reader_init (&reader, map.data, map.size);
+  if (map.data[0] != 0x24) {
+    /* lost sync; find the next header for our channel */
+    gst_byte_reader_init (&reader, map.data, map.size);
 
-  off = gst_byte_reader_masked_scan_uint32 (&reader, 0xffff0000,
-      0x24000000 + (IRTSPParse->channel_id << 16), 0, map.size);
+    off = gst_byte_reader_masked_scan_uint32 (&reader, 0xffff0000,
+        0x24000000 + (IRTSPParse->channel_id << 16), 0, map.size);
 
-  GST_LOG_OBJECT (parse, "possible sync at buffer offset %d", off);
+    GST_LOG_OBJECT (parse, "possible sync at buffer offset %d", off);
 
-  /* didn't find anything that looks like a sync word, skip */
-  if (off < 0) {
-    *skipsize = map.size - 3;
-    goto exit;
-  }
+    /* didn't find anything that looks like a sync word, skip */
+    if (off < 0) {
+      *skipsize = map.size - 3;
+      goto exit;
+    }
 
-  /* possible frame header, but not at offset 0? skip bytes before sync */
-  if (off > 0) {
+    /* possible frame header, but not at offset 0? skip bytes before sync */
     *skipsize = off;
     goto exit;
   }
@@ -189,6 +190,14 @@ gst_irtsp_parse_handle_frame (GstBaseParse * parse,
   framesize = GST_READ_UINT16_BE (map.data + 2) + 4;
   GST_LOG_OBJECT (parse, "got frame size %d", framesize);
 
+  if (map.data[1] != IRTSPParse->channel_id) {
+    /* a complete frame of another channel; skip it by its declared
+     * length instead of scanning its payload for our sync pattern,
+     * which our header bytes could falsely match inside */
+    *skipsize = MIN (framesize, map.size);
+    goto exit;
+  }
+
   if (!gst_pad_has_current_caps (GST_BASE_PARSE_SRC_PAD (parse))) {
     GstCaps *caps;
 
@@ -199,6 +208,7 @@ gst_irtsp_parse_handle_frame (GstBaseParse * parse,
 
   if (framesize <= map.size) {
     gst_buffer_unmap (buf, &map);
+    gst_base_parse_set_min_frame_size (parse, 4);
     /* HACK HACK skip header.
      * could also ask baseparse to skip this,
      * but that would give us a discontinuity for free
@@ -209,6 +219,10 @@ gst_irtsp_parse_handle_frame (GstBaseParse * parse,
     return gst_base_parse_finish_frame (parse, frame, framesize);
   }
 
+  /* incomplete frame; wait until the whole frame is in instead of being
+   * called again for every input buffer in between */
+  gst_base_parse_set_min_frame_size (parse, framesize);
+
 exit:
   gst_buffer_unmap (buf, &map);
   return GST_FLOW_OK;
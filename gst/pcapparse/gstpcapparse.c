@@ -355,11 +355,17 @@ gst_pcap_parse_read_uint32 (GstPcapParse * self, const guint8 * p)
 #define IP_PROTO_UDP      17
 #define IP_PROTO_TCP      6
 
+/* Enough for the largest link-layer header plus maximum-size IP and TCP
+ * headers; the payload itself never has to be mapped to scan a frame */
+#define SCAN_WINDOW_LEN (ETH_HEADER_LEN + ETH_VLAN_HEADER_LEN + 60 + 60)
 
+/* buf/buf_size describe the mapped header window, which may be shorter
+ * than the whole packet; payload bounds are checked against
+ * self->cur_packet_size */
 static gboolean
 gst_pcap_parse_scan_frame (GstPcapParse * self,
-    const guint8 * buf,
-    gint buf_size, const guint8 ** payload, gint * payload_size)
+    const guint8 * buf, gint buf_size, gint * payload_offset,
+    gint * payload_size)
 {
   const guint8 *buf_ip = 0;
   const guint8 *buf_proto;
@@ -456,20 +462,21 @@ gst_pcap_parse_scan_frame (GstPcapParse * self,
   /* extract some params and data according to protocol */
   if (ip_protocol == IP_PROTO_UDP) {
     len = GUINT16_FROM_BE (*((guint16 *) (buf_proto + 4)));
-    if (len < UDP_HEADER_LEN || buf_proto + len > buf + buf_size)
+    if (len < UDP_HEADER_LEN
+        || (buf_proto - buf) + len > self->cur_packet_size)
       return FALSE;
 
-    *payload = buf_proto + UDP_HEADER_LEN;
+    *payload_offset = (buf_proto - buf) + UDP_HEADER_LEN;
     *payload_size = len - UDP_HEADER_LEN;
   } else {
     if (buf_proto + 12 >= buf + buf_size)
       return FALSE;
     len = (buf_proto[12] >> 4) * 4;
-    if (buf_proto + len > buf + buf_size)
+    if ((buf_proto - buf) + len > self->cur_packet_size)
       return FALSE;
 
     /* all remaining data following tcp header is payload */
-    *payload = buf_proto + len;
+    *payload_offset = (buf_proto - buf) + len;
     *payload_size = self->cur_packet_size - (buf_proto - buf) - len;
   }
 
@@ -511,21 +518,25 @@ gst_pcap_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
           break;
 
         if (self->cur_packet_size > 0) {
-          const guint8 *payload_data;
+          gint payload_offset;
           gint payload_size;
+          gint scan_len;
 
-          data = gst_adapter_map (self->adapter, self->cur_packet_size);
+          /* only map the headers; this keeps the adapter from having to
+           * coalesce the payload of packets spanning input buffers, in
+           * particular for packets the filters discard */
+          scan_len = MIN (self->cur_packet_size, SCAN_WINDOW_LEN);
+          data = gst_adapter_map (self->adapter, scan_len);
 
           GST_LOG_OBJECT (self, "examining packet size %" G_GINT64_FORMAT,
               self->cur_packet_size);
 
-          if (gst_pcap_parse_scan_frame (self, data, self->cur_packet_size,
-                  &payload_data, &payload_size)) {
+          if (gst_pcap_parse_scan_frame (self, data, scan_len,
+                  &payload_offset, &payload_size)) {
             GstBuffer *out_buf;
-            guintptr offset = payload_data - data;
 
             gst_adapter_unmap (self->adapter);
-            gst_adapter_flush (self->adapter, offset);
+            gst_adapter_flush (self->adapter, payload_offset);
             /* we don't use _take_buffer_fast() on purpose here, we need a
              * buffer with a single memory, since the RTP depayloaders expect
              * the complete RTP header to be in the first memory if there are
@@ -536,7 +547,7 @@ gst_pcap_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
               out_buf = gst_buffer_new ();
             }
             gst_adapter_flush (self->adapter,
-                self->cur_packet_size - offset - payload_size);
+                self->cur_packet_size - payload_offset - payload_size);
 
             if (GST_CLOCK_TIME_IS_VALID (self->cur_ts)) {
               if (!GST_CLOCK_TIME_IS_VALID (self->base_ts))
@@ -66,14 +66,18 @@ static gboolean gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent,
 
 static GstStateChangeReturn gst_proxy_sink_change_state (GstElement * element,
     GstStateChange transition);
+static void gst_proxy_sink_dispose (GObject * object);
 
 static void
 gst_proxy_sink_class_init (GstProxySinkClass * klass)
 {
+  GObjectClass *gobject_class = (GObjectClass *) klass;
   GstElementClass *gstelement_class = (GstElementClass *) klass;
 
   GST_DEBUG_CATEGORY_INIT (gst_proxy_sink_debug, "proxysink", 0, "proxy sink");
 
+  gobject_class->dispose = gst_proxy_sink_dispose;
+
   gstelement_class->change_state = gst_proxy_sink_change_state;
 
   gst_element_class_add_pad_template (gstelement_class,
@@ -99,6 +103,30 @@ gst_proxy_sink_init (GstProxySink * self)
   gst_element_add_pad (GST_ELEMENT (self), self->sinkpad);
 }
 
+static void
+gst_proxy_sink_dispose (GObject * object)
+{
+  GstProxySink *self = GST_PROXY_SINK (object);
+
+  gst_object_replace ((GstObject **) & self->cached_srcpad, NULL);
+
+  G_OBJECT_CLASS (gst_proxy_sink_parent_class)->dispose (object);
+}
+
+/* Takes a ref on the proxysrc's internal srcpad, or returns NULL if no
+ * proxysrc is connected */
+static GstPad *
+gst_proxy_sink_acquire_srcpad (GstProxySink * self)
+{
+  GstPad *srcpad;
+
+  GST_OBJECT_LOCK (self);
+  srcpad = self->cached_srcpad ? gst_object_ref (self->cached_srcpad) : NULL;
+  GST_OBJECT_UNLOCK (self);
+
+  return srcpad;
+}
+
 static GstStateChangeReturn
 gst_proxy_sink_change_state (GstElement * element, GstStateChange transition)
 {
@@ -124,20 +152,16 @@ static gboolean
 gst_proxy_sink_sink_query (GstPad * pad, GstObject * parent, GstQuery * query)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   gboolean ret = FALSE;
 
   GST_LOG_OBJECT (pad, "Handling query of type '%s'",
       gst_query_type_get_name (GST_QUERY_TYPE (query)));
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_acquire_srcpad (self);
+  if (srcpad) {
     ret = gst_pad_peer_query (srcpad, query);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
   }
 
   return ret;
@@ -164,7 +188,7 @@ static gboolean
 gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   gboolean ret = FALSE;
   gboolean sticky = GST_EVENT_IS_STICKY (event);
 
@@ -173,11 +197,8 @@ gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
   if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP)
     self->pending_sticky_events = FALSE;
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_acquire_srcpad (self);
+  if (srcpad) {
     if (sticky && self->pending_sticky_events) {
       CopyStickyEventsData data = { srcpad, GST_FLOW_OK };
 
@@ -187,7 +208,6 @@ gst_proxy_sink_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
 
     ret = gst_pad_push_event (srcpad, event);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
 
     if (!ret && sticky) {
       self->pending_sticky_events = TRUE;
@@ -203,16 +223,13 @@ static GstFlowReturn
 gst_proxy_sink_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   GstFlowReturn ret = GST_FLOW_OK;
 
   GST_LOG_OBJECT (pad, "Chaining buffer %p", buffer);
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_acquire_srcpad (self);
+  if (srcpad) {
     if (self->pending_sticky_events) {
       CopyStickyEventsData data = { srcpad, GST_FLOW_OK };
 
@@ -222,7 +239,6 @@ gst_proxy_sink_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 
     ret = gst_pad_push (srcpad, buffer);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
 
     GST_LOG_OBJECT (pad, "Chained buffer %p: %s", buffer,
         gst_flow_get_name (ret));
@@ -239,16 +255,13 @@ gst_proxy_sink_sink_chain_list (GstPad * pad, GstObject * parent,
     GstBufferList * list)
 {
   GstProxySink *self = GST_PROXY_SINK (parent);
-  GstProxySrc *src;
+  GstPad *srcpad;
   GstFlowReturn ret = GST_FLOW_OK;
 
   GST_LOG_OBJECT (pad, "Chaining buffer list %p", list);
 
-  src = g_weak_ref_get (&self->proxysrc);
-  if (src) {
-    GstPad *srcpad;
-    srcpad = gst_proxy_src_get_internal_srcpad (src);
-
+  srcpad = gst_proxy_sink_acquire_srcpad (self);
+  if (srcpad) {
     if (self->pending_sticky_events) {
       CopyStickyEventsData data = { srcpad, GST_FLOW_OK };
 
@@ -258,7 +271,6 @@ gst_proxy_sink_sink_chain_list (GstPad * pad, GstObject * parent,
 
     ret = gst_pad_push_list (srcpad, list);
     gst_object_unref (srcpad);
-    gst_object_unref (src);
     GST_LOG_OBJECT (pad, "Chained buffer list %p: %s", list,
         gst_flow_get_name (ret));
   } else {
@@ -282,6 +294,19 @@ gst_proxy_sink_get_internal_sinkpad (GstProxySink * self)
 void
 gst_proxy_sink_set_proxysrc (GstProxySink * self, GstProxySrc * src)
 {
+  GstPad *srcpad = NULL, *old;
+
   g_return_if_fail (self);
+
+  if (src)
+    srcpad = gst_proxy_src_get_internal_srcpad (src);
+
+  GST_OBJECT_LOCK (self);
+  old = self->cached_srcpad;
+  self->cached_srcpad = srcpad;
+  GST_OBJECT_UNLOCK (self);
+  if (old)
+    gst_object_unref (old);
+
   g_weak_ref_set (&self->proxysrc, src);
 }
@@ -46,6 +46,10 @@ struct _GstProxySink {
   /* The proxysrc that we push events, buffers, queries to */
   GWeakRef proxysrc;
 
+  /* The proxysrc's internal srcpad, cached under the object lock so the
+   * hot paths don't have to take the weak ref on every buffer */
+  GstPad *cached_srcpad;
+
   /* Whether there are sticky events pending */
   gboolean pending_sticky_events;
 };
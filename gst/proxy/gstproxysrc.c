@@ -232,6 +232,15 @@ static void
 gst_proxy_src_dispose (GObject * object)
 {
   GstProxySrc *self = GST_PROXY_SRC (object);
+  GstProxySink *sink;
+
+  /* drop the srcpad cached on the proxysink, it holds a ref on our
+   * internal srcpad */
+  sink = g_weak_ref_get (&self->proxysink);
+  if (sink) {
+    gst_proxy_sink_set_proxysrc (sink, NULL);
+    g_object_unref (sink);
+  }
 
   gst_object_unparent (GST_OBJECT (self->dummy_sinkpad));
   self->dummy_sinkpad = NULL;
@@ -126,11 +126,27 @@ vad_update (struct _vad_s * p, gint16 * data, gint len)
     p->vad_power = VAD_POWER_ALPHA * ((data[i] * data[i] >> 14) & 0xFFFF) +
         (0xFFFF - VAD_POWER_ALPHA) * (p->vad_power >> 16) +
         ((0xFFFF - VAD_POWER_ALPHA) * (p->vad_power & 0xFFFF) >> 16);
-    /* Update VAD buffer */
-    p->cqueue.base.s[p->cqueue.head.a] = data[i];
-    p->cqueue.head.a = (p->cqueue.head.a + 1) & (p->cqueue.size - 1);
-    if (p->cqueue.head.a == p->cqueue.tail.a)
-      p->cqueue.tail.a = (p->cqueue.tail.a + 1) & (p->cqueue.size - 1);
+  }
+
+  /* Update VAD buffer. Only the newest VAD_BUFFER_SIZE samples can still be
+   * in the window, so copy them as blocks instead of sample by sample with a
+   * wraparound check on every write */
+  if (len >= p->cqueue.size) {
+    memcpy (p->cqueue.base.s, data + (len - p->cqueue.size),
+        p->cqueue.size * sizeof (gint16));
+    p->cqueue.head.a = 0;
+    p->cqueue.tail.a = 1;
+  } else if (len > 0) {
+    guint64 head = p->cqueue.head.a;
+    guint64 fill = (head - p->cqueue.tail.a) & (p->cqueue.size - 1);
+    gint chunk = MIN (len, p->cqueue.size - (gint) head);
+
+    memcpy (&p->cqueue.base.s[head], data, chunk * sizeof (gint16));
+    if (chunk < len)
+      memcpy (p->cqueue.base.s, data + chunk, (len - chunk) * sizeof (gint16));
+    p->cqueue.head.a = (head + len) & (p->cqueue.size - 1);
+    if (fill + len >= p->cqueue.size)
+      p->cqueue.tail.a = (p->cqueue.head.a + 1) & (p->cqueue.size - 1);
   }
 
   tail = p->cqueue.tail.a;
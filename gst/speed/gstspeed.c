@@ -426,82 +426,91 @@ gst_speed_init (GstSpeed * filter)
   filter->timestamp = 0;
 }
 
+/* cheap inline floor/ceil replacing the per-sample libm calls in the
+ * interpolation loops below; the phase accumulator can start slightly
+ * negative for speeds below 1, so round via gint instead of truncating
+ * through an unsigned cast */
+static inline gint
+speed_floor (gfloat x)
+{
+  gint i = (gint) x;
+
+  return (x < i) ? i - 1 : i;
+}
+
+static inline gint
+speed_ceil (gfloat x)
+{
+  gint i = (gint) x;
+
+  return (x > i) ? i + 1 : i;
+}
+
 static inline guint
-speed_chain_int16 (GstSpeed * filter, GstBuffer * in_buf, GstBuffer * out_buf,
-    guint c, guint in_samples)
+speed_chain_int16 (GstSpeed * filter, const gint16 * in_data,
+    gint16 * out_data, guint c, guint in_samples)
 {
-  gint16 *in_data, *out_data;
+  const guint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+  const gfloat speed = filter->speed;
   gfloat interp, lower, i_float;
   guint i, j;
-  GstMapInfo in_info, out_info;
 
-  gst_buffer_map (in_buf, &in_info, GST_MAP_READ);
-  gst_buffer_map (out_buf, &out_info, GST_MAP_WRITE);
-
-  in_data = (gint16 *) in_info.data + c;
-  out_data = (gint16 *) out_info.data + c;
+  in_data += c;
+  out_data += c;
 
   lower = in_data[0];
-  i_float = 0.5 * (filter->speed - 1.0);
-  i = (guint) ceil (i_float);
+  i_float = 0.5 * (speed - 1.0);
+  i = (guint) speed_ceil (i_float);
   j = 0;
 
   while (i < in_samples) {
-    interp = i_float - floor (i_float);
+    interp = i_float - speed_floor (i_float);
 
-    out_data[j * GST_AUDIO_INFO_CHANNELS (&filter->info)] =
-        lower * (1 - interp) +
-        in_data[i * GST_AUDIO_INFO_CHANNELS (&filter->info)] * interp;
+    out_data[j * channels] =
+        lower * (1 - interp) + in_data[i * channels] * interp;
 
-    lower = in_data[i * GST_AUDIO_INFO_CHANNELS (&filter->info)];
+    lower = in_data[i * channels];
 
-    i_float += filter->speed;
-    i = (guint) ceil (i_float);
+    i_float += speed;
+    i = (guint) speed_ceil (i_float);
 
     ++j;
   }
 
-  gst_buffer_unmap (in_buf, &in_info);
-  gst_buffer_unmap (out_buf, &out_info);
   return j;
 }
 
 static inline guint
-speed_chain_float32 (GstSpeed * filter, GstBuffer * in_buf, GstBuffer * out_buf,
-    guint c, guint in_samples)
+speed_chain_float32 (GstSpeed * filter, const gfloat * in_data,
+    gfloat * out_data, guint c, guint in_samples)
 {
-  gfloat *in_data, *out_data;
+  const guint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+  const gfloat speed = filter->speed;
   gfloat interp, lower, i_float;
   guint i, j;
-  GstMapInfo in_info, out_info;
-
-  gst_buffer_map (in_buf, &in_info, GST_MAP_WRITE);
-  gst_buffer_map (out_buf, &out_info, GST_MAP_WRITE);
 
-  in_data = (gfloat *) in_info.data + c;
-  out_data = (gfloat *) out_info.data + c;
+  in_data += c;
+  out_data += c;
 
   lower = in_data[0];
-  i_float = 0.5 * (filter->speed - 1.0);
-  i = (guint) ceil (i_float);
+  i_float = 0.5 * (speed - 1.0);
+  i = (guint) speed_ceil (i_float);
   j = 0;
 
   while (i < in_samples) {
-    interp = i_float - floor (i_float);
+    interp = i_float - speed_floor (i_float);
 
-    out_data[j * GST_AUDIO_INFO_CHANNELS (&filter->info)] =
-        lower * (1 - interp) +
-        in_data[i * GST_AUDIO_INFO_CHANNELS (&filter->info)] * interp;
+    out_data[j * channels] =
+        lower * (1 - interp) + in_data[i * channels] * interp;
 
-    lower = in_data[i * GST_AUDIO_INFO_CHANNELS (&filter->info)];
+    lower = in_data[i * channels];
 
-    i_float += filter->speed;
-    i = (guint) ceil (i_float);
+    i_float += speed;
+    i = (guint) speed_ceil (i_float);
 
     ++j;
   }
-  gst_buffer_unmap (in_buf, &in_info);
-  gst_buffer_unmap (out_buf, &out_info);
+
   return j;
 }
 
@@ -586,6 +595,7 @@ speed_chain (GstPad * pad, GstObject * parent, GstBuffer * in_buf)
   guint c, in_samples, out_samples, out_size;
   GstFlowReturn flow;
   gsize size;
+  GstMapInfo in_info, out_info;
 
   if (G_UNLIKELY (filter->offset == GST_BUFFER_OFFSET_NONE)) {
     filter->offset = gst_util_uint64_scale_int (filter->timestamp,
@@ -604,14 +614,22 @@ speed_chain (GstPad * pad, GstObject * parent, GstBuffer * in_buf)
 
   out_samples = 0;
 
+  /* map once for all channels instead of once per channel */
+  gst_buffer_map (in_buf, &in_info, GST_MAP_READ);
+  gst_buffer_map (out_buf, &out_info, GST_MAP_WRITE);
+
   for (c = 0; c < GST_AUDIO_INFO_CHANNELS (&filter->info); ++c) {
     if (GST_AUDIO_INFO_IS_INTEGER (&filter->info))
-      out_samples = speed_chain_int16 (filter, in_buf, out_buf, c, in_samples);
+      out_samples = speed_chain_int16 (filter, (gint16 *) in_info.data,
+          (gint16 *) out_info.data, c, in_samples);
     else
-      out_samples =
-          speed_chain_float32 (filter, in_buf, out_buf, c, in_samples);
+      out_samples = speed_chain_float32 (filter, (gfloat *) in_info.data,
+          (gfloat *) out_info.data, c, in_samples);
   }
 
+  gst_buffer_unmap (in_buf, &in_info);
+  gst_buffer_unmap (out_buf, &out_info);
+
   size = out_samples * GST_AUDIO_INFO_BPF (&filter->info);
   gst_buffer_set_size (out_buf, size);
 
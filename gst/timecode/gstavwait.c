@@ -938,6 +938,14 @@ gst_avwait_vsink_chain (GstPad * pad, GstObject * parent, GstBuffer * inbuf)
             GST_BUFFER_DURATION (inbuf)));
     ret = gst_pad_push (self->vsrcpad, inbuf);
   }
+  /* In steady state there is no end message pending, so don't take the mutex
+   * again for every frame just to find that out. This check is safe without
+   * the lock: the audio thread only sets END_MESSAGE_AUDIO_PUSHED after this
+   * thread has set END_MESSAGE_STREAM_ENDED above, so if we see
+   * END_MESSAGE_NORMAL here then nothing can have been flagged for us */
+  if (g_atomic_int_get (&self->must_send_end_message) == END_MESSAGE_NORMAL)
+    return ret;
+
   g_mutex_lock (&self->mutex);
   if (self->must_send_end_message & END_MESSAGE_AUDIO_PUSHED) {
     self->must_send_end_message = END_MESSAGE_NORMAL;
@@ -29,6 +29,12 @@
  * counting from the stream time of each segment start, which it converts into
  * a timecode.
  *
+ * Since 1.16 the element also has an optional "ltc_sink" request pad that
+ * accepts mono audio carrying linear timecode (LTC). While the decoder is in
+ * sync, the decoded timecode overrides the internal counter for the video
+ * frame it belongs to; when the LTC signal drops out, stamping falls back to
+ * counting from the last good timecode.
+ *
  * ## Example launch line
  * |[
  * gst-launch-1.0 videotestsrc ! timecodestamper ! autovideosink
@@ -82,6 +88,29 @@ GST_STATIC_PAD_TEMPLATE ("sink",
     GST_STATIC_CAPS ("video/x-raw")
     );
 
+static GstStaticPadTemplate gst_timecodestamper_ltc_template =
+GST_STATIC_PAD_TEMPLATE ("ltc_sink",
+    GST_PAD_SINK,
+    GST_PAD_REQUEST,
+    GST_STATIC_CAPS ("audio/x-raw, format = (string) " GST_AUDIO_NE (S16)
+        ", layout = (string) interleaved, rate = (int) [ 1, MAX ], "
+        "channels = (int) 1")
+    );
+
+/* A timecode decoded from the LTC audio together with the running time of
+ * the end of its LTC frame, used to match it to a video frame */
+typedef struct
+{
+  GstVideoTimeCode *tc;
+  GstClockTime running_time;
+} GstTimeCodeStamperLTC;
+
+/* Sync word of an 80-bit LTC frame (bits 64-79), with bit 64 stored in the
+ * LSB as the bits arrive over the wire */
+#define LTC_SYNC_WORD 0xBFFC
+/* Maximum number of undecoded timecodes kept while waiting for video */
+#define LTC_MAX_QUEUED 32
+
 static void gst_timecodestamper_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
 static void gst_timecodestamper_get_property (GObject * object, guint prop_id,
@@ -92,6 +121,16 @@ static gboolean gst_timecodestamper_sink_event (GstBaseTransform * trans,
 static GstFlowReturn gst_timecodestamper_transform_ip (GstBaseTransform *
     vfilter, GstBuffer * buffer);
 static gboolean gst_timecodestamper_stop (GstBaseTransform * trans);
+static GstPad *gst_timecodestamper_request_new_pad (GstElement * element,
+    GstPadTemplate * templ, const gchar * name, const GstCaps * caps);
+static void gst_timecodestamper_release_pad (GstElement * element,
+    GstPad * pad);
+static GstFlowReturn gst_timecodestamper_ltc_chain (GstPad * pad,
+    GstObject * parent, GstBuffer * buffer);
+static gboolean gst_timecodestamper_ltc_sink_event (GstPad * pad,
+    GstObject * parent, GstEvent * event);
+static void gst_timecodestamper_ltc_reset (GstTimeCodeStamper *
+    timecodestamper);
 
 G_DEFINE_TYPE (GstTimeCodeStamper, gst_timecodestamper,
     GST_TYPE_BASE_TRANSFORM);
@@ -151,6 +190,13 @@ gst_timecodestamper_class_init (GstTimeCodeStamperClass * klass)
       gst_static_pad_template_get (&gst_timecodestamper_sink_template));
   gst_element_class_add_pad_template (element_class,
       gst_static_pad_template_get (&gst_timecodestamper_src_template));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&gst_timecodestamper_ltc_template));
+
+  element_class->request_new_pad =
+      GST_DEBUG_FUNCPTR (gst_timecodestamper_request_new_pad);
+  element_class->release_pad =
+      GST_DEBUG_FUNCPTR (gst_timecodestamper_release_pad);
 
   trans_class->sink_event = GST_DEBUG_FUNCPTR (gst_timecodestamper_sink_event);
   trans_class->stop = GST_DEBUG_FUNCPTR (gst_timecodestamper_stop);
@@ -169,6 +215,12 @@ gst_timecodestamper_init (GstTimeCodeStamper * timecodestamper)
   timecodestamper->current_tc->config.latest_daily_jam = DEFAULT_DAILY_JAM;
   timecodestamper->post_messages = DEFAULT_POST_MESSAGES;
   timecodestamper->first_tc_now = DEFAULT_FIRST_NOW;
+
+  timecodestamper->ltcpad = NULL;
+  gst_audio_info_init (&timecodestamper->ainfo);
+  gst_segment_init (&timecodestamper->ltc_segment, GST_FORMAT_UNDEFINED);
+  g_queue_init (&timecodestamper->ltc_timecodes);
+  timecodestamper->ltc_period = 0;
 }
 
 static void
@@ -186,6 +238,8 @@ gst_timecodestamper_dispose (GObject * object)
     timecodestamper->first_tc = NULL;
   }
 
+  gst_timecodestamper_ltc_reset (timecodestamper);
+
   G_OBJECT_CLASS (gst_timecodestamper_parent_class)->dispose (object);
 }
 
@@ -278,9 +332,284 @@ gst_timecodestamper_stop (GstBaseTransform * trans)
 
   gst_video_info_init (&timecodestamper->vinfo);
 
+  GST_OBJECT_LOCK (timecodestamper);
+  gst_timecodestamper_ltc_reset (timecodestamper);
+  GST_OBJECT_UNLOCK (timecodestamper);
+
   return TRUE;
 }
 
+/* Drops all queued timecodes and resynchronizes the biphase-mark decoder.
+ * Must be called with the object lock */
+static void
+gst_timecodestamper_ltc_reset (GstTimeCodeStamper * timecodestamper)
+{
+  GstTimeCodeStamperLTC *ltc;
+
+  while ((ltc = g_queue_pop_head (&timecodestamper->ltc_timecodes))) {
+    gst_video_time_code_free (ltc->tc);
+    g_free (ltc);
+  }
+  timecodestamper->ltc_transition_dist = 0;
+  timecodestamper->ltc_last_positive = FALSE;
+  timecodestamper->ltc_half_pending = FALSE;
+  timecodestamper->ltc_shift_low = 0;
+  timecodestamper->ltc_shift_high = 0;
+}
+
+/* Shifts one decoded bit into the 80-bit frame window and, once the sync
+ * word appears in the top 16 bits, parses the BCD fields of the complete
+ * frame and queues the timecode. Must be called with the object lock.
+ * @running_time is the running time of the sample that completed the bit */
+static void
+gst_timecodestamper_ltc_add_bit (GstTimeCodeStamper * timecodestamper,
+    gboolean bit, GstClockTime running_time)
+{
+  guint64 w;
+  guint frames, seconds, minutes, hours;
+  GstTimeCodeStamperLTC *ltc;
+
+  timecodestamper->ltc_shift_low = (timecodestamper->ltc_shift_low >> 1) |
+      ((guint64) (timecodestamper->ltc_shift_high & 1) << 63);
+  timecodestamper->ltc_shift_high = (timecodestamper->ltc_shift_high >> 1) |
+      ((bit ? 1 : 0) << 15);
+
+  if (timecodestamper->ltc_shift_high != LTC_SYNC_WORD)
+    return;
+
+  w = timecodestamper->ltc_shift_low;
+  frames = (w & 0xF) + 10 * ((w >> 8) & 0x3);
+  seconds = ((w >> 16) & 0xF) + 10 * ((w >> 24) & 0x7);
+  minutes = ((w >> 32) & 0xF) + 10 * ((w >> 40) & 0x7);
+  hours = ((w >> 48) & 0xF) + 10 * ((w >> 56) & 0x3);
+
+  if (hours >= 24 || seconds >= 60 || minutes >= 60) {
+    GST_DEBUG_OBJECT (timecodestamper,
+        "Invalid LTC frame %02u:%02u:%02u:%02u, ignoring", hours, minutes,
+        seconds, frames);
+    return;
+  }
+
+  if (running_time == GST_CLOCK_TIME_NONE)
+    return;
+
+  GST_LOG_OBJECT (timecodestamper,
+      "Decoded LTC %02u:%02u:%02u:%02u at %" GST_TIME_FORMAT, hours, minutes,
+      seconds, frames, GST_TIME_ARGS (running_time));
+
+  ltc = g_new (GstTimeCodeStamperLTC, 1);
+  ltc->tc = gst_video_time_code_copy (timecodestamper->current_tc);
+  ltc->tc->hours = hours;
+  ltc->tc->minutes = minutes;
+  ltc->tc->seconds = seconds;
+  ltc->tc->frames = frames;
+  ltc->tc->field_count = 0;
+  ltc->running_time = running_time;
+  g_queue_push_tail (&timecodestamper->ltc_timecodes, ltc);
+
+  /* Video might be stalled or not linked at all: don't let the queue grow
+   * without bound */
+  if (g_queue_get_length (&timecodestamper->ltc_timecodes) > LTC_MAX_QUEUED) {
+    ltc = g_queue_pop_head (&timecodestamper->ltc_timecodes);
+    gst_video_time_code_free (ltc->tc);
+    g_free (ltc);
+  }
+}
+
+/* Classifies the distance between two level changes of the biphase-mark
+ * signal: roughly one bit period means a zero, two transitions of roughly
+ * half a period each mean a one. Must be called with the object lock */
+static void
+gst_timecodestamper_ltc_transition (GstTimeCodeStamper * timecodestamper,
+    GstClockTime running_time)
+{
+  gdouble dist = timecodestamper->ltc_transition_dist;
+  gdouble period = timecodestamper->ltc_period;
+
+  if (period <= 0)
+    return;
+
+  if (dist > 1.5 * period) {
+    /* Signal interruption or an audio discontinuity: resynchronize */
+    timecodestamper->ltc_half_pending = FALSE;
+    timecodestamper->ltc_shift_low = 0;
+    timecodestamper->ltc_shift_high = 0;
+  } else if (dist < 0.75 * period) {
+    if (timecodestamper->ltc_half_pending) {
+      timecodestamper->ltc_half_pending = FALSE;
+      timecodestamper->ltc_period = 0.95 * period + 0.05 * (2 * dist);
+      gst_timecodestamper_ltc_add_bit (timecodestamper, TRUE, running_time);
+    } else {
+      timecodestamper->ltc_half_pending = TRUE;
+    }
+  } else {
+    /* A full period while the second half of a one was expected means we
+     * misclassified a transition; drop the half and stay in sync */
+    timecodestamper->ltc_half_pending = FALSE;
+    timecodestamper->ltc_period = 0.95 * period + 0.05 * dist;
+    gst_timecodestamper_ltc_add_bit (timecodestamper, FALSE, running_time);
+  }
+}
+
+static GstFlowReturn
+gst_timecodestamper_ltc_chain (GstPad * pad, GstObject * parent,
+    GstBuffer * buffer)
+{
+  GstTimeCodeStamper *timecodestamper = GST_TIME_CODE_STAMPER (parent);
+  GstClockTime base_running_time = GST_CLOCK_TIME_NONE;
+  GstMapInfo map;
+  const gint16 *samples;
+  gsize i, n_samples;
+  gint rate;
+
+  if (GST_BUFFER_TIMESTAMP (buffer) != GST_CLOCK_TIME_NONE &&
+      timecodestamper->ltc_segment.format == GST_FORMAT_TIME)
+    base_running_time =
+        gst_segment_to_running_time (&timecodestamper->ltc_segment,
+        GST_FORMAT_TIME, GST_BUFFER_TIMESTAMP (buffer));
+
+  if (!gst_buffer_map (buffer, &map, GST_MAP_READ)) {
+    gst_buffer_unref (buffer);
+    return GST_FLOW_ERROR;
+  }
+  samples = (const gint16 *) map.data;
+  n_samples = map.size / sizeof (gint16);
+
+  GST_OBJECT_LOCK (timecodestamper);
+  rate = GST_AUDIO_INFO_RATE (&timecodestamper->ainfo);
+  if (rate == 0 || timecodestamper->ltc_period <= 0) {
+    GST_OBJECT_UNLOCK (timecodestamper);
+    goto out;
+  }
+  for (i = 0; i < n_samples; i++) {
+    gboolean positive = samples[i] >= 0;
+
+    timecodestamper->ltc_transition_dist++;
+    if (positive != timecodestamper->ltc_last_positive) {
+      GstClockTime running_time = base_running_time;
+
+      if (running_time != GST_CLOCK_TIME_NONE)
+        running_time += gst_util_uint64_scale (i, GST_SECOND, rate);
+      gst_timecodestamper_ltc_transition (timecodestamper, running_time);
+      timecodestamper->ltc_transition_dist = 0;
+      timecodestamper->ltc_last_positive = positive;
+    }
+  }
+  GST_OBJECT_UNLOCK (timecodestamper);
+
+out:
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+  return GST_FLOW_OK;
+}
+
+static gboolean
+gst_timecodestamper_ltc_sink_event (GstPad * pad, GstObject * parent,
+    GstEvent * event)
+{
+  GstTimeCodeStamper *timecodestamper = GST_TIME_CODE_STAMPER (parent);
+  gboolean ret = TRUE;
+
+  GST_DEBUG_OBJECT (pad, "received event %" GST_PTR_FORMAT, event);
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+
+      gst_event_parse_caps (event, &caps);
+      GST_OBJECT_LOCK (timecodestamper);
+      if (!gst_audio_info_from_caps (&timecodestamper->ainfo, caps)) {
+        GST_OBJECT_UNLOCK (timecodestamper);
+        ret = FALSE;
+        break;
+      }
+      /* The LTC frame rate matches the video frame rate in any sane setup,
+       * which gives us the expected length of one of its 80 bits. The
+       * decoder tracks the actual length from there */
+      if (timecodestamper->vinfo.fps_n > 0) {
+        timecodestamper->ltc_period =
+            (gdouble) GST_AUDIO_INFO_RATE (&timecodestamper->ainfo) *
+            timecodestamper->vinfo.fps_d / (timecodestamper->vinfo.fps_n * 80.);
+      } else {
+        /* No video caps yet: start from 30 fps and let the decoder adapt */
+        timecodestamper->ltc_period =
+            GST_AUDIO_INFO_RATE (&timecodestamper->ainfo) / (30. * 80.);
+      }
+      GST_OBJECT_UNLOCK (timecodestamper);
+      break;
+    }
+    case GST_EVENT_SEGMENT:
+    {
+      GstSegment segment;
+
+      gst_event_copy_segment (event, &segment);
+      if (segment.format != GST_FORMAT_TIME) {
+        GST_ERROR_OBJECT (timecodestamper,
+            "Invalid segment format on the LTC pad");
+        ret = FALSE;
+        break;
+      }
+      GST_OBJECT_LOCK (timecodestamper);
+      timecodestamper->ltc_segment = segment;
+      GST_OBJECT_UNLOCK (timecodestamper);
+      break;
+    }
+    case GST_EVENT_FLUSH_STOP:
+      GST_OBJECT_LOCK (timecodestamper);
+      gst_segment_init (&timecodestamper->ltc_segment, GST_FORMAT_UNDEFINED);
+      gst_timecodestamper_ltc_reset (timecodestamper);
+      GST_OBJECT_UNLOCK (timecodestamper);
+      break;
+    default:
+      break;
+  }
+  /* The LTC pad has no downstream peer, events end here */
+  gst_event_unref (event);
+  return ret;
+}
+
+static GstPad *
+gst_timecodestamper_request_new_pad (GstElement * element,
+    GstPadTemplate * templ, const gchar * name, const GstCaps * caps)
+{
+  GstTimeCodeStamper *timecodestamper = GST_TIME_CODE_STAMPER (element);
+  GstPad *pad;
+
+  if (timecodestamper->ltcpad) {
+    GST_ERROR_OBJECT (timecodestamper, "LTC pad already requested");
+    return NULL;
+  }
+
+  pad =
+      gst_pad_new_from_static_template (&gst_timecodestamper_ltc_template,
+      "ltc_sink");
+  gst_pad_set_chain_function (pad,
+      GST_DEBUG_FUNCPTR (gst_timecodestamper_ltc_chain));
+  gst_pad_set_event_function (pad,
+      GST_DEBUG_FUNCPTR (gst_timecodestamper_ltc_sink_event));
+  timecodestamper->ltcpad = pad;
+  gst_element_add_pad (element, pad);
+
+  return pad;
+}
+
+static void
+gst_timecodestamper_release_pad (GstElement * element, GstPad * pad)
+{
+  GstTimeCodeStamper *timecodestamper = GST_TIME_CODE_STAMPER (element);
+
+  if (pad != timecodestamper->ltcpad)
+    return;
+
+  timecodestamper->ltcpad = NULL;
+  gst_pad_set_active (pad, FALSE);
+  gst_element_remove_pad (element, pad);
+
+  GST_OBJECT_LOCK (timecodestamper);
+  gst_timecodestamper_ltc_reset (timecodestamper);
+  GST_OBJECT_UNLOCK (timecodestamper);
+}
+
 /* Must be called with object lock */
 static void
 gst_timecodestamper_reset_timecode (GstTimeCodeStamper * timecodestamper)
@@ -436,6 +765,38 @@ gst_timecodestamper_transform_ip (GstBaseTransform * vfilter,
     gst_buffer_foreach_meta (buffer, remove_timecode_meta, NULL);
   }
 
+  /* If LTC is being decoded, jam the counter to the timecode whose LTC frame
+   * ended around this video frame. Leftover decoder jitter of up to one frame
+   * duration is tolerated; when no matching timecode arrived (signal dropout)
+   * the counter just keeps incrementing from the last good one */
+  if (timecodestamper->ltcpad && timecodestamper->vinfo.fps_n > 0 &&
+      GST_BUFFER_PTS (buffer) != GST_CLOCK_TIME_NONE) {
+    GstClockTime frame_running_time =
+        gst_segment_to_running_time (&vfilter->segment, GST_FORMAT_TIME,
+        GST_BUFFER_PTS (buffer));
+    GstClockTime frame_duration =
+        gst_util_uint64_scale_int (GST_SECOND, timecodestamper->vinfo.fps_d,
+        timecodestamper->vinfo.fps_n);
+    GstTimeCodeStamperLTC *ltc;
+
+    while ((ltc = g_queue_peek_head (&timecodestamper->ltc_timecodes)) &&
+        ltc->running_time + frame_duration < frame_running_time) {
+      /* Belongs to an earlier frame that was never stamped, drop it */
+      gst_video_time_code_free (ltc->tc);
+      g_free (g_queue_pop_head (&timecodestamper->ltc_timecodes));
+    }
+    if (ltc && frame_running_time != GST_CLOCK_TIME_NONE &&
+        ltc->running_time <= frame_running_time + frame_duration) {
+      timecodestamper->current_tc->hours = ltc->tc->hours;
+      timecodestamper->current_tc->minutes = ltc->tc->minutes;
+      timecodestamper->current_tc->seconds = ltc->tc->seconds;
+      timecodestamper->current_tc->frames = ltc->tc->frames;
+      timecodestamper->current_tc->field_count = 0;
+      gst_video_time_code_free (ltc->tc);
+      g_free (g_queue_pop_head (&timecodestamper->ltc_timecodes));
+    }
+  }
+
   gst_buffer_add_video_time_code_meta (buffer, timecodestamper->current_tc);
   tc = gst_video_time_code_copy (timecodestamper->current_tc);
   gst_video_time_code_increment_frame (timecodestamper->current_tc);
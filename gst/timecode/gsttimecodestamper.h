@@ -25,6 +25,7 @@
 
 #include <gst/gst.h>
 #include <gst/video/video.h>
+#include <gst/audio/audio.h>
 
 #define GST_TYPE_TIME_CODE_STAMPER            (gst_timecodestamper_get_type())
 #define GST_TIME_CODE_STAMPER(obj)            (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_TIME_CODE_STAMPER,GstTimeCodeStamper))
@@ -53,6 +54,23 @@ struct _GstTimeCodeStamper
   GstVideoInfo vinfo;
   gboolean post_messages;
   gboolean first_tc_now;
+
+  /* LTC decoding, all protected by the object lock. The optional request
+   * pad "ltc_sink" accepts mono audio carrying linear timecode; decoded
+   * timecodes are queued with their running time and matched against the
+   * video frames in transform_ip */
+  GstPad *ltcpad;
+  GstAudioInfo ainfo;
+  GstSegment ltc_segment;
+  GQueue ltc_timecodes;
+
+  /* Biphase-mark decoder state */
+  gdouble ltc_period;           /* estimated samples per LTC bit */
+  guint ltc_transition_dist;    /* samples since the last level change */
+  gboolean ltc_last_positive;
+  gboolean ltc_half_pending;    /* saw the first half of a one bit */
+  guint64 ltc_shift_low;        /* bits 0-63 of the LTC frame being built */
+  guint ltc_shift_high;         /* bits 64-79, i.e. the sync word */
 };
 
 struct _GstTimeCodeStamperClass
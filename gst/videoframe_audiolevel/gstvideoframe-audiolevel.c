@@ -273,26 +273,34 @@ gst_videoframe_audiolevel_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/* The calculators do a single pass over the interleaved samples and
+ * accumulate a square sum per channel: the data is only read once and the
+ * inner per-channel loop has a trip count the compiler can unroll and
+ * vectorize for the common channel layouts. NCS holds one Normalized
+ * Cumulative Square per channel. */
 #define DEFINE_INT_LEVEL_CALCULATOR(TYPE, RESOLUTION)                         \
 static void inline                                                            \
 gst_videoframe_audiolevel_calculate_##TYPE (gpointer data, guint num, guint channels,        \
                             gdouble *NCS)                                     \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
-  register guint j;                                                           \
-  gdouble squaresum = 0.0;           /* square sum of the input samples */    \
+  register guint i, j;                                                        \
   register gdouble square = 0.0;     /* Square */                             \
   gdouble normalizer;                /* divisor to get a [-1.0, 1.0] range */ \
                                                                               \
-  /* *NCS = 0.0; Normalized Cumulative Square */                              \
+  for (j = 0; j < channels; j++)                                              \
+    NCS[j] = 0.0;                                                             \
                                                                               \
-  for (j = 0; j < num; j += channels) {                                       \
-    square = ((gdouble) in[j]) * in[j];                                       \
-    squaresum += square;                                                      \
+  for (i = 0; i < num; i += channels) {                                       \
+    for (j = 0; j < channels; j++) {                                          \
+      square = ((gdouble) in[i + j]) * in[i + j];                             \
+      NCS[j] += square;                                                       \
+    }                                                                         \
   }                                                                           \
                                                                               \
   normalizer = (gdouble) (G_GINT64_CONSTANT(1) << (RESOLUTION * 2));          \
-  *NCS = squaresum / normalizer;                                              \
+  for (j = 0; j < channels; j++)                                              \
+    NCS[j] /= normalizer;                                                     \
 }
 
 DEFINE_INT_LEVEL_CALCULATOR (gint32, 31);
@@ -305,18 +313,18 @@ gst_videoframe_audiolevel_calculate_##TYPE (gpointer data, guint num, guint chan
                             gdouble *NCS)                                     \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
-  register guint j;                                                           \
-  gdouble squaresum = 0.0;           /* square sum of the input samples */    \
+  register guint i, j;                                                        \
   register gdouble square = 0.0;     /* Square */                             \
                                                                               \
-  /* *NCS = 0.0; Normalized Cumulative Square */                              \
+  for (j = 0; j < channels; j++)                                              \
+    NCS[j] = 0.0;                                                             \
                                                                               \
-  for (j = 0; j < num; j += channels) {                                       \
-    square = ((gdouble) in[j]) * in[j];                                       \
-    squaresum += square;                                                      \
+  for (i = 0; i < num; i += channels) {                                       \
+    for (j = 0; j < channels; j++) {                                          \
+      square = ((gdouble) in[i + j]) * in[i + j];                             \
+      NCS[j] += square;                                                       \
+    }                                                                         \
   }                                                                           \
-                                                                              \
-  *NCS = squaresum;                                                           \
 }
 
 DEFINE_FLOAT_LEVEL_CALCULATOR (gfloat);
@@ -441,7 +449,7 @@ update_rms_from_buffer (GstVideoFrameAudioLevel * self, GstBuffer * inbuf)
   GstMapInfo map;
   guint8 *in_data;
   gsize in_size;
-  gdouble CS;
+  gdouble *ncs;
   guint i;
   guint num_frames, frames;
   guint num_int_samples = 0;    /* number of interleaved samples
@@ -473,14 +481,14 @@ update_rms_from_buffer (GstVideoFrameAudioLevel * self, GstBuffer * inbuf)
   frames = num_frames;
   duration = GST_FRAMES_TO_CLOCK_TIME (frames, rate);
   if (num_frames > 0) {
+    ncs = g_newa (gdouble, channels);
+    self->process (in_data, num_int_samples, channels, ncs);
     for (i = 0; i < channels; ++i) {
-      self->process (in_data + (bps * i), num_int_samples, channels, &CS);
       GST_LOG_OBJECT (self,
           "[%d]: cumulative squares %lf, over %d samples/%d channels",
-          i, CS, num_int_samples, channels);
-      self->CS[i] += CS;
+          i, ncs[i], num_int_samples, channels);
+      self->CS[i] += ncs[i];
     }
-    in_data += num_frames * bps;
 
     self->total_frames += num_frames;
   }
@@ -647,8 +655,10 @@ gst_videoframe_audiolevel_asink_chain (GstPad * pad, GstObject * parent,
             gst_adapter_available (self->adapter));
         if (buf != NULL) {
           GstMessage *msg;
-          msg = update_rms_from_buffer (self, buf);
+          /* Analyze without the lock held, the video chain doesn't need to
+           * wait for us here */
           g_mutex_unlock (&self->mutex);
+          msg = update_rms_from_buffer (self, buf);
           gst_element_post_message (GST_ELEMENT (self), msg);
           gst_buffer_unref (buf);
           g_mutex_lock (&self->mutex);  /* we unlock again later */
@@ -728,8 +738,11 @@ gst_videoframe_audiolevel_asink_chain (GstPad * pad, GstObject * parent,
       /* Just an empty buffer */
       buf = gst_buffer_new ();
     }
-    msg = update_rms_from_buffer (self, buf);
+    /* The RMS state (CS, total_frames, first_time) is only ever touched
+     * from this streaming thread, so the analysis can run without the lock
+     * and the video chain only contends for the queue handoff itself */
     g_mutex_unlock (&self->mutex);
+    msg = update_rms_from_buffer (self, buf);
     gst_element_post_message (GST_ELEMENT (self), msg);
     g_mutex_lock (&self->mutex);
 
@@ -198,6 +198,14 @@ gst_h264_parse_reset_frame (GstH264Parse * h264parse)
   h264parse->aud_insert = TRUE;
   h264parse->have_sps_in_frame = FALSE;
   h264parse->have_pps_in_frame = FALSE;
+  h264parse->fastpath_frame = FALSE;
+  h264parse->fastpath_has_aud = FALSE;
+  h264parse->au_slice_count = 0;
+  h264parse->au_first_slice_type = 0;
+  h264parse->au_qp_delta_min = 0;
+  h264parse->au_qp_delta_max = 0;
+  h264parse->au_idr = FALSE;
+  h264parse->au_ref = FALSE;
   gst_adapter_clear (h264parse->frame_out);
 }
 
@@ -228,6 +236,7 @@ gst_h264_parse_reset_stream_info (GstH264Parse * h264parse)
   h264parse->nal_length_size = 4;
   h264parse->packetized = FALSE;
   h264parse->push_codec = FALSE;
+  h264parse->fastpath_aus = 0;
 
   gst_buffer_replace (&h264parse->codec_data, NULL);
   gst_buffer_replace (&h264parse->codec_data_in, NULL);
@@ -850,6 +859,23 @@ gst_h264_parse_process_nal (GstH264Parse * h264parse, GstH264NalUnit * nalu)
 
           h264parse->state |= GST_H264_PARSE_STATE_GOT_SLICE;
           h264parse->field_pic_flag = slice.field_pic_flag;
+
+          /* collect transcode hints for the AU meta; all of this was
+           * parsed above anyway */
+          if (h264parse->au_slice_count == 0) {
+            h264parse->au_first_slice_type = slice.type;
+            h264parse->au_qp_delta_min = slice.slice_qp_delta;
+            h264parse->au_qp_delta_max = slice.slice_qp_delta;
+          } else {
+            h264parse->au_qp_delta_min =
+                MIN (h264parse->au_qp_delta_min, slice.slice_qp_delta);
+            h264parse->au_qp_delta_max =
+                MAX (h264parse->au_qp_delta_max, slice.slice_qp_delta);
+          }
+          h264parse->au_slice_count++;
+          h264parse->au_ref |= nalu->ref_idc != 0;
+          if (nal_type == GST_H264_NAL_SLICE_IDR)
+            h264parse->au_idr = TRUE;
         }
       }
       if (G_LIKELY (nal_type != GST_H264_NAL_SLICE_IDR &&
@@ -1056,6 +1082,249 @@ gst_h264_parse_handle_frame_packetized (GstBaseParse * parse,
   return ret;
 }
 
+/* Private meta stamped on outgoing AUs. Further h264parse instances in
+ * the same process (e.g. one per branch behind a tee feeding several
+ * encoders) reuse the scan result instead of re-scanning the identical
+ * data, provided fastpath_ok is set. The remaining fields are transcode
+ * hints (IDR cadence, reference structure, slice QP range) that the
+ * parser extracts as a by-product of full parsing; downstream encoders
+ * may use them to seed their rate control without their own lookahead. */
+typedef struct
+{
+  GstMeta meta;
+
+  gboolean keyframe;
+  gboolean has_sei;
+  gboolean has_aud;
+  /* TRUE if the AU was verified conformant for the fast path: slices,
+   * SEI, AUD and filler only, no codec config or IDR */
+  gboolean fastpath_ok;
+
+  /* hints from full slice header parsing; only valid if slice_count > 0 */
+  guint slice_count;
+  guint first_slice_type;
+  gint qp_delta_min;
+  gint qp_delta_max;
+  gboolean idr;
+  gboolean ref;
+} GstH264ParseAUMeta;
+
+static GType
+gst_h264_parse_au_meta_api_get_type (void)
+{
+  static volatile GType type;
+  static const gchar *tags[] = { NULL };
+
+  if (g_once_init_enter (&type)) {
+    GType _type = gst_meta_api_type_register ("GstH264ParseAUMetaAPI", tags);
+    g_once_init_leave (&type, _type);
+  }
+  return type;
+}
+
+static gboolean
+gst_h264_parse_au_meta_init (GstMeta * meta, gpointer params,
+    GstBuffer * buffer)
+{
+  GstH264ParseAUMeta *aumeta = (GstH264ParseAUMeta *) meta;
+
+  aumeta->keyframe = FALSE;
+  aumeta->has_sei = FALSE;
+  aumeta->has_aud = FALSE;
+  aumeta->fastpath_ok = FALSE;
+  aumeta->slice_count = 0;
+  aumeta->first_slice_type = 0;
+  aumeta->qp_delta_min = 0;
+  aumeta->qp_delta_max = 0;
+  aumeta->idr = FALSE;
+  aumeta->ref = FALSE;
+
+  return TRUE;
+}
+
+static const GstMetaInfo *gst_h264_parse_au_meta_get_info (void);
+
+static gboolean
+gst_h264_parse_au_meta_transform (GstBuffer * dest, GstMeta * meta,
+    GstBuffer * buffer, GQuark type, gpointer data)
+{
+  GstH264ParseAUMeta *smeta = (GstH264ParseAUMeta *) meta;
+
+  if (GST_META_TRANSFORM_IS_COPY (type)) {
+    GstMetaTransformCopy *copy = data;
+    GstH264ParseAUMeta *dmeta;
+
+    /* the meta describes the complete AU only */
+    if (copy->region)
+      return FALSE;
+
+    dmeta = (GstH264ParseAUMeta *) gst_buffer_add_meta (dest,
+        gst_h264_parse_au_meta_get_info (), NULL);
+    if (!dmeta)
+      return FALSE;
+    dmeta->keyframe = smeta->keyframe;
+    dmeta->has_sei = smeta->has_sei;
+    dmeta->has_aud = smeta->has_aud;
+    dmeta->fastpath_ok = smeta->fastpath_ok;
+    dmeta->slice_count = smeta->slice_count;
+    dmeta->first_slice_type = smeta->first_slice_type;
+    dmeta->qp_delta_min = smeta->qp_delta_min;
+    dmeta->qp_delta_max = smeta->qp_delta_max;
+    dmeta->idr = smeta->idr;
+    dmeta->ref = smeta->ref;
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+static const GstMetaInfo *
+gst_h264_parse_au_meta_get_info (void)
+{
+  static const GstMetaInfo *info = NULL;
+
+  if (g_once_init_enter (&info)) {
+    const GstMetaInfo *_info =
+        gst_meta_register (gst_h264_parse_au_meta_api_get_type (),
+        "GstH264ParseAUMeta", sizeof (GstH264ParseAUMeta),
+        gst_h264_parse_au_meta_init, NULL, gst_h264_parse_au_meta_transform);
+    g_once_init_leave (&info, _info);
+  }
+  return info;
+}
+
+static GstH264ParseAUMeta *
+gst_h264_parse_get_au_meta (GstBuffer * buffer)
+{
+  return (GstH264ParseAUMeta *) gst_buffer_get_meta (buffer,
+      gst_h264_parse_au_meta_api_get_type ());
+}
+
+/* number of consecutive conformant AUs required before the cheap
+ * forwarding path below is attempted */
+#define GST_H264_PARSE_FASTPATH_MIN_AUS 16
+
+/* Quick slice_type decode from the start of a slice payload, used by the
+ * fast path to keep keyframe marking correct for open-GOP I slices.
+ * Reading without emulation prevention handling is safe here: we require
+ * first_mb_in_slice == 0, so the first payload byte has the top bit set
+ * and no 00 00 03 escape can occur within the bits we look at.
+ * Returns FALSE when inconclusive. */
+static gboolean
+gst_h264_parse_fastpath_slice_type (const GstH264NalUnit * nalu,
+    gboolean * keyframe)
+{
+  const guint8 *payload;
+  guint32 bits;
+  guint leading, slice_type;
+
+  if (nalu->size < nalu->header_bytes + 3)
+    return FALSE;
+
+  payload = nalu->data + nalu->offset + nalu->header_bytes;
+
+  /* first_mb_in_slice must be 0, i.e. ue(v) bit '1': a picture start */
+  if (!(payload[0] & 0x80))
+    return FALSE;
+
+  bits = ((guint32) payload[0] << 24) | ((guint32) payload[1] << 16) |
+      ((guint32) payload[2] << 8);
+  bits <<= 1;
+
+  /* slice_type ue(v) */
+  leading = 0;
+  while (leading < 8 && !(bits & 0x80000000)) {
+    bits <<= 1;
+    leading++;
+  }
+  /* slice_type <= 9 needs at most 3 leading zeros */
+  if (leading > 3)
+    return FALSE;
+  bits <<= 1;
+  slice_type = (1 << leading) - 1 + (leading ? (bits >> (32 - leading)) : 0);
+
+  /* I and SI slices, of either value range */
+  *keyframe = (slice_type == 2 || slice_type == 4
+      || slice_type == 7 || slice_type == 9);
+
+  return TRUE;
+}
+
+/* Cheap conformance scan for the verified fast path: returns TRUE iff the
+ * AU consists only of slice, SEI, AU delimiter and filler NALs, i.e. no
+ * codec config, no IDR, nothing that could change caps or require codec
+ * data insertion, and fills in the per-frame state the pre_push and
+ * parse_frame stages look at. Anything unexpected makes the caller drop
+ * back to full parsing. */
+static gboolean
+gst_h264_parse_fastpath_check_au (GstH264Parse * h264parse,
+    const guint8 * data, guint size)
+{
+  GstH264NalParser *nalparser = h264parse->nalparser;
+  GstH264NalUnit nalu;
+  GstH264ParserResult pres;
+  guint off = 0;
+  gboolean first = TRUE;
+  gboolean has_aud = FALSE, has_sei = FALSE;
+  gboolean keyframe = FALSE, frame_start = FALSE;
+
+  while (off < size) {
+    pres = gst_h264_parser_identify_nalu (nalparser, data, off, size, &nalu);
+
+    if (pres == GST_H264_PARSER_NO_NAL_END) {
+      /* input is AU aligned, so the last NAL ends with the buffer */
+      nalu.size = size - nalu.offset;
+      if (nalu.size < 2)
+        return FALSE;
+      off = size;
+    } else if (pres == GST_H264_PARSER_OK) {
+      off = nalu.offset + nalu.size;
+    } else {
+      return FALSE;
+    }
+
+    /* leading garbage or zero padding: let the full path deal with it */
+    if (first && nalu.sc_offset != 0)
+      return FALSE;
+
+    switch (nalu.type) {
+      case GST_H264_NAL_SLICE:
+        if (!frame_start) {
+          if (!gst_h264_parse_fastpath_slice_type (&nalu, &keyframe))
+            return FALSE;
+          frame_start = TRUE;
+        }
+        break;
+      case GST_H264_NAL_SEI:
+        has_sei = TRUE;
+        break;
+      case GST_H264_NAL_AU_DELIMITER:
+        has_aud = TRUE;
+        break;
+      case GST_H264_NAL_FILLER_DATA:
+        break;
+      default:
+        return FALSE;
+    }
+    first = FALSE;
+  }
+
+  if (!frame_start)
+    return FALSE;
+
+  h264parse->frame_start = TRUE;
+  h264parse->keyframe = keyframe;
+  h264parse->header = has_sei;
+  h264parse->state |= GST_H264_PARSE_STATE_GOT_SLICE;
+  if (has_aud)
+    h264parse->aud_insert = FALSE;
+  h264parse->fastpath_frame = TRUE;
+  h264parse->fastpath_has_aud = has_aud;
+
+  return TRUE;
+}
+
 static GstFlowReturn
 gst_h264_parse_handle_frame (GstBaseParse * parse,
     GstBaseParseFrame * frame, gint * skipsize)
@@ -1106,6 +1375,51 @@ gst_h264_parse_handle_frame (GstBaseParse * parse,
     GST_LOG_OBJECT (h264parse, "resuming frame parsing");
   }
 
+  /* Verified fast path: with byte-stream AU aligned input matching the
+   * negotiated output there is nothing to transform, so an AU containing
+   * no codec config and no IDR can be forwarded after a NAL type scan
+   * only. Engage only once enough consecutive AUs went through full
+   * parsing without anomalies; anything unexpected re-arms it */
+  if (h264parse->can_passthrough
+      && h264parse->in_align == GST_H264_PARSE_ALIGN_AU
+      && (frame->flags & GST_BASE_PARSE_FRAME_FLAG_NEW_FRAME)
+      && !h264parse->push_codec
+      && GST_H264_PARSE_STATE_VALID (h264parse,
+          GST_H264_PARSE_STATE_VALID_PICTURE_HEADERS)) {
+    GstH264ParseAUMeta *aumeta = gst_h264_parse_get_au_meta (buffer);
+
+    /* An AU already verified by another h264parse instance (e.g. the one
+     * ahead of a tee feeding this branch) can be trusted without even
+     * scanning the NALs again. The meta alone is not enough: fully parsed
+     * AUs also carry it for the transcode hints, but may contain codec
+     * config or IDR NALs the fast path must not skip over */
+    if (aumeta && aumeta->fastpath_ok) {
+      GST_LOG_OBJECT (h264parse, "AU verified upstream, forwarding untouched");
+      h264parse->frame_start = TRUE;
+      h264parse->keyframe = aumeta->keyframe;
+      h264parse->header = aumeta->has_sei;
+      h264parse->state |= GST_H264_PARSE_STATE_GOT_SLICE;
+      if (aumeta->has_aud)
+        h264parse->aud_insert = FALSE;
+      h264parse->fastpath_frame = TRUE;
+      h264parse->fastpath_has_aud = aumeta->has_aud;
+      gst_buffer_unmap (buffer, &map);
+      gst_h264_parse_parse_frame (parse, frame);
+      return gst_base_parse_finish_frame (parse, frame, size);
+    }
+
+    if (h264parse->fastpath_aus >= GST_H264_PARSE_FASTPATH_MIN_AUS) {
+      if (gst_h264_parse_fastpath_check_au (h264parse, data, size)) {
+        GST_LOG_OBJECT (h264parse, "conformant AU, forwarding untouched");
+        gst_buffer_unmap (buffer, &map);
+        gst_h264_parse_parse_frame (parse, frame);
+        return gst_base_parse_finish_frame (parse, frame, size);
+      }
+      GST_DEBUG_OBJECT (h264parse, "non-trivial AU, re-arming full parsing");
+      h264parse->fastpath_aus = 0;
+    }
+  }
+
   /* Always consume the entire input buffer when in_align == ALIGN_AU */
   drain = GST_BASE_PARSE_DRAINING (parse)
       || h264parse->in_align == GST_H264_PARSE_ALIGN_AU;
@@ -1276,6 +1590,11 @@ end:
 
   gst_buffer_unmap (buffer, &map);
 
+  /* another AU went through full parsing without surprises */
+  if (h264parse->can_passthrough
+      && h264parse->in_align == GST_H264_PARSE_ALIGN_AU)
+    h264parse->fastpath_aus++;
+
   gst_h264_parse_parse_frame (parse, frame);
 
   return gst_base_parse_finish_frame (parse, frame, framesize);
@@ -1298,6 +1617,7 @@ drop:
 
 skip:
   GST_DEBUG_OBJECT (h264parse, "skipping %d", *skipsize);
+  h264parse->fastpath_aus = 0;
   /* If we are collecting access units, we need to preserve the initial
    * config headers (SPS, PPS et al.) and only reset the frame if another
    * slice NAL was received. This means that broken pictures are discarded */
@@ -2550,6 +2870,30 @@ gst_h264_parse_pre_push_frame (GstBaseParse * parse, GstBaseParseFrame * frame)
   }
 #endif
 
+  /* Stamp outgoing AUs so that further h264parse instances downstream
+   * (e.g. in the branches of a tee) can trust the result and skip their
+   * own NAL scan, and so that encoders can pick up the transcode hints
+   * collected while parsing the slice headers */
+  if ((h264parse->fastpath_frame || h264parse->frame_start)
+      && gst_buffer_is_writable (buffer)
+      && !gst_h264_parse_get_au_meta (buffer)) {
+    GstH264ParseAUMeta *aumeta = (GstH264ParseAUMeta *)
+        gst_buffer_add_meta (buffer, gst_h264_parse_au_meta_get_info (), NULL);
+
+    aumeta->keyframe = h264parse->keyframe;
+    aumeta->has_sei = h264parse->header;
+    /* either in-stream, or just prepended above */
+    aumeta->has_aud = !h264parse->aud_insert || (buffer == frame->out_buffer);
+    aumeta->fastpath_ok = h264parse->fastpath_frame;
+    /* all zero for fast path frames, whose slice headers are not parsed */
+    aumeta->slice_count = h264parse->au_slice_count;
+    aumeta->first_slice_type = h264parse->au_first_slice_type;
+    aumeta->qp_delta_min = h264parse->au_qp_delta_min;
+    aumeta->qp_delta_max = h264parse->au_qp_delta_max;
+    aumeta->idr = h264parse->au_idr;
+    aumeta->ref = h264parse->au_ref;
+  }
+
   gst_h264_parse_reset_frame (h264parse);
 
   return GST_FLOW_OK;
@@ -77,6 +77,9 @@ struct _GstH264Parse
   gint current_off;
   /* True if input format and alignment match negotiated output */
   gboolean can_passthrough;
+  /* number of consecutive conformant AUs seen; once enough accumulated,
+   * trivial AUs are forwarded after a cheap NAL type scan only */
+  guint fastpath_aus;
 
   GstClockTime last_report;
   gboolean push_codec;
@@ -122,6 +125,20 @@ struct _GstH264Parse
   /* AU state */
   gboolean picture_start;
 
+  /* TRUE if the current frame went through the verified fast path and can
+   * be stamped with the AU meta other h264parse instances will trust */
+  gboolean fastpath_frame;
+  gboolean fastpath_has_aud;
+
+  /* transcode hints collected while parsing the slices of the current AU,
+   * exported in the AU meta for downstream consumers */
+  guint au_slice_count;
+  guint au_first_slice_type;
+  gint au_qp_delta_min;
+  gint au_qp_delta_max;
+  gboolean au_idr;
+  gboolean au_ref;
+
   /* props */
   gint interval;
 
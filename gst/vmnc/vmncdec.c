@@ -533,16 +533,35 @@ static void
 render_subrect (GstVMncDec * dec, int x, int y, int width,
     int height, guint32 colour)
 {
-  /* Crazy inefficient! */
   int i, j;
-  guint8 *dst;
+  guint8 *dstraw = dec->imagedata + dec->format.stride * y +
+      dec->format.bytes_per_pixel * x;
 
-  for (i = 0; i < height; i++) {
-    dst = dec->imagedata + dec->format.stride * (y + i) +
-        dec->format.bytes_per_pixel * x;
-    for (j = 0; j < width; j++) {
-      memcpy (dst, &colour, dec->format.bytes_per_pixel);
-      dst += dec->format.bytes_per_pixel;
+  /* Solid fills per pixel size; these rows compile to memset-style
+   * vectorized fills, unlike a per-pixel memcpy of the colour */
+  if (dec->format.bytes_per_pixel == 1) {
+    guint8 *dst = dstraw;
+
+    for (i = 0; i < height; i++) {
+      memset (dst, colour, width);
+      dst += dec->format.stride;
+    }
+  } else if (dec->format.bytes_per_pixel == 2) {
+    guint16 *dst = (guint16 *) dstraw;
+    guint16 col = colour;
+
+    for (i = 0; i < height; i++) {
+      for (j = 0; j < width; j++)
+        dst[j] = col;
+      dst += dec->format.width;
+    }
+  } else {
+    guint32 *dst = (guint32 *) dstraw;
+
+    for (i = 0; i < height; i++) {
+      for (j = 0; j < width; j++)
+        dst[j] = colour;
+      dst += dec->format.width;
     }
   }
 }
@@ -639,24 +639,26 @@ gst_y4m_dec_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   }
 
   while (1) {
+    const guint8 *data, *eol;
+
     n_avail = gst_adapter_available (y4mdec->adapter);
     if (n_avail < MAX_HEADER_LENGTH)
       break;
 
-    gst_adapter_copy (y4mdec->adapter, (guint8 *) header, 0, MAX_HEADER_LENGTH);
-    header[MAX_HEADER_LENGTH - 1] = 0;
-    for (i = 0; i < MAX_HEADER_LENGTH; i++) {
-      if (header[i] == 0x0a)
-        header[i] = 0;
-    }
-    if (memcmp (header, "FRAME", 5) != 0) {
+    /* peek at the frame header in place instead of copying it out of the
+     * adapter for every frame */
+    data = gst_adapter_map (y4mdec->adapter, MAX_HEADER_LENGTH);
+    if (memcmp (data, "FRAME", 5) != 0) {
+      gst_adapter_unmap (y4mdec->adapter);
       GST_ELEMENT_ERROR (y4mdec, STREAM, DECODE,
           ("Failed to parse YUV4MPEG frame"), (NULL));
       flow_ret = GST_FLOW_ERROR;
       break;
     }
 
-    len = strlen (header);
+    eol = memchr (data, 0x0a, MAX_HEADER_LENGTH);
+    len = (eol != NULL) ? eol - data : MAX_HEADER_LENGTH - 1;
+    gst_adapter_unmap (y4mdec->adapter);
     if (n_avail < y4mdec->info.size + len + 1) {
       /* not enough data */
       GST_DEBUG ("not enough data for frame %d < %" G_GSIZE_FORMAT,
@@ -165,6 +165,8 @@ gst_yadif_class_init (GstYadifClass * klass)
 static void
 gst_yadif_init (GstYadif * yadif)
 {
+  g_mutex_init (&yadif->task_lock);
+  g_cond_init (&yadif->task_cond);
 }
 
 void
@@ -212,9 +214,10 @@ gst_yadif_dispose (GObject * object)
 void
 gst_yadif_finalize (GObject * object)
 {
-  /* GstYadif *yadif = GST_YADIF (object); */
+  GstYadif *yadif = GST_YADIF (object);
 
-  /* clean up object here */
+  g_mutex_clear (&yadif->task_lock);
+  g_cond_clear (&yadif->task_cond);
 
   G_OBJECT_CLASS (gst_yadif_parent_class)->finalize (object);
 }
@@ -277,9 +280,28 @@ gst_yadif_get_unit_size (GstBaseTransform * trans, GstCaps * caps, gsize * size)
   return FALSE;
 }
 
+/* more workers than this stop paying off: the per-band work becomes too
+ * small compared to the dispatch/wakeup cost even at 2160p */
+#define GST_YADIF_MAX_WORKERS 8
+
+void yadif_filter_task (gpointer data, gpointer user_data);
+
 static gboolean
 gst_yadif_start (GstBaseTransform * trans)
 {
+  GstYadif *yadif = GST_YADIF (trans);
+
+  yadif->n_workers = MIN (g_get_num_processors (), GST_YADIF_MAX_WORKERS);
+  if (yadif->n_workers > 1) {
+    yadif->worker_pool = g_thread_pool_new (yadif_filter_task, yadif,
+        yadif->n_workers, TRUE, NULL);
+    if (yadif->worker_pool == NULL) {
+      GST_WARNING_OBJECT (yadif,
+          "failed to create worker pool, filtering single-threaded");
+      yadif->n_workers = 1;
+    }
+  }
+  yadif->tasks_pending = 0;
 
   return TRUE;
 }
@@ -287,6 +309,12 @@ gst_yadif_start (GstBaseTransform * trans)
 static gboolean
 gst_yadif_stop (GstBaseTransform * trans)
 {
+  GstYadif *yadif = GST_YADIF (trans);
+
+  if (yadif->worker_pool) {
+    g_thread_pool_free (yadif->worker_pool, FALSE, TRUE);
+    yadif->worker_pool = NULL;
+  }
 
   return TRUE;
 }
@@ -53,6 +53,14 @@ struct _GstYadif
   GstVideoFrame cur_frame;
   GstVideoFrame next_frame;
   GstVideoFrame dest_frame;
+
+  /* slice threading: each frame is split into horizontal bands that are
+   * filtered in parallel on a persistent worker pool */
+  GThreadPool *worker_pool;
+  guint n_workers;
+  GMutex task_lock;
+  GCond task_cond;
+  guint tasks_pending;
 };
 
 struct _GstYadifClass
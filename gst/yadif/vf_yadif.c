@@ -89,7 +89,12 @@
         next2++; \
     }
 
-static void
+/* also used by the x86-64 dispatcher for tail pixels */
+void filter_line_c (guint8 * dst,
+    guint8 * prev, guint8 * cur, guint8 * next,
+    int w, int prefs, int mrefs, int parity, int mode);
+
+void
 filter_line_c (guint8 * dst,
     guint8 * prev, guint8 * cur, guint8 * next,
     int w, int prefs, int mrefs, int parity, int mode)
@@ -116,55 +121,118 @@ FILTER}
 #endif
 
 void yadif_filter (GstYadif * yadif, int parity, int tff);
+void yadif_filter_task (gpointer data, gpointer user_data);
 #ifdef HAVE_CPU_X86_64
 void filter_line_x86_64 (guint8 * dst,
     guint8 * prev, guint8 * cur, guint8 * next,
     int w, int prefs, int mrefs, int parity, int mode);
 #endif
 
+/* one horizontal band of one component; bands are independent because a
+ * filtered line only writes its own output row and reads its neighbouring
+ * input rows */
+typedef struct
+{
+  GstYadif *yadif;
+  int parity;
+  int tff;
+  int component;
+  int y0, y1;
+} YadifSliceTask;
+
+static void
+yadif_filter_slice (GstYadif * yadif, int parity, int tff, int i,
+    int y0, int y1)
+{
+  int y;
+  const GstVideoInfo *vi = &yadif->video_info;
+  const GstVideoFormatInfo *vfi = vi->finfo;
+  int w = GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (vfi, i, vi->width);
+  int h = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (vfi, i, vi->height);
+  int refs = GST_VIDEO_INFO_COMP_STRIDE (vi, i);
+  int df = GST_VIDEO_INFO_COMP_PSTRIDE (vi, i);
+  guint8 *prev_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->prev_frame, i);
+  guint8 *cur_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->cur_frame, i);
+  guint8 *next_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->next_frame, i);
+  guint8 *dest_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->dest_frame, i);
+
+  for (y = y0; y < y1; y++) {
+    if ((y ^ parity) & 1) {
+      guint8 *prev = prev_data + y * refs;
+      guint8 *cur = cur_data + y * refs;
+      guint8 *next = next_data + y * refs;
+      guint8 *dst = dest_data + y * refs;
+      int mode = ((y == 1) || (y + 2 == h)) ? 2 : yadif->mode;
+#if HAVE_CPU_X86_64
+      filter_line_x86_64 (dst, prev, cur, next, w,
+          y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
+#else
+      filter_line_c (dst, prev, cur, next, w,
+          y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
+#endif
+    } else {
+      guint8 *dst = dest_data + y * refs;
+      guint8 *cur = cur_data + y * refs;
+
+      memcpy (dst, cur, w * df);
+    }
+  }
+}
+
+void
+yadif_filter_task (gpointer data, gpointer user_data)
+{
+  YadifSliceTask *task = data;
+  GstYadif *yadif = task->yadif;
+
+  yadif_filter_slice (yadif, task->parity, task->tff, task->component,
+      task->y0, task->y1);
+  g_slice_free (YadifSliceTask, task);
+
+  g_mutex_lock (&yadif->task_lock);
+  if (--yadif->tasks_pending == 0)
+    g_cond_signal (&yadif->task_cond);
+  g_mutex_unlock (&yadif->task_lock);
+}
+
 void
 yadif_filter (GstYadif * yadif, int parity, int tff)
 {
-  int y, i;
+  int i;
   const GstVideoInfo *vi = &yadif->video_info;
   const GstVideoFormatInfo *vfi = vi->finfo;
 
   for (i = 0; i < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (vfi); i++) {
-    int w = GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (vfi, i, vi->width);
     int h = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (vfi, i, vi->height);
-    int refs = GST_VIDEO_INFO_COMP_STRIDE (vi, i);
-    int df = GST_VIDEO_INFO_COMP_PSTRIDE (vi, i);
-    guint8 *prev_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->prev_frame, i);
-    guint8 *cur_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->cur_frame, i);
-    guint8 *next_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->next_frame, i);
-    guint8 *dest_data = GST_VIDEO_FRAME_COMP_DATA (&yadif->dest_frame, i);
-
-    for (y = 0; y < h; y++) {
-      if ((y ^ parity) & 1) {
-        guint8 *prev = prev_data + y * refs;
-        guint8 *cur = cur_data + y * refs;
-        guint8 *next = next_data + y * refs;
-        guint8 *dst = dest_data + y * refs;
-        int mode = ((y == 1) || (y + 2 == h)) ? 2 : yadif->mode;
-#if HAVE_CPU_X86_64
-        if (0) {
-          filter_line_c (dst, prev, cur, next, w,
-              y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
-        } else {
-          filter_line_x86_64 (dst, prev, cur, next, w,
-              y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
-        }
-#else
-        filter_line_c (dst, prev, cur, next, w,
-            y + 1 < h ? refs : -refs, y ? -refs : refs, parity ^ tff, mode);
-#endif
-      } else {
-        guint8 *dst = dest_data + y * refs;
-        guint8 *cur = cur_data + y * refs;
+    guint n_bands = yadif->n_workers;
+    guint b;
+
+    /* not worth dispatching bands of a couple of lines each */
+    if (!yadif->worker_pool || h < (int) (8 * n_bands)) {
+      yadif_filter_slice (yadif, parity, tff, i, 0, h);
+      continue;
+    }
+
+    g_mutex_lock (&yadif->task_lock);
+    yadif->tasks_pending = n_bands;
+    g_mutex_unlock (&yadif->task_lock);
 
-        memcpy (dst, cur, w * df);
-      }
+    for (b = 0; b < n_bands; b++) {
+      YadifSliceTask *task = g_slice_new (YadifSliceTask);
+
+      task->yadif = yadif;
+      task->parity = parity;
+      task->tff = tff;
+      task->component = i;
+      task->y0 = h * b / n_bands;
+      task->y1 = h * (b + 1) / n_bands;
+      g_thread_pool_push (yadif->worker_pool, task, NULL);
     }
+
+    g_mutex_lock (&yadif->task_lock);
+    while (yadif->tasks_pending > 0)
+      g_cond_wait (&yadif->task_cond, &yadif->task_lock);
+    g_mutex_unlock (&yadif->task_lock);
   }
 
 #if 0
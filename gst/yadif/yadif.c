@@ -54,6 +54,9 @@ DECLARE_ASM_CONST (16, xmm_reg, pw_1) = {
 
 
 #define HAVE_SSE2_INLINE 1
+/* the SSSE3 variant only needs pabsw on top of SSE2, which any GNU
+ * assembler emits regardless of -m flags; selection happens at runtime */
+#define HAVE_SSSE3_INLINE 1
 
 #if HAVE_SSSE3_INLINE
 #define COMPILE_TEMPLATE_SSE2 1
@@ -82,26 +85,46 @@ void filter_line_x86_64 (guint8 * dst,
     guint8 * prev, guint8 * cur, guint8 * next,
     int w, int prefs, int mrefs, int parity, int mode);
 
+/* C version, for the tail the vector loop doesn't cover */
+void filter_line_c (guint8 * dst,
+    guint8 * prev, guint8 * cur, guint8 * next,
+    int w, int prefs, int mrefs, int parity, int mode);
+
+typedef void (*YadifFilterLineFunc) (guint8 * dst,
+    guint8 * prev, guint8 * cur, guint8 * next,
+    int w, int prefs, int mrefs, int parity, int mode);
+
 void
 filter_line_x86_64 (guint8 * dst,
     guint8 * prev, guint8 * cur, guint8 * next,
     int w, int prefs, int mrefs, int parity, int mode)
 {
-#if 0
-#if HAVE_MMXEXT_INLINE
-  if (cpu_flags & AV_CPU_FLAG_MMXEXT)
-    yadif->filter_line = yadif_filter_line_mmxext;
-#endif
-#if HAVE_SSE2_INLINE
-  if (cpu_flags & AV_CPU_FLAG_SSE2)
-    yadif->filter_line = yadif_filter_line_sse2;
-#endif
+  static YadifFilterLineFunc filter_line_impl = NULL;
+  /* both variants process 8 pixels per iteration */
+  int w_aligned = w & ~7;
+
+  /* benign race: all threads compute the same pointer */
+  if (G_UNLIKELY (filter_line_impl == NULL)) {
+    YadifFilterLineFunc impl = NULL;
+
 #if HAVE_SSSE3_INLINE
-  if (cpu_flags & AV_CPU_FLAG_SSSE3)
-    yadif->filter_line = yadif_filter_line_ssse3;
+    if (__builtin_cpu_supports ("ssse3"))
+      impl = yadif_filter_line_ssse3;
 #endif
+#if HAVE_SSE2_INLINE
+    if (impl == NULL)
+      impl = yadif_filter_line_sse2;        /* x86-64 baseline */
 #endif
-  yadif_filter_line_sse2 (dst, prev, cur, next, w, prefs, mrefs, parity, mode);
+    filter_line_impl = impl;
+  }
+
+  if (w_aligned)
+    filter_line_impl (dst, prev, cur, next, w_aligned, prefs, mrefs,
+        parity, mode);
+  /* the vector loop would write past w; finish the remainder in C */
+  if (w_aligned < w)
+    filter_line_c (dst + w_aligned, prev + w_aligned, cur + w_aligned,
+        next + w_aligned, w - w_aligned, prefs, mrefs, parity, mode);
 }
 
 #endif
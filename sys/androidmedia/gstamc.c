@@ -183,6 +183,10 @@ gst_amc_codec_free (GstAmcCodec * codec)
   codec->output_buffers = NULL;
   codec->n_output_buffers = 0;
 
+  if (codec->buffer_info)
+    gst_amc_jni_object_unref (env, codec->buffer_info);
+  codec->buffer_info = NULL;
+
   gst_amc_jni_object_unref (env, codec->object);
   g_slice_free (GstAmcCodec, codec);
 }
@@ -533,20 +537,25 @@ gst_amc_codec_dequeue_output_buffer (GstAmcCodec * codec,
 {
   JNIEnv *env;
   gint ret = G_MININT;
-  jobject info_o = NULL;
 
   g_return_val_if_fail (codec != NULL, G_MININT);
 
   env = gst_amc_jni_get_env ();
 
-  info_o =
-      gst_amc_jni_new_object (env, err, FALSE, media_codec_buffer_info.klass,
-      media_codec_buffer_info.constructor);
-  if (!info_o)
-    goto done;
+  /* dequeueOutputBuffer() is only ever called from the one thread that
+   * drains the codec, so a single BufferInfo instance can be reused for
+   * every call instead of allocating a new Java object each time */
+  if (!codec->buffer_info) {
+    codec->buffer_info =
+        gst_amc_jni_new_object (env, err, TRUE, media_codec_buffer_info.klass,
+        media_codec_buffer_info.constructor);
+    if (!codec->buffer_info)
+      goto done;
+  }
 
   if (!gst_amc_jni_call_int_method (env, err, codec->object,
-          media_codec.dequeue_output_buffer, &ret, info_o, timeoutUs)) {
+          media_codec.dequeue_output_buffer, &ret, codec->buffer_info,
+          timeoutUs)) {
     ret = G_MININT;
     goto done;
   }
@@ -567,23 +576,19 @@ gst_amc_codec_dequeue_output_buffer (GstAmcCodec * codec,
       }
     }
     if (ret == INFO_OUTPUT_BUFFERS_CHANGED) {
-      gst_amc_jni_object_local_unref (env, info_o);
       return gst_amc_codec_dequeue_output_buffer (codec, info, timeoutUs, err);
     }
   } else if (ret < 0) {
     goto done;
   }
 
-  if (ret >= 0 && !gst_amc_codec_fill_buffer_info (env, info_o, info, err)) {
+  if (ret >= 0 && !gst_amc_codec_fill_buffer_info (env, codec->buffer_info,
+          info, err)) {
     ret = G_MININT;
     goto done;
   }
 
 done:
-  if (info_o)
-    gst_amc_jni_object_local_unref (env, info_o);
-  info_o = NULL;
-
   return ret;
 }
 
@@ -2305,6 +2310,28 @@ gst_amc_color_format_info_set (GstAmcColorFormatInfo * color_format_info,
   return TRUE;
 }
 
+/* Copies one plane between the codec buffer and the video buffer. When
+ * neither side has any row padding the rows are contiguous and the whole
+ * plane goes through a single large copy instead of one copy per row */
+static void
+gst_amc_color_format_copy_plane (guint8 ** dest, guint8 ** src,
+    guint8 ** cptr, gint c_stride, guint8 ** vptr, gint v_stride,
+    gint row_length, gint height)
+{
+  gint j;
+
+  if (c_stride == v_stride && row_length == c_stride) {
+    orc_memcpy (*dest, *src, height * row_length);
+    return;
+  }
+
+  for (j = 0; j < height; j++) {
+    orc_memcpy (*dest, *src, row_length);
+    *cptr += c_stride;
+    *vptr += v_stride;
+  }
+}
+
 /* The weird handling of cropping, alignment and everything is taken from
  * platform/frameworks/media/libstagefright/colorconversion/ColorConversion.cpp
  */
@@ -2350,7 +2377,7 @@ gst_amc_color_format_copy (GstAmcColorFormatInfo * cinfo,
   switch (cinfo->color_format) {
     case COLOR_FormatYUV420Planar:{
       GstVideoFrame vframe;
-      gint i, j, height;
+      gint i, height;
       gint stride, slice_height;
       gint c_stride, v_stride;
       gint row_length;
@@ -2395,11 +2422,8 @@ gst_amc_color_format_copy (GstAmcColorFormatInfo * cinfo,
         vptr = GST_VIDEO_FRAME_COMP_DATA (&vframe, i);
         height = GST_VIDEO_FRAME_COMP_HEIGHT (&vframe, i);
 
-        for (j = 0; j < height; j++) {
-          orc_memcpy (*dest, *src, row_length);
-          cptr += c_stride;
-          vptr += v_stride;
-        }
+        gst_amc_color_format_copy_plane (dest, src, &cptr, c_stride,
+            &vptr, v_stride, row_length, height);
       }
       gst_video_frame_unmap (&vframe);
       ret = TRUE;
@@ -2407,7 +2431,7 @@ gst_amc_color_format_copy (GstAmcColorFormatInfo * cinfo,
     }
     case COLOR_TI_FormatYUV420PackedSemiPlanar:
     case COLOR_TI_FormatYUV420PackedSemiPlanarInterlaced:{
-      gint i, j, height;
+      gint i, height;
       gint c_stride, v_stride;
       gint row_length;
       GstVideoFrame vframe;
@@ -2438,11 +2462,8 @@ gst_amc_color_format_copy (GstAmcColorFormatInfo * cinfo,
         vptr = GST_VIDEO_FRAME_COMP_DATA (&vframe, i);
         height = GST_VIDEO_FRAME_COMP_HEIGHT (&vframe, i);
 
-        for (j = 0; j < height; j++) {
-          orc_memcpy (*dest, *src, row_length);
-          cptr += c_stride;
-          vptr += v_stride;
-        }
+        gst_amc_color_format_copy_plane (dest, src, &cptr, c_stride,
+            &vptr, v_stride, row_length, height);
       }
       gst_video_frame_unmap (&vframe);
       ret = TRUE;
@@ -2452,7 +2473,7 @@ gst_amc_color_format_copy (GstAmcColorFormatInfo * cinfo,
     case COLOR_QCOM_FormatYVU420SemiPlanar32m:
     case COLOR_QCOM_FormatYVU420SemiPlanar32mMultiView:
     case COLOR_FormatYUV420SemiPlanar:{
-      gint i, j, height;
+      gint i, height;
       gint c_stride, v_stride;
       gint row_length;
       GstVideoFrame vframe;
@@ -2481,11 +2502,8 @@ gst_amc_color_format_copy (GstAmcColorFormatInfo * cinfo,
         vptr = GST_VIDEO_FRAME_COMP_DATA (&vframe, i);
         height = GST_VIDEO_FRAME_COMP_HEIGHT (&vframe, i);
 
-        for (j = 0; j < height; j++) {
-          orc_memcpy (*dest, *src, row_length);
-          cptr += c_stride;
-          vptr += v_stride;
-        }
+        gst_amc_color_format_copy_plane (dest, src, &cptr, c_stride,
+            &vptr, v_stride, row_length, height);
       }
       gst_video_frame_unmap (&vframe);
       ret = TRUE;
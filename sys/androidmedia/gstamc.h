@@ -69,6 +69,8 @@ struct _GstAmcCodec {
 
   GstAmcBuffer *input_buffers, *output_buffers;
   gsize n_input_buffers, n_output_buffers;
+
+  jobject buffer_info; /* global reference */
 };
 
 struct _GstAmcBufferInfo {
@@ -663,14 +663,62 @@ gst_decklink_video_src_got_frame (GstElement * element,
 {
   GstDecklinkVideoSrc *self = GST_DECKLINK_VIDEO_SRC_CAST (element);
   GstClockTime timestamp, duration;
+  GstVideoTimeCode *tc = NULL;
 
   GST_LOG_OBJECT (self,
       "Got video frame at %" GST_TIME_FORMAT " / %" GST_TIME_FORMAT " (%"
       GST_TIME_FORMAT "), no signal: %d", GST_TIME_ARGS (capture_time),
       GST_TIME_ARGS (stream_time), GST_TIME_ARGS (stream_duration), no_signal);
 
-  if (self->drop_no_signal_frames && no_signal)
+  if (self->drop_no_signal_frames && no_signal) {
+    if (dtc != NULL)
+      dtc->Release ();
     return;
+  }
+
+  /* Parse the timecode before taking the lock, it only depends on the mode.
+   * This runs on the driver's capture thread and create() blocks on the same
+   * lock, so keep the critical section as short as possible. */
+  if (dtc != NULL) {
+    uint8_t hours, minutes, seconds, frames;
+    HRESULT res;
+
+    res = dtc->GetComponents (&hours, &minutes, &seconds, &frames);
+    if (res != S_OK) {
+      GST_ERROR ("Could not get components for timecode %p: 0x%08lx", dtc,
+          (unsigned long) res);
+    } else {
+      GstVideoTimeCodeFlags flags = GST_VIDEO_TIME_CODE_FLAGS_NONE;
+      const GstDecklinkMode *bmode;
+
+      GST_DEBUG_OBJECT (self, "Got timecode %02d:%02d:%02d:%02d",
+          hours, minutes, seconds, frames);
+      bmode = gst_decklink_get_mode (mode);
+      if (bmode->interlaced)
+        flags =
+            (GstVideoTimeCodeFlags) (flags |
+            GST_VIDEO_TIME_CODE_FLAGS_INTERLACED);
+      if (bmode->fps_d == 1001) {
+        if (bmode->fps_n == 30000 || bmode->fps_n == 60000) {
+          /* Some occurrences have been spotted where the driver mistakenly
+           * fails to set the drop-frame flag for drop-frame timecodes.
+           * Assume always drop-frame for 29.97 and 59.94 FPS */
+          flags =
+              (GstVideoTimeCodeFlags) (flags |
+              GST_VIDEO_TIME_CODE_FLAGS_DROP_FRAME);
+        } else {
+          /* Drop-frame isn't defined for any other framerates (e.g. 23.976)
+           * */
+          flags =
+              (GstVideoTimeCodeFlags) (flags &
+              ~GST_VIDEO_TIME_CODE_FLAGS_DROP_FRAME);
+        }
+      }
+      tc = gst_video_time_code_new (bmode->fps_n, bmode->fps_d, NULL, flags,
+          hours, minutes, seconds, frames, 0);
+    }
+    dtc->Release ();
+  }
 
   g_mutex_lock (&self->lock);
   if (self->first_time == GST_CLOCK_TIME_NONE)
@@ -683,6 +731,8 @@ gst_decklink_video_src_got_frame (GstElement * element,
         "Skipping frame as requested: %" GST_TIME_FORMAT " < %" GST_TIME_FORMAT,
         GST_TIME_ARGS (stream_time),
         GST_TIME_ARGS (self->skip_first_time + self->first_time));
+    if (tc != NULL)
+      gst_video_time_code_free (tc);
     return;
   }
 
@@ -706,9 +756,6 @@ gst_decklink_video_src_got_frame (GstElement * element,
 
   if (!self->flushing) {
     CaptureFrame f;
-    const GstDecklinkMode *bmode;
-    GstVideoTimeCodeFlags flags = GST_VIDEO_TIME_CODE_FLAGS_NONE;
-    guint field_count = 0;
     guint skipped_frames = 0;
     GstClockTime from_timestamp = GST_CLOCK_TIME_NONE;
     GstClockTime to_timestamp = GST_CLOCK_TIME_NONE;
@@ -741,53 +788,17 @@ gst_decklink_video_src_got_frame (GstElement * element,
     f.mode = mode;
     f.format = frame->GetPixelFormat ();
     f.no_signal = no_signal;
-    if (dtc != NULL) {
-      uint8_t hours, minutes, seconds, frames;
-      HRESULT res;
-
-      res = dtc->GetComponents (&hours, &minutes, &seconds, &frames);
-      if (res != S_OK) {
-        GST_ERROR ("Could not get components for timecode %p: 0x%08lx", dtc,
-            (unsigned long) res);
-        f.tc = NULL;
-      } else {
-        GST_DEBUG_OBJECT (self, "Got timecode %02d:%02d:%02d:%02d",
-            hours, minutes, seconds, frames);
-        bmode = gst_decklink_get_mode (mode);
-        if (bmode->interlaced)
-          flags =
-              (GstVideoTimeCodeFlags) (flags |
-              GST_VIDEO_TIME_CODE_FLAGS_INTERLACED);
-        if (bmode->fps_d == 1001) {
-          if (bmode->fps_n == 30000 || bmode->fps_n == 60000) {
-            /* Some occurrences have been spotted where the driver mistakenly
-             * fails to set the drop-frame flag for drop-frame timecodes.
-             * Assume always drop-frame for 29.97 and 59.94 FPS */
-            flags =
-                (GstVideoTimeCodeFlags) (flags |
-                GST_VIDEO_TIME_CODE_FLAGS_DROP_FRAME);
-          } else {
-            /* Drop-frame isn't defined for any other framerates (e.g. 23.976)
-             * */
-            flags =
-                (GstVideoTimeCodeFlags) (flags &
-                ~GST_VIDEO_TIME_CODE_FLAGS_DROP_FRAME);
-          }
-        }
-        f.tc =
-            gst_video_time_code_new (bmode->fps_n, bmode->fps_d, NULL, flags,
-            hours, minutes, seconds, frames, field_count);
-      }
-      dtc->Release ();
-    } else {
-      f.tc = NULL;
-    }
+    f.tc = tc;
+    tc = NULL;
 
     frame->AddRef ();
     gst_queue_array_push_tail_struct (self->current_frames, &f);
     g_cond_signal (&self->cond);
   }
   g_mutex_unlock (&self->lock);
+
+  if (tc != NULL)
+    gst_video_time_code_free (tc);
 }
 
 static void
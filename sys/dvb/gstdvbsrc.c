@@ -198,7 +198,8 @@ enum
   ARG_DVBSRC_LNB_SLOF,
   ARG_DVBSRC_LNB_LOF1,
   ARG_DVBSRC_LNB_LOF2,
-  ARG_DVBSRC_INTERLEAVING
+  ARG_DVBSRC_INTERLEAVING,
+  ARG_DVBSRC_OVERFLOW_COUNT
 };
 
 #define DEFAULT_ADAPTER 0
@@ -782,6 +783,20 @@ gst_dvbsrc_class_init (GstDvbSrcClass * klass)
           "The kernel buffer size used by the DVB api",
           0, G_MAXUINT, DEFAULT_DVB_BUFFER_SIZE, G_PARAM_READWRITE));
 
+  /**
+   * GstDvbSrc:overflow-count:
+   *
+   * The number of demux buffer overruns seen on the DVR device since the
+   * element started reading. A rising count means the reader thread is not
+   * keeping up and dvb-buffer-size should be increased.
+   *
+   * Since: 1.16
+   */
+  g_object_class_install_property (gobject_class, ARG_DVBSRC_OVERFLOW_COUNT,
+      g_param_spec_uint64 ("overflow-count", "overflow-count",
+          "The number of demux buffer overruns seen since starting to read",
+          0, G_MAXUINT64, 0, G_PARAM_READABLE));
+
   g_object_class_install_property (gobject_class, ARG_DVBSRC_DELSYS,
       g_param_spec_enum ("delsys", "delsys", "Delivery System",
           GST_TYPE_DVBSRC_DELSYS, DEFAULT_DELSYS, G_PARAM_READWRITE));
@@ -1046,6 +1061,7 @@ gst_dvbsrc_init (GstDvbSrc * object)
   object->pids[0] = 8192;
   object->pids[1] = G_MAXUINT16;
   object->dvb_buffer_size = DEFAULT_DVB_BUFFER_SIZE;
+  object->overflow_count = 0;
 
   adapter = g_getenv ("GST_DVB_ADAPTER");
   if (adapter)
@@ -1446,6 +1462,9 @@ gst_dvbsrc_get_property (GObject * _object, guint prop_id,
     case ARG_DVBSRC_DVB_BUFFER_SIZE:
       g_value_set_uint (value, object->dvb_buffer_size);
       break;
+    case ARG_DVBSRC_OVERFLOW_COUNT:
+      g_value_set_uint64 (value, object->overflow_count);
+      break;
     case ARG_DVBSRC_DELSYS:
       g_value_set_enum (value, object->delsys);
       break;
@@ -1804,6 +1823,8 @@ gst_dvbsrc_open_dvr (GstDvbSrc * object)
   }
   g_free (dvr_dev);
 
+  object->overflow_count = 0;
+
   GST_INFO_OBJECT (object, "Setting DVB kernel buffer size to %d",
       object->dvb_buffer_size);
   LOOP_WHILE_EINTR (err, ioctl (object->fd_dvr, DMX_SET_BUFFER_SIZE,
@@ -1891,13 +1912,29 @@ gst_dvbsrc_read_device (GstDvbSrc * object, int size, GstBuffer ** buffer)
       int nread = read (object->fd_dvr, map.data + count, size - count);
 
       if (G_UNLIKELY (nread < 0)) {
-        GST_WARNING_OBJECT
-            (object,
-            "Unable to read from device: /dev/dvb/adapter%d/dvr%d (%d)",
-            object->adapter_number, object->frontend_number, errno);
-        gst_element_post_message (GST_ELEMENT_CAST (object),
-            gst_message_new_element (GST_OBJECT (object),
-                gst_structure_new_empty ("dvb-read-failure")));
+        if (errno == EOVERFLOW) {
+          /* The demux ring buffer overran because we did not drain it fast
+           * enough; the read error is one-shot and reading resumes with the
+           * next call, so account for it and carry on */
+          object->overflow_count++;
+          GST_WARNING_OBJECT (object,
+              "Buffer overrun on device: /dev/dvb/adapter%d/dvr%d "
+              "(%" G_GUINT64_FORMAT " total), consider raising "
+              "dvb-buffer-size", object->adapter_number,
+              object->frontend_number, object->overflow_count);
+          gst_element_post_message (GST_ELEMENT_CAST (object),
+              gst_message_new_element (GST_OBJECT (object),
+                  gst_structure_new ("dvb-overflow", "overflow-count",
+                      G_TYPE_UINT64, object->overflow_count, NULL)));
+        } else {
+          GST_WARNING_OBJECT
+              (object,
+              "Unable to read from device: /dev/dvb/adapter%d/dvr%d (%d)",
+              object->adapter_number, object->frontend_number, errno);
+          gst_element_post_message (GST_ELEMENT_CAST (object),
+              gst_message_new_element (GST_OBJECT (object),
+                  gst_structure_new_empty ("dvb-read-failure")));
+        }
       } else
         count = count + nread;
     }
@@ -2381,6 +2418,19 @@ gst_dvbsrc_tune_fe (GstDvbSrc * object)
 
   /* signal locking loop */
   do {
+    struct pollfd pfd = { object->fd_frontend, POLLPRI, 0 };
+    struct dvb_frontend_event event;
+
+    /* Wait for a frontend event instead of busy-looping on
+     * FE_READ_STATUS; drivers flag status changes with POLLPRI. The
+     * short timeout keeps the tuning_timeout bookkeeping below ticking
+     * with drivers that do not emit events */
+    LOOP_WHILE_EINTR (err, poll (&pfd, 1, 100));
+    if (err > 0 && (pfd.revents & POLLPRI)) {
+      /* drain the event queue so the next poll blocks again */
+      LOOP_WHILE_EINTR (err, ioctl (object->fd_frontend, FE_GET_EVENT,
+              &event));
+    }
 
     if (!gst_dvbsrc_output_frontend_stats (object, &status))
       goto fail_with_signal;
@@ -103,6 +103,7 @@ struct _GstDvbSrc
   gboolean need_unlock;
 
   guint dvb_buffer_size;
+  guint64 overflow_count;
 
   unsigned int isdbt_layer_enabled;
   int isdbt_partial_reception;
@@ -252,6 +252,24 @@ gst_fbdevsink_setcaps (GstBaseSink * bsink, GstCaps * vscapslist)
   if (fbdevsink->lines > fbdevsink->varinfo.yres)
     fbdevsink->lines = fbdevsink->varinfo.yres;
 
+  /* draw into an off-screen page and flip it in with display panning
+   * when the device has the virtual resolution for it, so the visible
+   * page never shows a half-drawn frame */
+  fbdevsink->pages = 1;
+  fbdevsink->cur_page = 0;
+  if (fbdevsink->varinfo.yres_virtual >= 2 * fbdevsink->varinfo.yres) {
+    struct fb_var_screeninfo varinfo = fbdevsink->varinfo;
+
+    varinfo.xoffset = 0;
+    varinfo.yoffset = 0;
+    if (ioctl (fbdevsink->fd, FBIOPAN_DISPLAY, &varinfo) == 0) {
+      fbdevsink->pages = 2;
+      fbdevsink->cur_page = 1;
+    } else {
+      GST_DEBUG_OBJECT (fbdevsink, "display panning not supported");
+    }
+  }
+
   return TRUE;
 }
 
@@ -262,6 +280,7 @@ gst_fbdevsink_show_frame (GstVideoSink * videosink, GstBuffer * buf)
 
   GstFBDEVSink *fbdevsink;
   GstMapInfo map;
+  unsigned char *page;
   int i;
 
   fbdevsink = GST_FBDEVSINK (videosink);
@@ -272,16 +291,40 @@ gst_fbdevsink_show_frame (GstVideoSink * videosink, GstBuffer * buf)
   if (!gst_buffer_map (buf, &map, GST_MAP_READ))
     return GST_FLOW_ERROR;
 
-  for (i = 0; i < fbdevsink->lines; i++) {
-    memcpy (fbdevsink->framebuffer
-        + (i + fbdevsink->cy) * fbdevsink->fixinfo.line_length
-        + fbdevsink->cx * fbdevsink->bytespp,
-        map.data + i * fbdevsink->width * fbdevsink->bytespp,
-        fbdevsink->linelen);
+  page = fbdevsink->framebuffer + fbdevsink->cur_page
+      * fbdevsink->varinfo.yres * fbdevsink->fixinfo.line_length;
+
+  if (fbdevsink->cx == 0 &&
+      fbdevsink->width * fbdevsink->bytespp == fbdevsink->fixinfo.line_length) {
+    /* video lines match the framebuffer pitch: one contiguous copy */
+    memcpy (page + fbdevsink->cy * fbdevsink->fixinfo.line_length,
+        map.data, fbdevsink->lines * fbdevsink->fixinfo.line_length);
+  } else {
+    for (i = 0; i < fbdevsink->lines; i++) {
+      memcpy (page
+          + (i + fbdevsink->cy) * fbdevsink->fixinfo.line_length
+          + fbdevsink->cx * fbdevsink->bytespp,
+          map.data + i * fbdevsink->width * fbdevsink->bytespp,
+          fbdevsink->linelen);
+    }
   }
 
   gst_buffer_unmap (buf, &map);
 
+  if (fbdevsink->pages > 1) {
+    struct fb_var_screeninfo varinfo = fbdevsink->varinfo;
+
+    varinfo.xoffset = 0;
+    varinfo.yoffset = fbdevsink->cur_page * varinfo.yres;
+    if (ioctl (fbdevsink->fd, FBIOPAN_DISPLAY, &varinfo) < 0) {
+      GST_WARNING_OBJECT (fbdevsink, "display panning failed, disabling");
+      fbdevsink->pages = 1;
+      fbdevsink->cur_page = 0;
+    } else {
+      fbdevsink->cur_page = !fbdevsink->cur_page;
+    }
+  }
+
   return GST_FLOW_OK;
 }
 
@@ -58,6 +58,10 @@ struct _GstFBDEVSink {
   int width, height;
   int cx, cy, linelen, lines, bytespp;
 
+  /* display panning based double buffering; pages == 1 means drawing
+   * straight into the visible page as before */
+  int pages, cur_page;
+
   int fps_n, fps_d;
 };
 
@@ -27,6 +27,11 @@
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
 #include <gst/base/gstbytewriter.h>
 #include <gst/gstprotection.h>
 #include "gstipcpipelinecomm.h"
@@ -186,6 +191,12 @@ gst_ipc_pipeline_comm_data_type_get_name (GstIpcPipelineCommDataType type)
       return "MESSAGE";
     case GST_IPC_PIPELINE_COMM_DATA_TYPE_GERROR_MESSAGE:
       return "GERROR_MESSAGE";
+    case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_AREA:
+      return "SHM_AREA";
+    case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_BUFFER:
+      return "SHM_BUFFER";
+    case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_RELEASE:
+      return "SHM_RELEASE";
     default:
       return "UNKNOWN";
   }
@@ -239,6 +250,41 @@ done:
   return ret;
 }
 
+static gboolean
+write_vectors_to_fd (GstIpcPipelineComm * comm, struct iovec *iov, int n_iov)
+{
+  gsize total = 0;
+  int i;
+
+  for (i = 0; i < n_iov; ++i)
+    total += iov[i].iov_len;
+  GST_TRACE_OBJECT (comm->element,
+      "Writing %" G_GSIZE_FORMAT " bytes to fdout in %d vectors", total,
+      n_iov);
+
+  i = 0;
+  while (i < n_iov) {
+    ssize_t written = writev (comm->fdout, iov + i, n_iov - i);
+
+    if (written < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      GST_ERROR_OBJECT (comm->element, "Failed to write to fd: %s",
+          strerror (errno));
+      return FALSE;
+    }
+    while (i < n_iov && written >= (ssize_t) iov[i].iov_len) {
+      written -= iov[i].iov_len;
+      i++;
+    }
+    if (i < n_iov && written > 0) {
+      iov[i].iov_base = (guint8 *) iov[i].iov_base + written;
+      iov[i].iov_len -= written;
+    }
+  }
+  return TRUE;
+}
+
 static gboolean
 write_byte_writer_to_fd (GstIpcPipelineComm * comm, GstByteWriter * bw)
 {
@@ -496,18 +542,300 @@ typedef struct
   guint64 flags;
 } CommBufferMetadata;
 
+/* A free range in the shm area. The list is sorted by offset so adjacent
+   ranges can be merged back together when buffers are released. */
+typedef struct
+{
+  guint32 offset;
+  guint32 size;
+} ShmRegion;
+
+/* called with comm->mutex held */
+static gboolean
+gst_ipc_pipeline_comm_shm_alloc (GstIpcPipelineComm * comm, guint32 size,
+    guint32 * offset)
+{
+  GList *l;
+
+  if (size == 0)
+    return FALSE;
+
+  for (l = comm->shm_free_regions; l; l = l->next) {
+    ShmRegion *region = l->data;
+
+    if (region->size < size)
+      continue;
+    *offset = region->offset;
+    if (region->size == size) {
+      comm->shm_free_regions = g_list_delete_link (comm->shm_free_regions, l);
+      g_free (region);
+    } else {
+      region->offset += size;
+      region->size -= size;
+    }
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/* called with comm->mutex held */
+static void
+gst_ipc_pipeline_comm_shm_free (GstIpcPipelineComm * comm, guint32 offset,
+    guint32 size)
+{
+  GList *l, *prev = NULL;
+  ShmRegion *region;
+
+  for (l = comm->shm_free_regions; l; prev = l, l = l->next) {
+    region = l->data;
+    if (region->offset > offset)
+      break;
+  }
+
+  /* merge with the previous and/or next free region when adjacent */
+  if (prev) {
+    region = prev->data;
+    if (region->offset + region->size == offset) {
+      region->size += size;
+      if (l) {
+        ShmRegion *next = l->data;
+
+        if (region->offset + region->size == next->offset) {
+          region->size += next->size;
+          g_free (next);
+          comm->shm_free_regions =
+              g_list_delete_link (comm->shm_free_regions, l);
+        }
+      }
+      return;
+    }
+  }
+  if (l) {
+    region = l->data;
+    if (offset + size == region->offset) {
+      region->offset = offset;
+      region->size += size;
+      return;
+    }
+  }
+
+  region = g_new (ShmRegion, 1);
+  region->offset = offset;
+  region->size = size;
+  comm->shm_free_regions =
+      g_list_insert_before (comm->shm_free_regions, l, region);
+}
+
+/* Lazily create the shm area on the writer side and announce it to the
+   peer. Called with comm->mutex held. On failure the shm path is disabled
+   for good and we keep sending buffer data inline. */
+static gboolean
+gst_ipc_pipeline_comm_shm_ensure_area (GstIpcPipelineComm * comm)
+{
+  static volatile gint area_seq = 0;
+  GstByteWriter bw;
+  ShmRegion *region;
+  gchar *name = NULL;
+  guint8 *data = NULL;
+  guint32 payload_size;
+  int fd = -1;
+
+  if (comm->shm_data)
+    return TRUE;
+
+  do {
+    g_free (name);
+    name = g_strdup_printf ("/gstipcpipeline.%d.%u", getpid (),
+        (guint) g_atomic_int_add (&area_seq, 1));
+    fd = shm_open (name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  } while (fd < 0 && errno == EEXIST);
+  if (fd < 0)
+    goto open_failed;
+  if (ftruncate (fd, comm->shm_size) < 0)
+    goto resize_failed;
+  data = mmap (NULL, comm->shm_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+  if (data == MAP_FAILED)
+    goto map_failed;
+
+  ++comm->send_id;
+  gst_byte_writer_init (&bw);
+  payload_size = sizeof (guint32) + strlen (name) + 1;
+  if (!gst_byte_writer_put_uint8 (&bw,
+          GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_AREA))
+    goto announce_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, comm->send_id))
+    goto announce_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, payload_size))
+    goto announce_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, comm->shm_size))
+    goto announce_failed;
+  if (!gst_byte_writer_put_data (&bw, (const guint8 *) name,
+          strlen (name) + 1))
+    goto announce_failed;
+  if (!write_byte_writer_to_fd (comm, &bw))
+    goto announce_failed;
+
+  GST_DEBUG_OBJECT (comm->element, "Created shm area %s of %u bytes", name,
+      comm->shm_size);
+
+  comm->shm_fd = fd;
+  comm->shm_name = name;
+  comm->shm_data = data;
+  comm->shm_is_writer = TRUE;
+  region = g_new (ShmRegion, 1);
+  region->offset = 0;
+  region->size = comm->shm_size;
+  comm->shm_free_regions = g_list_append (NULL, region);
+  return TRUE;
+
+announce_failed:
+  gst_byte_writer_reset (&bw);
+  munmap (data, comm->shm_size);
+map_failed:
+resize_failed:
+  close (fd);
+  shm_unlink (name);
+open_failed:
+  GST_WARNING_OBJECT (comm->element,
+      "Failed to set up shm area (%s), keeping buffer data on the fd",
+      strerror (errno));
+  g_free (name);
+  comm->shm_threshold = 0;
+  return FALSE;
+}
+
+/* Reader side handling of the writer's area announcement */
+static gboolean
+gst_ipc_pipeline_comm_read_shm_area (GstIpcPipelineComm * comm, guint32 size)
+{
+  const guint8 *payload;
+  guint32 area_size;
+  gchar *name;
+  guint8 *data;
+  int fd;
+
+  /* this should not be called if we don't have enough yet */
+  g_return_val_if_fail (gst_adapter_available (comm->adapter) >= size, FALSE);
+  if (size <= sizeof (guint32))
+    return FALSE;
+
+  payload = gst_adapter_map (comm->adapter, size);
+  if (!payload)
+    return FALSE;
+  memcpy (&area_size, payload, sizeof (area_size));
+  if (payload[size - 1]) {
+    gst_adapter_unmap (comm->adapter);
+    return FALSE;
+  }
+  name = g_strdup ((const char *) payload + sizeof (guint32));
+  gst_adapter_unmap (comm->adapter);
+  gst_adapter_flush (comm->adapter, size);
+
+  if (comm->shm_data) {
+    GST_ERROR_OBJECT (comm->element, "Got a second shm area announcement");
+    g_free (name);
+    return FALSE;
+  }
+
+  fd = shm_open (name, O_RDONLY, 0);
+  if (fd < 0) {
+    GST_ERROR_OBJECT (comm->element, "Failed to open shm area %s: %s", name,
+        strerror (errno));
+    g_free (name);
+    return FALSE;
+  }
+  data = mmap (NULL, area_size, PROT_READ, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    GST_ERROR_OBJECT (comm->element, "Failed to map shm area %s: %s", name,
+        strerror (errno));
+    close (fd);
+    g_free (name);
+    return FALSE;
+  }
+
+  GST_DEBUG_OBJECT (comm->element, "Mapped shm area %s of %u bytes", name,
+      area_size);
+
+  comm->shm_fd = fd;
+  comm->shm_name = name;
+  comm->shm_data = data;
+  comm->shm_size = area_size;
+  comm->shm_is_writer = FALSE;
+  return TRUE;
+}
+
+/* Keeps the wrapping element (and thus the mapped area) alive for as long
+   as a buffer points into the shm area */
+typedef struct
+{
+  GstElement *element;
+  GstIpcPipelineComm *comm;
+  guint32 offset;
+  guint32 size;
+} ShmBufferRef;
+
+static void
+gst_ipc_pipeline_comm_shm_buffer_freed (gpointer data)
+{
+  ShmBufferRef *ref = data;
+  GstIpcPipelineComm *comm = ref->comm;
+  GstByteWriter bw;
+
+  g_mutex_lock (&comm->mutex);
+  ++comm->send_id;
+
+  GST_TRACE_OBJECT (comm->element, "Releasing shm region at %u, %u bytes",
+      ref->offset, ref->size);
+  gst_byte_writer_init (&bw);
+  if (!gst_byte_writer_put_uint8 (&bw,
+          GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_RELEASE))
+    goto write_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, comm->send_id))
+    goto write_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, 2 * sizeof (guint32)))
+    goto write_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, ref->offset))
+    goto write_failed;
+  if (!gst_byte_writer_put_uint32_le (&bw, ref->size))
+    goto write_failed;
+  if (!write_byte_writer_to_fd (comm, &bw))
+    goto write_failed;
+
+done:
+  g_mutex_unlock (&comm->mutex);
+  gst_byte_writer_reset (&bw);
+  gst_object_unref (ref->element);
+  g_free (ref);
+  return;
+
+write_failed:
+  /* the writer leaks the region, but if the socket is gone it is about to
+     tear down the whole area anyway */
+  GST_WARNING_OBJECT (comm->element, "Failed to write shm release to socket");
+  goto done;
+}
+
 GstFlowReturn
 gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
     GstBuffer * buffer)
 {
-  const unsigned char payload_type = GST_IPC_PIPELINE_COMM_DATA_TYPE_BUFFER;
+  unsigned char payload_type = GST_IPC_PIPELINE_COMM_DATA_TYPE_BUFFER;
   GstMapInfo map;
   guint32 ret32 = GST_FLOW_OK;
   guint32 size, n;
+  guint32 shm_offset = 0;
+  gboolean use_shm = FALSE;
+  gboolean mapped = FALSE;
+  gboolean res;
   CommBufferMetadata meta;
   GstFlowReturn ret;
   MetaListRepresentation repr = { comm, 0, 4, NULL };   /* starts a 4 for n_meta */
-  GstByteWriter bw;
+  GstByteWriter bw, mw;
+  guint8 *header = NULL, *trailer = NULL;
+  guint header_size, trailer_size;
+  struct iovec iov[3];
+  int n_iov;
 
   g_mutex_lock (&comm->mutex);
   ++comm->send_id;
@@ -516,6 +844,7 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
       comm->send_id, buffer);
 
   gst_byte_writer_init (&bw);
+  gst_byte_writer_init (&mw);
 
   meta.pts = GST_BUFFER_PTS (buffer);
   meta.dts = GST_BUFFER_DTS (buffer);
@@ -527,65 +856,108 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   /* work out meta size */
   gst_buffer_foreach_meta (buffer, build_meta, &repr);
 
+  /* large payloads go through the shm area when enabled; if the area is
+     full we fall back to sending the data inline */
+  if (comm->shm_threshold
+      && gst_buffer_get_size (buffer) >= comm->shm_threshold
+      && gst_ipc_pipeline_comm_shm_ensure_area (comm)
+      && gst_ipc_pipeline_comm_shm_alloc (comm, gst_buffer_get_size (buffer),
+          &shm_offset)) {
+    use_shm = TRUE;
+    payload_type = GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_BUFFER;
+  }
+
   if (!gst_byte_writer_put_uint8 (&bw, payload_type))
     goto write_failed;
   if (!gst_byte_writer_put_uint32_le (&bw, comm->send_id))
     goto write_failed;
-  size =
-      gst_buffer_get_size (buffer) + sizeof (guint32) +
-      sizeof (CommBufferMetadata) + repr.total_bytes;
+  if (use_shm)
+    size = 2 * sizeof (guint32) + sizeof (CommBufferMetadata) +
+        repr.total_bytes;
+  else
+    size = gst_buffer_get_size (buffer) + sizeof (guint32) +
+        sizeof (CommBufferMetadata) + repr.total_bytes;
   if (!gst_byte_writer_put_uint32_le (&bw, size))
     goto write_failed;
   if (!gst_byte_writer_put_data (&bw, (const guint8 *) &meta, sizeof (meta)))
     goto write_failed;
   size = gst_buffer_get_size (buffer);
-  if (!gst_byte_writer_put_uint32_le (&bw, size))
-    goto write_failed;
-  if (!write_byte_writer_to_fd (comm, &bw))
-    goto write_failed;
-
-  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
-    goto map_failed;
-  ret = write_to_fd_raw (comm, map.data, map.size);
-  gst_buffer_unmap (buffer, &map);
-  if (!ret)
-    goto write_failed;
+  if (use_shm) {
+    if (!gst_byte_writer_put_uint32_le (&bw, shm_offset))
+      goto write_failed;
+    if (!gst_byte_writer_put_uint32_le (&bw, size))
+      goto write_failed;
+    gst_buffer_extract (buffer, 0, comm->shm_data + shm_offset, size);
+    GST_TRACE_OBJECT (comm->element,
+        "Placed %u bytes in shm region at %u", size, shm_offset);
+  } else {
+    if (!gst_byte_writer_put_uint32_le (&bw, size))
+      goto write_failed;
+  }
 
   /* meta */
-  gst_byte_writer_init (&bw);
-  if (!gst_byte_writer_put_uint32_le (&bw, repr.n_meta))
+  if (!gst_byte_writer_put_uint32_le (&mw, repr.n_meta))
     goto write_failed;
   for (n = 0; n < repr.n_meta; ++n) {
     const MetaBuildInfo *info = repr.info + n;
     guint32 len;
     const char *s;
 
-    if (!gst_byte_writer_put_uint32_le (&bw, info->bytes))
+    if (!gst_byte_writer_put_uint32_le (&mw, info->bytes))
       goto write_failed;
 
-    if (!gst_byte_writer_put_uint32_le (&bw, info->flags))
+    if (!gst_byte_writer_put_uint32_le (&mw, info->flags))
       goto write_failed;
 
     s = g_type_name (info->api);
     len = strlen (s) + 1;
-    if (!gst_byte_writer_put_uint32_le (&bw, len))
+    if (!gst_byte_writer_put_uint32_le (&mw, len))
       goto write_failed;
-    if (!gst_byte_writer_put_data (&bw, (const guint8 *) s, len))
+    if (!gst_byte_writer_put_data (&mw, (const guint8 *) s, len))
       goto write_failed;
 
-    if (!gst_byte_writer_put_uint64_le (&bw, info->size))
+    if (!gst_byte_writer_put_uint64_le (&mw, info->size))
       goto write_failed;
 
     s = info->str;
     len = s ? (strlen (s) + 1) : 0;
-    if (!gst_byte_writer_put_uint32_le (&bw, len))
+    if (!gst_byte_writer_put_uint32_le (&mw, len))
       goto write_failed;
     if (len)
-      if (!gst_byte_writer_put_data (&bw, (const guint8 *) s, len))
+      if (!gst_byte_writer_put_data (&mw, (const guint8 *) s, len))
         goto write_failed;
   }
 
-  if (!write_byte_writer_to_fd (comm, &bw))
+  /* gather the header, buffer data and meta trailer into a single
+     writev() so the peer wakes up once per buffer */
+  header_size = gst_byte_writer_get_size (&bw);
+  header = gst_byte_writer_reset_and_get_data (&bw);
+  if (!header)
+    goto write_failed;
+  trailer_size = gst_byte_writer_get_size (&mw);
+  trailer = gst_byte_writer_reset_and_get_data (&mw);
+  if (!trailer)
+    goto write_failed;
+
+  iov[0].iov_base = header;
+  iov[0].iov_len = header_size;
+  n_iov = 1;
+  if (!use_shm) {
+    if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
+      goto map_failed;
+    mapped = TRUE;
+    iov[n_iov].iov_base = map.data;
+    iov[n_iov].iov_len = map.size;
+    n_iov++;
+  }
+  iov[n_iov].iov_base = trailer;
+  iov[n_iov].iov_len = trailer_size;
+  n_iov++;
+
+  res = write_vectors_to_fd (comm, iov, n_iov);
+  if (mapped)
+    gst_buffer_unmap (buffer, &map);
+  if (!res)
     goto write_failed;
 
   if (!gst_ipc_pipeline_comm_sync_fd (comm, comm->send_id, NULL, &ret32,
@@ -596,12 +968,18 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
 done:
   g_mutex_unlock (&comm->mutex);
   gst_byte_writer_reset (&bw);
+  gst_byte_writer_reset (&mw);
+  g_free (header);
+  g_free (trailer);
   for (n = 0; n < repr.n_meta; ++n)
     g_free (repr.info[n].str);
   g_free (repr.info);
   return ret;
 
 write_failed:
+  if (use_shm)
+    gst_ipc_pipeline_comm_shm_free (comm, shm_offset,
+        gst_buffer_get_size (buffer));
   GST_ELEMENT_ERROR (comm->element, RESOURCE, WRITE, (NULL),
       ("Failed to write to socket"));
   ret = GST_FLOW_COMM_ERROR;
@@ -620,44 +998,13 @@ map_failed:
   goto done;
 }
 
-static GstBuffer *
-gst_ipc_pipeline_comm_read_buffer (GstIpcPipelineComm * comm, guint32 size)
+static gboolean
+gst_ipc_pipeline_comm_read_buffer_metas (GstIpcPipelineComm * comm,
+    GstBuffer * buffer, guint32 size)
 {
-  GstBuffer *buffer;
-  CommBufferMetadata meta;
   guint32 n_meta, n;
   const guint8 *payload = NULL;
-  guint32 mapped_size, buffer_data_size;
-
-  /* this should not be called if we don't have enough yet */
-  g_return_val_if_fail (gst_adapter_available (comm->adapter) >= size, NULL);
-  g_return_val_if_fail (size >= sizeof (CommBufferMetadata), NULL);
-
-  mapped_size = sizeof (CommBufferMetadata) + sizeof (buffer_data_size);
-  payload = gst_adapter_map (comm->adapter, mapped_size);
-  if (!payload)
-    return NULL;
-  memcpy (&meta, payload, sizeof (CommBufferMetadata));
-  payload += sizeof (CommBufferMetadata);
-  memcpy (&buffer_data_size, payload, sizeof (buffer_data_size));
-  size -= mapped_size;
-  gst_adapter_unmap (comm->adapter);
-  gst_adapter_flush (comm->adapter, mapped_size);
-
-  if (buffer_data_size == 0) {
-    buffer = gst_buffer_new ();
-  } else {
-    buffer = gst_adapter_get_buffer (comm->adapter, buffer_data_size);
-    gst_adapter_flush (comm->adapter, buffer_data_size);
-  }
-  size -= buffer_data_size;
-
-  GST_BUFFER_PTS (buffer) = meta.pts;
-  GST_BUFFER_DTS (buffer) = meta.dts;
-  GST_BUFFER_DURATION (buffer) = meta.duration;
-  GST_BUFFER_OFFSET (buffer) = meta.offset;
-  GST_BUFFER_OFFSET_END (buffer) = meta.offset_end;
-  GST_BUFFER_FLAGS (buffer) = meta.flags;
+  guint32 mapped_size;
 
   /* If you don't call that, the GType isn't yet known at the
      g_type_from_name below */
@@ -665,10 +1012,8 @@ gst_ipc_pipeline_comm_read_buffer (GstIpcPipelineComm * comm, guint32 size)
 
   mapped_size = size;
   payload = gst_adapter_map (comm->adapter, mapped_size);
-  if (!payload) {
-    gst_buffer_unref (buffer);
-    return NULL;
-  }
+  if (!payload)
+    return FALSE;
   memcpy (&n_meta, payload, sizeof (n_meta));
   payload += sizeof (n_meta);
 
@@ -717,6 +1062,113 @@ gst_ipc_pipeline_comm_read_buffer (GstIpcPipelineComm * comm, guint32 size)
   gst_adapter_unmap (comm->adapter);
   gst_adapter_flush (comm->adapter, mapped_size);
 
+  return TRUE;
+}
+
+static GstBuffer *
+gst_ipc_pipeline_comm_read_buffer (GstIpcPipelineComm * comm, guint32 size)
+{
+  GstBuffer *buffer;
+  CommBufferMetadata meta;
+  const guint8 *payload = NULL;
+  guint32 mapped_size, buffer_data_size;
+
+  /* this should not be called if we don't have enough yet */
+  g_return_val_if_fail (gst_adapter_available (comm->adapter) >= size, NULL);
+  g_return_val_if_fail (size >= sizeof (CommBufferMetadata), NULL);
+
+  mapped_size = sizeof (CommBufferMetadata) + sizeof (buffer_data_size);
+  payload = gst_adapter_map (comm->adapter, mapped_size);
+  if (!payload)
+    return NULL;
+  memcpy (&meta, payload, sizeof (CommBufferMetadata));
+  payload += sizeof (CommBufferMetadata);
+  memcpy (&buffer_data_size, payload, sizeof (buffer_data_size));
+  size -= mapped_size;
+  gst_adapter_unmap (comm->adapter);
+  gst_adapter_flush (comm->adapter, mapped_size);
+
+  if (buffer_data_size == 0) {
+    buffer = gst_buffer_new ();
+  } else {
+    buffer = gst_adapter_get_buffer (comm->adapter, buffer_data_size);
+    gst_adapter_flush (comm->adapter, buffer_data_size);
+  }
+  size -= buffer_data_size;
+
+  GST_BUFFER_PTS (buffer) = meta.pts;
+  GST_BUFFER_DTS (buffer) = meta.dts;
+  GST_BUFFER_DURATION (buffer) = meta.duration;
+  GST_BUFFER_OFFSET (buffer) = meta.offset;
+  GST_BUFFER_OFFSET_END (buffer) = meta.offset_end;
+  GST_BUFFER_FLAGS (buffer) = meta.flags;
+
+  if (!gst_ipc_pipeline_comm_read_buffer_metas (comm, buffer, size)) {
+    gst_buffer_unref (buffer);
+    return NULL;
+  }
+
+  return buffer;
+}
+
+static GstBuffer *
+gst_ipc_pipeline_comm_read_shm_buffer (GstIpcPipelineComm * comm, guint32 size)
+{
+  GstBuffer *buffer;
+  CommBufferMetadata meta;
+  ShmBufferRef *ref;
+  const guint8 *payload = NULL;
+  guint32 mapped_size, shm_offset, buffer_data_size;
+
+  /* this should not be called if we don't have enough yet */
+  g_return_val_if_fail (gst_adapter_available (comm->adapter) >= size, NULL);
+  g_return_val_if_fail (size >=
+      sizeof (CommBufferMetadata) + 2 * sizeof (guint32), NULL);
+
+  mapped_size = sizeof (CommBufferMetadata) + 2 * sizeof (guint32);
+  payload = gst_adapter_map (comm->adapter, mapped_size);
+  if (!payload)
+    return NULL;
+  memcpy (&meta, payload, sizeof (CommBufferMetadata));
+  payload += sizeof (CommBufferMetadata);
+  memcpy (&shm_offset, payload, sizeof (shm_offset));
+  payload += sizeof (shm_offset);
+  memcpy (&buffer_data_size, payload, sizeof (buffer_data_size));
+  size -= mapped_size;
+  gst_adapter_unmap (comm->adapter);
+  gst_adapter_flush (comm->adapter, mapped_size);
+
+  if (!comm->shm_data || shm_offset > comm->shm_size
+      || buffer_data_size > comm->shm_size - shm_offset) {
+    GST_ERROR_OBJECT (comm->element,
+        "Invalid shm region reference: %u bytes at %u", buffer_data_size,
+        shm_offset);
+    return NULL;
+  }
+
+  /* wrap the shm region without copying; the writer keeps the region
+     allocated until it sees our SHM_RELEASE for it */
+  ref = g_new (ShmBufferRef, 1);
+  ref->element = gst_object_ref (comm->element);
+  ref->comm = comm;
+  ref->offset = shm_offset;
+  ref->size = buffer_data_size;
+  buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+      comm->shm_data + shm_offset, buffer_data_size, 0, buffer_data_size,
+      ref, gst_ipc_pipeline_comm_shm_buffer_freed);
+
+  GST_BUFFER_PTS (buffer) = meta.pts;
+  GST_BUFFER_DTS (buffer) = meta.dts;
+  GST_BUFFER_DURATION (buffer) = meta.duration;
+  GST_BUFFER_OFFSET (buffer) = meta.offset;
+  GST_BUFFER_OFFSET_END (buffer) = meta.offset_end;
+  GST_BUFFER_FLAGS (buffer) = meta.flags;
+
+  if (!gst_ipc_pipeline_comm_read_buffer_metas (comm, buffer, size)) {
+    gst_buffer_unref (buffer);
+    return NULL;
+  }
+
   return buffer;
 }
 
@@ -1601,6 +2053,9 @@ gst_ipc_pipeline_comm_init (GstIpcPipelineComm * comm, GstElement * element)
   comm->element = element;
   comm->fdin = comm->fdout = -1;
   comm->ack_time = DEFAULT_ACK_TIME;
+  comm->shm_threshold = 0;
+  comm->shm_size = GST_IPC_PIPELINE_COMM_DEFAULT_SHM_SIZE;
+  comm->shm_fd = -1;
   comm->waiting_ids =
       g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
       (GDestroyNotify) comm_request_free);
@@ -1612,6 +2067,16 @@ gst_ipc_pipeline_comm_init (GstIpcPipelineComm * comm, GstElement * element)
 void
 gst_ipc_pipeline_comm_clear (GstIpcPipelineComm * comm)
 {
+  if (comm->shm_data)
+    munmap (comm->shm_data, comm->shm_size);
+  if (comm->shm_fd >= 0)
+    close (comm->shm_fd);
+  if (comm->shm_name) {
+    if (comm->shm_is_writer)
+      shm_unlink (comm->shm_name);
+    g_free (comm->shm_name);
+  }
+  g_list_free_full (comm->shm_free_regions, g_free);
   g_hash_table_destroy (comm->waiting_ids);
   gst_object_unref (comm->adapter);
   gst_poll_free (comm->poll);
@@ -1810,6 +2275,9 @@ read_many (GstIpcPipelineComm * comm)
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_STATE_LOST:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_MESSAGE:
           case GST_IPC_PIPELINE_COMM_DATA_TYPE_GERROR_MESSAGE:
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_AREA:
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_BUFFER:
+          case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_RELEASE:
             GST_TRACE_OBJECT (comm->element, "switching to state %s",
                 gst_ipc_pipeline_comm_data_type_get_name (type));
             comm->state = type;
@@ -2071,6 +2539,81 @@ read_many (GstIpcPipelineComm * comm)
         if (comm->on_message)
           (*comm->on_message) (comm->id, message, comm->user_data);
 
+        GST_TRACE_OBJECT (comm->element, "switching to state TYPE");
+        comm->state = GST_IPC_PIPELINE_COMM_STATE_TYPE;
+        break;
+      }
+      case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_AREA:
+      {
+        available = gst_adapter_available (comm->adapter);
+        if (available < comm->payload_length)
+          goto done;
+
+        if (!gst_ipc_pipeline_comm_read_shm_area (comm, comm->payload_length))
+          goto shm_failed;
+
+        GST_TRACE_OBJECT (comm->element, "switching to state TYPE");
+        comm->state = GST_IPC_PIPELINE_COMM_STATE_TYPE;
+        break;
+      }
+      case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_BUFFER:
+      {
+        GstBuffer *buf;
+
+        available = gst_adapter_available (comm->adapter);
+        if (available < comm->payload_length)
+          goto done;
+
+        buf =
+            gst_ipc_pipeline_comm_read_shm_buffer (comm,
+            comm->payload_length);
+        if (!buf)
+          goto shm_failed;
+
+        GST_TRACE_OBJECT (comm->element,
+            "deserialized shm buffer %p, pushing, timestamp %" GST_TIME_FORMAT
+            ", duration %" GST_TIME_FORMAT ", offset %" G_GINT64_FORMAT
+            ", offset_end %" G_GINT64_FORMAT ", size %" G_GSIZE_FORMAT
+            ", flags 0x%x", buf, GST_TIME_ARGS (GST_BUFFER_TIMESTAMP (buf)),
+            GST_TIME_ARGS (GST_BUFFER_DURATION (buf)), GST_BUFFER_OFFSET (buf),
+            GST_BUFFER_OFFSET_END (buf), gst_buffer_get_size (buf),
+            GST_BUFFER_FLAGS (buf));
+
+        gst_mini_object_set_qdata (GST_MINI_OBJECT (buf), QUARK_ID,
+            GINT_TO_POINTER (comm->id), NULL);
+
+        if (comm->on_buffer)
+          (*comm->on_buffer) (comm->id, buf, comm->user_data);
+
+        GST_TRACE_OBJECT (comm->element, "switching to state TYPE");
+        comm->state = GST_IPC_PIPELINE_COMM_STATE_TYPE;
+        break;
+      }
+      case GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_RELEASE:
+      {
+        const guint8 *rel;
+        guint32 offset, size;
+
+        available = gst_adapter_available (comm->adapter);
+        if (available < comm->payload_length)
+          goto done;
+
+        if (comm->payload_length != 2 * sizeof (guint32))
+          goto shm_failed;
+
+        rel = gst_adapter_map (comm->adapter, comm->payload_length);
+        memcpy (&offset, rel, sizeof (offset));
+        memcpy (&size, rel + sizeof (offset), sizeof (size));
+        gst_adapter_unmap (comm->adapter);
+        gst_adapter_flush (comm->adapter, comm->payload_length);
+
+        GST_TRACE_OBJECT (comm->element,
+            "peer released shm region at %u, %u bytes", offset, size);
+
+        g_mutex_lock (&comm->mutex);
+        gst_ipc_pipeline_comm_shm_free (comm, offset, size);
+        g_mutex_unlock (&comm->mutex);
+
         GST_TRACE_OBJECT (comm->element, "switching to state TYPE");
         comm->state = GST_IPC_PIPELINE_COMM_STATE_TYPE;
         break;
@@ -2130,6 +2673,13 @@ query_failed:
     ret = FALSE;
     goto done;
   }
+shm_failed:
+  {
+    GST_ELEMENT_ERROR (comm->element, STREAM, DECODE, (NULL),
+        ("could not read shm data from fd"));
+    ret = FALSE;
+    goto done;
+  }
 }
 
 static gpointer
@@ -51,8 +51,14 @@ typedef enum {
   GST_IPC_PIPELINE_COMM_DATA_TYPE_STATE_LOST,
   GST_IPC_PIPELINE_COMM_DATA_TYPE_MESSAGE,
   GST_IPC_PIPELINE_COMM_DATA_TYPE_GERROR_MESSAGE,
+  /* shared memory data plane */
+  GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_AREA,
+  GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_BUFFER,
+  GST_IPC_PIPELINE_COMM_DATA_TYPE_SHM_RELEASE,
 } GstIpcPipelineCommDataType;
 
+#define GST_IPC_PIPELINE_COMM_DEFAULT_SHM_SIZE (16 * 1024 * 1024)
+
 typedef struct
 {
   GstElement *element;
@@ -76,6 +82,17 @@ typedef struct
   guint read_chunk_size;
   GstClockTime ack_time;
 
+  /* shared memory data plane: buffer payloads of at least shm_threshold
+   * bytes are copied into a shm area and referenced by offset on the fd,
+   * 0 disables this */
+  guint64 shm_threshold;
+  guint32 shm_size;
+  gchar *shm_name;
+  int shm_fd;
+  guint8 *shm_data;
+  gboolean shm_is_writer;
+  GList *shm_free_regions;
+
   void (*on_buffer) (guint32, GstBuffer *, gpointer);
   void (*on_event) (guint32, GstEvent *, gboolean, gpointer);
   void (*on_query) (guint32, GstQuery *, gboolean, gpointer);
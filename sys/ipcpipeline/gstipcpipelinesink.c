@@ -98,6 +98,8 @@ enum
   PROP_FDOUT,
   PROP_READ_CHUNK_SIZE,
   PROP_ACK_TIME,
+  PROP_SHM_THRESHOLD,
+  PROP_SHM_SIZE,
 };
 
 
@@ -174,6 +176,16 @@ gst_ipc_pipeline_sink_class_init (GstIpcPipelineSinkClass * klass)
           "Maximum time to wait for a response to a message",
           0, G_MAXUINT64, DEFAULT_ACK_TIME,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_SHM_THRESHOLD,
+      g_param_spec_uint64 ("shm-threshold", "Shm threshold",
+          "Pass buffer data of at least this size through a shared memory "
+          "area instead of the fd (0 = disabled)",
+          0, G_MAXUINT64, 0, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_SHM_SIZE,
+      g_param_spec_uint ("shm-size", "Shm size",
+          "Size of the shared memory area used for buffer data",
+          1, 1 << 30, GST_IPC_PIPELINE_COMM_DEFAULT_SHM_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_ipc_pipeline_sink_signals[SIGNAL_DISCONNECT] =
       g_signal_new ("disconnect",
@@ -271,6 +283,12 @@ gst_ipc_pipeline_sink_set_property (GObject * object, guint prop_id,
     case PROP_ACK_TIME:
       sink->comm.ack_time = g_value_get_uint64 (value);
       break;
+    case PROP_SHM_THRESHOLD:
+      sink->comm.shm_threshold = g_value_get_uint64 (value);
+      break;
+    case PROP_SHM_SIZE:
+      sink->comm.shm_size = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -296,6 +314,12 @@ gst_ipc_pipeline_sink_get_property (GObject * object, guint prop_id,
     case PROP_ACK_TIME:
       g_value_set_uint64 (value, sink->comm.ack_time);
       break;
+    case PROP_SHM_THRESHOLD:
+      g_value_set_uint64 (value, sink->comm.shm_threshold);
+      break;
+    case PROP_SHM_SIZE:
+      g_value_set_uint (value, sink->comm.shm_size);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1244,6 +1244,11 @@ gst_kms_sink_propose_allocation (GstBaseSink * bsink, GstQuery * query)
 
   gst_query_add_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
   gst_query_add_allocation_meta (query, GST_VIDEO_CROP_META_API_TYPE, NULL);
+  /* overlay elements (assrender, dvbsuboverlay, ...) then attach their
+   * composition instead of flattening it upstream; we blend it into our
+   * scanout buffer in get_input_buffer() */
+  gst_query_add_allocation_meta (query,
+      GST_VIDEO_OVERLAY_COMPOSITION_META_API_TYPE, NULL);
 
   return TRUE;
 
@@ -1502,29 +1507,65 @@ error_map_src_buffer:
   }
 }
 
+static gboolean
+gst_kms_sink_blend_composition (GstKMSSink * self, GstBuffer * buf,
+    GstVideoOverlayComposition * composition)
+{
+  GstVideoFrame frame;
+  gboolean ret;
+
+  if (!gst_video_frame_map (&frame, &self->vinfo, buf, GST_MAP_READWRITE))
+    return FALSE;
+
+  ret = gst_video_overlay_composition_blend (composition, &frame);
+  gst_video_frame_unmap (&frame);
+
+  return ret;
+}
+
 static GstBuffer *
 gst_kms_sink_get_input_buffer (GstKMSSink * self, GstBuffer * inbuf)
 {
   GstMemory *mem;
+  GstVideoOverlayCompositionMeta *compo_meta;
+  gboolean need_blend;
   GstBuffer *buf = NULL;
 
   mem = gst_buffer_peek_memory (inbuf, 0);
   if (!mem)
     return NULL;
 
-  if (gst_is_kms_memory (mem))
-    return gst_buffer_ref (inbuf);
+  compo_meta = gst_buffer_get_video_overlay_composition_meta (inbuf);
+  need_blend = compo_meta && compo_meta->overlay &&
+      gst_video_overlay_composition_n_rectangles (compo_meta->overlay) > 0;
+
+  if (gst_is_kms_memory (mem)) {
+    if (!need_blend)
+      return gst_buffer_ref (inbuf);
+    if (gst_buffer_is_writable (inbuf)) {
+      if (!gst_kms_sink_blend_composition (self, inbuf, compo_meta->overlay))
+        GST_WARNING_OBJECT (self, "failed to blend overlay composition");
+      return gst_buffer_ref (inbuf);
+    }
+    /* else fall through to a copy we are allowed to draw into */
+  }
 
-  if (gst_kms_sink_import_dmabuf (self, inbuf, &buf))
+  /* a pending composition also rules out displaying imported dmabufs
+   * directly: we may only draw into buffers we own */
+  if (!need_blend && gst_kms_sink_import_dmabuf (self, inbuf, &buf))
     goto done;
 
   GST_CAT_INFO_OBJECT (CAT_PERFORMANCE, self, "frame copy");
   buf = gst_kms_sink_copy_to_dumb_buffer (self, inbuf);
 
+  if (buf && need_blend &&
+      !gst_kms_sink_blend_composition (self, buf, compo_meta->overlay))
+    GST_WARNING_OBJECT (self, "failed to blend overlay composition");
+
 done:
   /* Copy all the non-memory related metas, this way CropMeta will be
    * available upon GstVideoOverlay::expose calls. */
-  if (buf)
+  if (buf && buf != inbuf)
     gst_buffer_copy_into (buf, inbuf, GST_BUFFER_COPY_METADATA, 0, -1);
 
   return buf;
@@ -1636,17 +1677,17 @@ retry_set_plane:
   }
 
 sync_frame:
-  /* Wait for the previous frame to complete redraw */
-  if (!gst_kms_sink_sync (self)) {
-    GST_OBJECT_UNLOCK (self);
+  /* Drop the object lock before waiting for the previous frame to complete
+   * redraw, this blocks until the next vblank and would otherwise stall any
+   * concurrent property access for up to a frame duration */
+  GST_OBJECT_UNLOCK (self);
+  if (!gst_kms_sink_sync (self))
     goto bail;
-  }
 
   if (buffer != self->last_buffer)
     gst_buffer_replace (&self->last_buffer, buffer);
   g_clear_pointer (&self->tmp_kmsmem, gst_memory_unref);
 
-  GST_OBJECT_UNLOCK (self);
   res = GST_FLOW_OK;
 
 bail:
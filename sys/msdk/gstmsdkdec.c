@@ -1199,6 +1199,19 @@ gst_msdkdec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
     thiz->use_video_memory = thiz->use_dmabuf = TRUE;
   }
 
+  /* If downstream is another msdk element proposing its own bufferpool, the
+   * session is already shared through the common GstMsdkContext and decoding
+   * straight into video memory avoids the per-frame surface copy in between
+   * (e.g. a msdkdec ! msdkenc transcode) */
+  if (thiz->hardware && !thiz->use_video_memory
+      && GST_IS_MSDK_BUFFER_POOL (pool)
+      && gst_buffer_pool_config_has_option (pool_config,
+          GST_BUFFER_POOL_OPTION_MSDK_USE_VIDEO_MEMORY)) {
+    GST_INFO_OBJECT (decoder,
+        "Downstream proposed an MSDK video memory pool, using video memory");
+    thiz->use_video_memory = TRUE;
+  }
+
   /* Initialize MSDK decoder before new bufferpool tries to alloc each buffer,
    * which requires information of frame allocation.
    * No effect if already initialized.
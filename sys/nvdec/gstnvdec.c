@@ -564,6 +564,11 @@ gst_nvdec_set_format (GstVideoDecoder * decoder, GstVideoCodecState * state)
   return TRUE;
 }
 
+/* Runs on the GL thread. The cuMemcpy2D below is device-to-device: the
+ * decoded surface is blitted straight into the GL texture's CUDA mapping,
+ * nothing crosses PCIe at this point. Handing downstream raw CUDA device
+ * pointers instead would need a dedicated memory type and caps feature,
+ * which this GStreamer version does not provide. */
 static void
 copy_video_frame_to_gl_textures (GstGLContext * context, gpointer * args)
 {
@@ -647,7 +652,7 @@ handle_pending_frames (GstNvDec * nvdec)
   guint width, height, fps_n, fps_d, i, num_resources;
   CUVIDPICPARAMS *decode_params;
   CUVIDPARSERDISPINFO *dispinfo;
-  CUgraphicsResource *resources;
+  CUgraphicsResource resources[GST_VIDEO_MAX_PLANES];
   gpointer args[4];
   GstMemory *mem;
   GstFlowReturn ret = GST_FLOW_OK;
@@ -882,7 +887,12 @@ handle_pending_frames (GstNvDec * nvdec)
         }
 
         num_resources = gst_buffer_n_memory (pending_frame->output_buffer);
-        resources = g_new (CUgraphicsResource, num_resources);
+        if (num_resources > G_N_ELEMENTS (resources)) {
+          GST_ERROR_OBJECT (nvdec, "output buffer has %u memories, expected "
+              "at most one per plane", num_resources);
+          ret = GST_FLOW_ERROR;
+          break;
+        }
 
         for (i = 0; i < num_resources; i++) {
           mem = gst_buffer_get_memory (pending_frame->output_buffer, i);
@@ -899,7 +909,6 @@ handle_pending_frames (GstNvDec * nvdec)
         args[3] = GUINT_TO_POINTER (num_resources);
         gst_gl_context_thread_add (nvdec->gl_context,
             (GstGLContextThreadFunc) copy_video_frame_to_gl_textures, args);
-        g_free (resources);
 
         if (!dispinfo->progressive_frame) {
           GST_BUFFER_FLAG_SET (pending_frame->output_buffer,
@@ -686,9 +686,16 @@ _find_frame_with_output_buffer (GstNvBaseEnc * nvenc, NV_ENC_OUTPUT_PTR out_buf)
       if (!state->out_bufs[i])
         break;
 
-      if (state->out_bufs[i] == out_buf)
+      if (state->out_bufs[i] == out_buf) {
         ret = frame;
+        break;
+      }
     }
+
+    /* stop walking the pending frames once found, with a full set of
+     * buffers in flight this list can be several dozen entries long */
+    if (ret)
+      break;
   }
 
   if (ret)
@@ -1558,6 +1565,26 @@ _map_gl_input_buffer (GstGLContext * context, struct map_gl_input *data)
 }
 #endif
 
+static void
+_copy_plane (guint8 * dest, guint dest_stride, const guint8 * src,
+    guint src_stride, guint width, guint height)
+{
+  guint y;
+
+  if (src_stride == dest_stride) {
+    /* matching strides, the whole plane is contiguous in both buffers and
+     * can be copied in one go, row padding included */
+    memcpy (dest, src, (gsize) src_stride * (height - 1) + width);
+    return;
+  }
+
+  for (y = 0; y < height; ++y) {
+    memcpy (dest, src, width);
+    dest += dest_stride;
+    src += src_stride;
+  }
+}
+
 static GstFlowReturn
 _acquire_input_buffer (GstNvBaseEnc * nvenc, gpointer * input)
 {
@@ -1745,7 +1772,6 @@ gst_nv_base_enc_handle_frame (GstVideoEncoder * enc, GstVideoCodecFrame * frame)
     guint8 *src, *dest;
     guint src_stride, dest_stride;
     guint height, width;
-    guint y;
 
     GST_LOG_OBJECT (enc, "got input buffer %p", in_buf);
 
@@ -1768,11 +1794,7 @@ gst_nv_base_enc_handle_frame (GstVideoEncoder * enc, GstVideoCodecFrame * frame)
     src_stride = GST_VIDEO_FRAME_PLANE_STRIDE (&vframe, 0);
     dest = in_buf_lock.bufferDataPtr;
     dest_stride = in_buf_lock.pitch;
-    for (y = 0; y < height; ++y) {
-      memcpy (dest, src, width);
-      dest += dest_stride;
-      src += src_stride;
-    }
+    _copy_plane (dest, dest_stride, src, src_stride, width, height);
 
     if (GST_VIDEO_FRAME_FORMAT (&vframe) == GST_VIDEO_FORMAT_NV12) {
       /* copy UV plane */
@@ -1782,11 +1804,8 @@ gst_nv_base_enc_handle_frame (GstVideoEncoder * enc, GstVideoCodecFrame * frame)
           (guint8 *) in_buf_lock.bufferDataPtr +
           GST_ROUND_UP_32 (height) * in_buf_lock.pitch;
       dest_stride = in_buf_lock.pitch;
-      for (y = 0; y < GST_ROUND_UP_2 (height) / 2; ++y) {
-        memcpy (dest, src, width);
-        dest += dest_stride;
-        src += src_stride;
-      }
+      _copy_plane (dest, dest_stride, src, src_stride, width,
+          GST_ROUND_UP_2 (height) / 2);
     } else if (GST_VIDEO_FRAME_FORMAT (&vframe) == GST_VIDEO_FORMAT_I420) {
       guint8 *dest_u, *dest_v;
 
@@ -1799,22 +1818,14 @@ gst_nv_base_enc_handle_frame (GstVideoEncoder * enc, GstVideoCodecFrame * frame)
       /* copy U plane */
       src = GST_VIDEO_FRAME_PLANE_DATA (&vframe, 1);
       src_stride = GST_VIDEO_FRAME_PLANE_STRIDE (&vframe, 1);
-      dest = dest_u;
-      for (y = 0; y < GST_ROUND_UP_2 (height) / 2; ++y) {
-        memcpy (dest, src, width / 2);
-        dest += dest_stride;
-        src += src_stride;
-      }
+      _copy_plane (dest_u, dest_stride, src, src_stride, width / 2,
+          GST_ROUND_UP_2 (height) / 2);
 
       /* copy V plane */
       src = GST_VIDEO_FRAME_PLANE_DATA (&vframe, 2);
       src_stride = GST_VIDEO_FRAME_PLANE_STRIDE (&vframe, 2);
-      dest = dest_v;
-      for (y = 0; y < GST_ROUND_UP_2 (height) / 2; ++y) {
-        memcpy (dest, src, width / 2);
-        dest += dest_stride;
-        src += src_stride;
-      }
+      _copy_plane (dest_v, dest_stride, src, src_stride, width / 2,
+          GST_ROUND_UP_2 (height) / 2);
     } else {
       // FIXME: this only works for NV12 and I420
       g_assert_not_reached ();
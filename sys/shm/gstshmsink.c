@@ -39,6 +39,7 @@
 #include "gstshmsink.h"
 
 #include <gst/gst.h>
+#include <gst/allocators/gstdmabuf.h>
 
 #include <string.h>
 
@@ -58,7 +59,8 @@ enum
   PROP_PERMS,
   PROP_SHM_SIZE,
   PROP_WAIT_FOR_CONNECTION,
-  PROP_BUFFER_TIME
+  PROP_BUFFER_TIME,
+  PROP_ENABLE_DMABUF
 };
 
 struct GstShmClient
@@ -69,6 +71,7 @@ struct GstShmClient
 
 #define DEFAULT_SIZE ( 64 * 1024 * 1024 )
 #define DEFAULT_WAIT_FOR_CONNECTION (TRUE)
+#define DEFAULT_ENABLE_DMABUF (FALSE)
 /* Default is user read/write, group read */
 #define DEFAULT_PERMS ( S_IRUSR | S_IWUSR | S_IRGRP )
 
@@ -354,6 +357,7 @@ gst_shm_sink_init (GstShmSink * self)
   self->size = DEFAULT_SIZE;
   self->unlock = FALSE;
   self->wait_for_connection = DEFAULT_WAIT_FOR_CONNECTION;
+  self->enable_dmabuf = DEFAULT_ENABLE_DMABUF;
   self->perms = DEFAULT_PERMS;
 
   gst_allocation_params_init (&self->params);
@@ -410,6 +414,14 @@ gst_shm_sink_class_init (GstShmSinkClass * klass)
           DEFAULT_WAIT_FOR_CONNECTION,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_ENABLE_DMABUF,
+      g_param_spec_boolean ("enable-dmabuf",
+          "Enable dmabuf passing",
+          "Pass dmabuf backed buffers to the clients as file descriptors "
+          "instead of copying them into the shared memory area (all clients "
+          "must support fd passing)",
+          DEFAULT_ENABLE_DMABUF, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class, PROP_BUFFER_TIME,
       g_param_spec_int64 ("buffer-time",
           "Buffer Time of the shm buffer",
@@ -505,6 +517,11 @@ gst_shm_sink_set_property (GObject * object, guint prop_id,
       GST_OBJECT_UNLOCK (object);
       g_cond_broadcast (&self->cond);
       break;
+    case PROP_ENABLE_DMABUF:
+      GST_OBJECT_LOCK (object);
+      self->enable_dmabuf = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (object);
+      break;
     default:
       break;
   }
@@ -534,6 +551,9 @@ gst_shm_sink_get_property (GObject * object, guint prop_id,
     case PROP_BUFFER_TIME:
       g_value_set_int64 (value, self->buffer_time);
       break;
+    case PROP_ENABLE_DMABUF:
+      g_value_set_boolean (value, self->enable_dmabuf);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -667,6 +687,7 @@ gst_shm_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   gboolean need_new_memory = FALSE;
   GstFlowReturn ret = GST_FLOW_OK;
   GstMemory *memory = NULL;
+  GstShmSinkMemory *mymem;
   GstBuffer *sendbuf = NULL;
   gsize written_bytes;
 
@@ -701,6 +722,33 @@ gst_shm_sink_render (GstBaseSink * bsink, GstBuffer * buf)
   }
 
 
+  /* dmabuf backed buffers can be passed as file descriptors over the
+   * control socket without ever copying the data */
+  if (self->enable_dmabuf && gst_buffer_n_memory (buf) == 1) {
+    gsize offset, msize;
+
+    memory = gst_buffer_peek_memory (buf, 0);
+    msize = gst_memory_get_sizes (memory, &offset, NULL);
+
+    if (gst_is_dmabuf_memory (memory) && offset == 0) {
+      rv = sp_writer_send_fd_buf (self->pipe,
+          gst_dmabuf_memory_get_fd (memory), msize, gst_buffer_ref (buf));
+
+      GST_OBJECT_UNLOCK (self);
+
+      if (rv == 0) {
+        GST_DEBUG_OBJECT (self, "No clients connected, unreffing buffer");
+        gst_buffer_unref (buf);
+      }
+
+      return ret;
+    }
+
+    GST_LOG_OBJECT (self, "Buffer %p is not a dmabuf we can pass as a file"
+        " descriptor, falling back to the copy path", buf);
+    memory = NULL;
+  }
+
   if (gst_buffer_n_memory (buf) > 1) {
     GST_LOG_OBJECT (self, "Buffer %p has %d GstMemory, we only support a single"
         " one, need to do a memcpy", buf, gst_buffer_n_memory (buf));
@@ -788,7 +836,15 @@ gst_shm_sink_render (GstBaseSink * bsink, GstBuffer * buf)
    * We know it's not mapped for writing anywhere as we just mapped it for
    * reading
    */
-  rv = sp_writer_send_buf (self->pipe, (char *) map.data, map.size, sendbuf);
+  mymem = (GstShmSinkMemory *) gst_buffer_peek_memory (sendbuf, 0);
+  if (mymem->block)
+    rv = sp_writer_send_block_buf (self->pipe, mymem->block,
+        (char *) map.data - sp_writer_block_get_buf (mymem->block), map.size,
+        sendbuf);
+  else
+    /* Shared sub-memories don't carry the block, fall back to looking the
+     * buffer up by address */
+    rv = sp_writer_send_buf (self->pipe, (char *) map.data, map.size, sendbuf);
   if (rv == -1) {
     GST_ELEMENT_ERROR (self, STREAM, FAILED,
         (NULL), ("Failed to send data over SHM"));
@@ -41,8 +41,10 @@
 #include "gstshmsrc.h"
 
 #include <gst/gst.h>
+#include <gst/allocators/gstdmabuf.h>
 
 #include <string.h>
+#include <unistd.h>
 
 /* signals */
 enum
@@ -65,6 +67,14 @@ struct GstShmBuffer
   GstShmPipe *pipe;
 };
 
+/* Bookkeeping for a buffer that was received as a file descriptor, the
+ * writer keeps the original buffer alive until it is acked */
+struct GstShmFdBuffer
+{
+  unsigned long id;
+  GstShmPipe *pipe;
+};
+
 
 GST_DEBUG_CATEGORY_STATIC (shmsrc_debug);
 #define GST_CAT_DEFAULT shmsrc_debug
@@ -161,6 +171,8 @@ gst_shm_src_finalize (GObject * object)
 
   gst_poll_free (self->poll);
   g_free (self->socket_path);
+  if (self->dmabuf_allocator)
+    gst_object_unref (self->dmabuf_allocator);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -318,12 +330,32 @@ free_buffer (gpointer data)
   g_slice_free (struct GstShmBuffer, gsb);
 }
 
+static void
+free_fd_buffer (gpointer data)
+{
+  struct GstShmFdBuffer *gsb = data;
+  g_return_if_fail (gsb->pipe != NULL);
+  g_return_if_fail (gsb->pipe->src != NULL);
+
+  GST_LOG ("Freeing fd buffer %lu", gsb->id);
+
+  GST_OBJECT_LOCK (gsb->pipe->src);
+  sp_client_recv_finish_fd (gsb->pipe->pipe, gsb->id);
+  GST_OBJECT_UNLOCK (gsb->pipe->src);
+
+  gst_shm_pipe_dec (gsb->pipe);
+
+  g_slice_free (struct GstShmFdBuffer, gsb);
+}
+
 static GstFlowReturn
 gst_shm_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
 {
   GstShmSrc *self = GST_SHM_SRC (psrc);
   GstShmPipe *pipe;
   gchar *buf = NULL;
+  int memfd = -1;
+  unsigned long fd_buf_id = 0;
   int rv = 0;
   struct GstShmBuffer *gsb;
 
@@ -365,9 +397,10 @@ gst_shm_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
 
     if (gst_poll_fd_can_read (self->poll, &self->pollfd)) {
       buf = NULL;
+      memfd = -1;
       GST_LOG_OBJECT (self, "Reading from pipe");
       GST_OBJECT_LOCK (self);
-      rv = sp_client_recv (pipe->pipe, &buf);
+      rv = sp_client_recv_fd (pipe->pipe, &buf, &memfd, &fd_buf_id);
       GST_OBJECT_UNLOCK (self);
       if (rv < 0) {
         GST_ELEMENT_ERROR (self, RESOURCE, READ, ("Failed to read from shmsrc"),
@@ -375,7 +408,43 @@ gst_shm_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
         goto error;
       }
     }
-  } while (buf == NULL);
+  } while (buf == NULL && memfd < 0);
+
+  if (memfd >= 0) {
+    GstMemory *mem;
+    struct GstShmFdBuffer *gsfb;
+
+    GST_LOG_OBJECT (self, "Got dmabuf %d of size %d", memfd, rv);
+
+    if (!self->dmabuf_allocator)
+      self->dmabuf_allocator = gst_dmabuf_allocator_new ();
+
+    mem = gst_dmabuf_allocator_alloc (self->dmabuf_allocator, memfd, rv);
+    if (!mem) {
+      GST_OBJECT_LOCK (self);
+      sp_client_recv_finish_fd (pipe->pipe, fd_buf_id);
+      GST_OBJECT_UNLOCK (self);
+      close (memfd);
+      GST_ELEMENT_ERROR (self, RESOURCE, READ, ("Failed to read from shmsrc"),
+          ("Could not wrap received dmabuf %d", memfd));
+      goto error;
+    }
+    GST_MINI_OBJECT_FLAG_SET (mem, GST_MEMORY_FLAG_READONLY);
+
+    /* Hold the ack back until the memory is no longer in use, the writer
+     * keeps the original buffer (and so the dmabuf contents) alive until
+     * then */
+    gsfb = g_slice_new0 (struct GstShmFdBuffer);
+    gsfb->id = fd_buf_id;
+    gsfb->pipe = pipe;
+    gst_mini_object_set_qdata (GST_MINI_OBJECT_CAST (mem),
+        g_quark_from_static_string ("GstShmFdBuffer"), gsfb, free_fd_buffer);
+
+    *outbuf = gst_buffer_new ();
+    gst_buffer_append_memory (*outbuf, mem);
+
+    return GST_FLOW_OK;
+  }
 
   GST_LOG_OBJECT (self, "Got buffer %p of size %d", buf, rv);
 
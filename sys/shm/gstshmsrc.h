@@ -53,6 +53,8 @@ struct _GstShmSrc
   GstPoll *poll;
   GstPollFD pollfd;
 
+  GstAllocator *dmabuf_allocator;
+
 
   GstFlowReturn flow_return;
   gboolean unlocked;
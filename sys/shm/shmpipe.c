@@ -67,7 +67,16 @@
  * type 4: ack buffer
  * offset
  *
- * Type 4 goes from the client to the server
+ * type 5: fd buffer
+ * id
+ * bufsize
+ * The file descriptor itself is attached to the packet as SCM_RIGHTS
+ * ancillary data and is not part of the shared memory area.
+ *
+ * type 6: ack fd buffer
+ * id
+ *
+ * Types 4 and 6 go from the client to the server
  * The rest are from the server to the client
  * The client should never write in the SHM
  */
@@ -80,7 +89,9 @@ enum
   COMMAND_NEW_SHM_AREA = 1,
   COMMAND_CLOSE_SHM_AREA = 2,
   COMMAND_NEW_BUFFER = 3,
-  COMMAND_ACK_BUFFER = 4
+  COMMAND_ACK_BUFFER = 4,
+  COMMAND_NEW_FD_BUFFER = 5,
+  COMMAND_ACK_FD_BUFFER = 6
 };
 
 typedef struct _ShmArea ShmArea;
@@ -124,6 +135,28 @@ struct _ShmBuffer
 };
 
 
+typedef struct _ShmFdBuffer ShmFdBuffer;
+
+/* A buffer that lives outside the shm area and was passed to the clients
+ * as a file descriptor, each client gets its own duplicate of the fd and
+ * is responsible for closing it. */
+struct _ShmFdBuffer
+{
+  int use_count;
+
+  unsigned long id;
+  size_t size;
+
+  ShmFdBuffer *next;
+
+  void *tag;
+
+  int num_clients;
+  /* This must ALWAYS stay last in the struct */
+  int clients[0];
+};
+
+
 struct _ShmPipe
 {
   int main_socket;
@@ -137,6 +170,10 @@ struct _ShmPipe
 
   ShmBuffer *buffers;
 
+  unsigned long next_fd_buffer_id;
+
+  ShmFdBuffer *fd_buffers;
+
   int num_clients;
   ShmClient *clients;
 
@@ -179,6 +216,11 @@ struct CommandBuffer
     {
       unsigned long offset;
     } ack_buffer;
+    struct
+    {
+      unsigned long id;
+      unsigned long size;
+    } fd_buffer;
   } payload;
 };
 
@@ -186,6 +228,8 @@ static ShmArea *sp_open_shm (char *path, int id, mode_t perms, size_t size);
 static void sp_close_shm (ShmArea * area);
 static int sp_shmbuf_dec (ShmPipe * self, ShmBuffer * buf,
     ShmBuffer * prev_buf, ShmClient * client, void **tag);
+static int sp_shmfdbuf_dec (ShmPipe * self, ShmFdBuffer * buf,
+    ShmFdBuffer * prev_buf, ShmClient * client, void **tag);
 static void sp_shm_area_dec (ShmPipe * self, ShmArea * area);
 
 
@@ -485,6 +529,40 @@ send_command (int fd, struct CommandBuffer *cb, unsigned short int type,
   return 1;
 }
 
+/* Like send_command(), but attaches @passed_fd to the packet as SCM_RIGHTS
+ * ancillary data, the kernel duplicates the descriptor into the receiving
+ * process. */
+static int
+send_command_with_fd (int fd, struct CommandBuffer *cb,
+    unsigned short int type, int area_id, int passed_fd)
+{
+  struct msghdr msg = { 0 };
+  struct iovec iov;
+  struct cmsghdr *cmsg;
+  char control[CMSG_SPACE (sizeof (int))] = { 0 };
+
+  cb->type = type;
+  cb->area_id = area_id;
+
+  iov.iov_base = cb;
+  iov.iov_len = sizeof (struct CommandBuffer);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof (control);
+
+  cmsg = CMSG_FIRSTHDR (&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN (sizeof (int));
+  memcpy (CMSG_DATA (cmsg), &passed_fd, sizeof (int));
+
+  if (sendmsg (fd, &msg, MSG_NOSIGNAL) != sizeof (struct CommandBuffer))
+    return 0;
+
+  return 1;
+}
+
 int
 sp_writer_resize (ShmPipe * self, size_t size)
 {
@@ -573,6 +651,51 @@ sp_writer_free_block (ShmBlock * block)
   spalloc_free (ShmBlock, block);
 }
 
+static int
+sp_writer_send_buf_internal (ShmPipe * self, ShmArea * area,
+    ShmAllocBlock * ablock, unsigned long offset, size_t size, void *tag)
+{
+  ShmBuffer *sb;
+  ShmClient *client = NULL;
+  int i = 0;
+  int c = 0;
+
+  sb = spalloc_alloc (sizeof (ShmBuffer) + sizeof (int) * self->num_clients);
+  memset (sb, 0, sizeof (ShmBuffer));
+  memset (sb->clients, -1, sizeof (int) * self->num_clients);
+  sb->shm_area = area;
+  sb->offset = offset;
+  sb->size = size;
+  sb->num_clients = self->num_clients;
+  sb->ablock = ablock;
+  sb->tag = tag;
+
+  for (client = self->clients; client; client = client->next) {
+    struct CommandBuffer cb = { 0 };
+    cb.payload.buffer.offset = offset;
+    cb.payload.buffer.size = size;
+    if (!send_command (client->fd, &cb, COMMAND_NEW_BUFFER, area->id))
+      continue;
+    sb->clients[i++] = client->fd;
+    c++;
+  }
+
+  if (c == 0) {
+    spalloc_free1 (sizeof (ShmBuffer) + sizeof (int) * sb->num_clients, sb);
+    return 0;
+  }
+
+  sp_shm_area_inc (area);
+  shm_alloc_space_block_inc (ablock);
+
+  sb->use_count = c;
+
+  sb->next = self->buffers;
+  self->buffers = sb;
+
+  return c;
+}
+
 /* Returns the number of client this has successfully been sent to */
 
 int
@@ -580,12 +703,7 @@ sp_writer_send_buf (ShmPipe * self, char *buf, size_t size, void *tag)
 {
   ShmArea *area = NULL;
   unsigned long offset = 0;
-  unsigned long bsize = size;
-  ShmBuffer *sb;
-  ShmClient *client = NULL;
   ShmAllocBlock *ablock = NULL;
-  int i = 0;
-  int c = 0;
 
   if (self->num_clients == 0)
     return 0;
@@ -603,66 +721,146 @@ sp_writer_send_buf (ShmPipe * self, char *buf, size_t size, void *tag)
   if (!ablock)
     return -1;
 
-  sb = spalloc_alloc (sizeof (ShmBuffer) + sizeof (int) * self->num_clients);
-  memset (sb, 0, sizeof (ShmBuffer));
+  return sp_writer_send_buf_internal (self, area, ablock, offset, size, tag);
+}
+
+/* Like sp_writer_send_buf(), but for callers that still hold the ShmBlock
+ * the data was allocated in: @offset is relative to the start of the
+ * block. This skips the per-buffer area and block list walks, which is
+ * what you want when sending at high frame rates. */
+
+int
+sp_writer_send_block_buf (ShmPipe * self, ShmBlock * block, size_t offset,
+    size_t size, void *tag)
+{
+  unsigned long abs_offset;
+
+  if (self->num_clients == 0)
+    return 0;
+
+  abs_offset = shm_alloc_space_alloc_block_get_offset (block->ablock) + offset;
+
+  return sp_writer_send_buf_internal (self, block->area, block->ablock,
+      abs_offset, size, tag);
+}
+
+/* Returns the number of clients the fd has successfully been sent to */
+
+int
+sp_writer_send_fd_buf (ShmPipe * self, int fd, size_t size, void *tag)
+{
+  ShmFdBuffer *sb;
+  ShmClient *client = NULL;
+  int i = 0;
+  int c = 0;
+
+  if (self->num_clients == 0)
+    return 0;
+
+  sb = spalloc_alloc (sizeof (ShmFdBuffer) + sizeof (int) * self->num_clients);
+  memset (sb, 0, sizeof (ShmFdBuffer));
   memset (sb->clients, -1, sizeof (int) * self->num_clients);
-  sb->shm_area = area;
-  sb->offset = offset;
+  sb->id = ++self->next_fd_buffer_id;
   sb->size = size;
   sb->num_clients = self->num_clients;
-  sb->ablock = ablock;
   sb->tag = tag;
 
   for (client = self->clients; client; client = client->next) {
     struct CommandBuffer cb = { 0 };
-    cb.payload.buffer.offset = offset;
-    cb.payload.buffer.size = bsize;
-    if (!send_command (client->fd, &cb, COMMAND_NEW_BUFFER, self->shm_area->id))
+    cb.payload.fd_buffer.id = sb->id;
+    cb.payload.fd_buffer.size = size;
+    if (!send_command_with_fd (client->fd, &cb, COMMAND_NEW_FD_BUFFER, 0, fd))
       continue;
     sb->clients[i++] = client->fd;
     c++;
   }
 
   if (c == 0) {
-    spalloc_free1 (sizeof (ShmBuffer) + sizeof (int) * sb->num_clients, sb);
+    spalloc_free1 (sizeof (ShmFdBuffer) + sizeof (int) * sb->num_clients, sb);
     return 0;
   }
 
-  sp_shm_area_inc (area);
-  shm_alloc_space_block_inc (ablock);
-
   sb->use_count = c;
 
-  sb->next = self->buffers;
-  self->buffers = sb;
+  sb->next = self->fd_buffers;
+  self->fd_buffers = sb;
 
   return c;
 }
 
+/* Reads one command, if @out_fd is not NULL, it is set to the file
+ * descriptor received as ancillary data with the command (or -1 if there
+ * was none). Commands that may carry a descriptor must always be received
+ * with a non-NULL @out_fd, otherwise the descriptor would leak into this
+ * process. */
 static int
-recv_command (int fd, struct CommandBuffer *cb)
+recv_command (int fd, struct CommandBuffer *cb, int *out_fd)
 {
+  struct msghdr msg = { 0 };
+  struct iovec iov;
+  struct cmsghdr *cmsg;
+  char control[CMSG_SPACE (sizeof (int))] = { 0 };
   int retval;
 
-  retval = recv (fd, cb, sizeof (struct CommandBuffer), MSG_DONTWAIT);
-  if (retval == sizeof (struct CommandBuffer)) {
-    return 1;
-  } else {
+  if (out_fd)
+    *out_fd = -1;
+
+  iov.iov_base = cb;
+  iov.iov_len = sizeof (struct CommandBuffer);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof (control);
+
+  retval = recvmsg (fd, &msg, MSG_DONTWAIT);
+  if (retval != sizeof (struct CommandBuffer))
     return 0;
+
+  for (cmsg = CMSG_FIRSTHDR (&msg); cmsg; cmsg = CMSG_NXTHDR (&msg, cmsg)) {
+    int received_fd;
+
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN (sizeof (int)))
+      continue;
+
+    memcpy (&received_fd, CMSG_DATA (cmsg), sizeof (int));
+    if (out_fd && *out_fd < 0)
+      *out_fd = received_fd;
+    else
+      close (received_fd);
   }
+
+  return 1;
 }
 
 long int
 sp_client_recv (ShmPipe * self, char **buf)
+{
+  return sp_client_recv_fd (self, buf, NULL, NULL);
+}
+
+long int
+sp_client_recv_fd (ShmPipe * self, char **buf, int *fd,
+    unsigned long *fd_buffer_id)
 {
   char *area_name = NULL;
   ShmArea *newarea;
   ShmArea *area;
   struct CommandBuffer cb;
+  int received_fd = -1;
   int retval;
 
-  if (!recv_command (self->main_socket, &cb))
+  if (!recv_command (self->main_socket, &cb, &received_fd)) {
+    if (received_fd >= 0)
+      close (received_fd);
     return -1;
+  }
+
+  /* Only fd buffer packets may carry a descriptor */
+  if (cb.type != COMMAND_NEW_FD_BUFFER && received_fd >= 0) {
+    close (received_fd);
+    received_fd = -1;
+  }
 
   switch (cb.type) {
     case COMMAND_NEW_SHM_AREA:
@@ -709,6 +907,24 @@ sp_client_recv (ShmPipe * self, char **buf)
       }
       return -23;
 
+    case COMMAND_NEW_FD_BUFFER:
+      if (received_fd < 0)
+        return -24;
+
+      /* Callers that don't handle fd buffers just ack (and close) the
+       * descriptor right away, they only lose a buffer, not the
+       * connection. */
+      if (!fd) {
+        close (received_fd);
+        sp_client_recv_finish_fd (self, cb.payload.fd_buffer.id);
+        break;
+      }
+
+      *fd = received_fd;
+      if (fd_buffer_id)
+        *fd_buffer_id = cb.payload.fd_buffer.id;
+      return cb.payload.fd_buffer.size;
+
     default:
       return -99;
   }
@@ -720,9 +936,10 @@ int
 sp_writer_recv (ShmPipe * self, ShmClient * client, void **tag)
 {
   ShmBuffer *buf = NULL, *prev_buf = NULL;
+  ShmFdBuffer *fdbuf = NULL, *prev_fdbuf = NULL;
   struct CommandBuffer cb;
 
-  if (!recv_command (client->fd, &cb))
+  if (!recv_command (client->fd, &cb, NULL))
     return -1;
 
   switch (cb.type) {
@@ -736,6 +953,17 @@ sp_writer_recv (ShmPipe * self, ShmClient * client, void **tag)
         prev_buf = buf;
       }
 
+      return -2;
+
+    case COMMAND_ACK_FD_BUFFER:
+
+      for (fdbuf = self->fd_buffers; fdbuf; fdbuf = fdbuf->next) {
+        if (fdbuf->id == cb.payload.fd_buffer.id) {
+          return sp_shmfdbuf_dec (self, fdbuf, prev_fdbuf, client, tag);
+        }
+        prev_fdbuf = fdbuf;
+      }
+
       return -2;
     default:
       return -99;
@@ -768,6 +996,15 @@ sp_client_recv_finish (ShmPipe * self, char *buf)
       self->shm_area->id);
 }
 
+int
+sp_client_recv_finish_fd (ShmPipe * self, unsigned long fd_buffer_id)
+{
+  struct CommandBuffer cb = { 0 };
+
+  cb.payload.fd_buffer.id = fd_buffer_id;
+  return send_command (self->main_socket, &cb, COMMAND_ACK_FD_BUFFER, 0);
+}
+
 ShmPipe *
 sp_client_open (const char *path)
 {
@@ -891,11 +1128,47 @@ sp_shmbuf_dec (ShmPipe * self, ShmBuffer * buf, ShmBuffer * prev_buf,
   return 1;
 }
 
+static int
+sp_shmfdbuf_dec (ShmPipe * self, ShmFdBuffer * buf, ShmFdBuffer * prev_buf,
+    ShmClient * client, void **tag)
+{
+  int i;
+  int had_client = 0;
+
+  /* See sp_shmbuf_dec() for why the client is removed from the list */
+  for (i = 0; i < buf->num_clients; i++) {
+    if (buf->clients[i] == client->fd) {
+      buf->clients[i] = -1;
+      had_client = 1;
+      break;
+    }
+  }
+  assert (had_client);
+
+  buf->use_count--;
+
+  if (buf->use_count == 0) {
+    /* Remove from linked list */
+    if (prev_buf)
+      prev_buf->next = buf->next;
+    else
+      self->fd_buffers = buf->next;
+
+    if (tag)
+      *tag = buf->tag;
+    spalloc_free1 (sizeof (ShmFdBuffer) + sizeof (int) * buf->num_clients,
+        buf);
+    return 0;
+  }
+  return 1;
+}
+
 void
 sp_writer_close_client (ShmPipe * self, ShmClient * client,
     sp_buffer_free_callback callback, void *user_data)
 {
   ShmBuffer *buffer = NULL, *prev_buf = NULL;
+  ShmFdBuffer *fd_buffer = NULL, *prev_fdbuf = NULL;
   ShmClient *item = NULL, *prev_item = NULL;
 
   shutdown (client->fd, SHUT_RDWR);
@@ -919,6 +1192,24 @@ again:
     prev_buf = buffer;
   }
 
+again_fd:
+  for (fd_buffer = self->fd_buffers; fd_buffer; fd_buffer = fd_buffer->next) {
+    int i;
+    void *tag = NULL;
+
+    for (i = 0; i < fd_buffer->num_clients; i++) {
+      if (fd_buffer->clients[i] == client->fd) {
+        if (!sp_shmfdbuf_dec (self, fd_buffer, prev_fdbuf, client, &tag)) {
+          if (callback)
+            callback (tag, user_data);
+          goto again_fd;
+        }
+        break;
+      }
+    }
+    prev_fdbuf = fd_buffer;
+  }
+
   for (item = self->clients; item; item = item->next) {
     if (item == client)
       break;
@@ -960,7 +1251,7 @@ sp_writer_get_client_fd (ShmClient * client)
 int
 sp_writer_pending_writes (ShmPipe * self)
 {
-  return (self->buffers != NULL);
+  return (self->buffers != NULL || self->fd_buffers != NULL);
 }
 
 const char *
@@ -56,6 +56,14 @@
  * buffers are no longer valid. If was valid buffer was received, the
  * client must release it with sp_client_recv_finish() when it is done
  * reading from it.
+ *
+ * Instead of copying data into the shared memory area, the writer can
+ * also pass a file descriptor (such as a dmabuf) directly to the other
+ * side with sp_writer_send_fd_buf(). Readers that want to receive such
+ * buffers must use sp_client_recv_fd() instead of sp_client_recv(); it
+ * behaves the same, but additionally returns the received descriptor
+ * (which the client now owns) and the buffer id that must be passed to
+ * sp_client_recv_finish_fd() when the client is done with the buffer.
  */
 
 
@@ -97,6 +105,9 @@ int sp_writer_get_client_fd (ShmClient * client);
 ShmBlock *sp_writer_alloc_block (ShmPipe * self, size_t size);
 void sp_writer_free_block (ShmBlock *block);
 int sp_writer_send_buf (ShmPipe * self, char *buf, size_t size, void * tag);
+int sp_writer_send_block_buf (ShmPipe * self, ShmBlock * block, size_t offset,
+    size_t size, void * tag);
+int sp_writer_send_fd_buf (ShmPipe * self, int fd, size_t size, void * tag);
 char *sp_writer_block_get_buf (ShmBlock *block);
 ShmPipe *sp_writer_block_get_pipe (ShmBlock *block);
 size_t sp_writer_get_max_buf_size (ShmPipe * self);
@@ -114,7 +125,10 @@ void *sp_writer_buf_get_tag (ShmBuffer * buffer);
 
 ShmPipe *sp_client_open (const char *path);
 long int sp_client_recv (ShmPipe * self, char **buf);
+long int sp_client_recv_fd (ShmPipe * self, char **buf, int *fd,
+    unsigned long *fd_buffer_id);
 int sp_client_recv_finish (ShmPipe * self, char *buf);
+int sp_client_recv_finish_fd (ShmPipe * self, unsigned long fd_buffer_id);
 void sp_client_close (ShmPipe * self);
 
 #ifdef __cplusplus
@@ -465,7 +465,7 @@ gst_uvc_h264_mjpg_demux_chain (GstPad * pad,
 
       /* Add JPEG data between the last offset and this market */
       if (i - last_offset > 0) {
-        GstMemory *m = gst_memory_copy (info.memory, last_offset,
+        GstMemory *m = gst_memory_share (info.memory, last_offset,
             i - last_offset);
         gst_buffer_append_memory (jpeg_buf, m);
       }
@@ -591,7 +591,10 @@ gst_uvc_h264_mjpg_demux_chain (GstPad * pad,
 
       if (segment_size > 0) {
         GstMemory *m;
-        m = gst_memory_copy (info.memory, i, segment_size);
+
+        /* share the payload out of the input memory instead of copying;
+         * the sub-memory keeps the parent memory alive */
+        m = gst_memory_share (info.memory, i, segment_size);
 
         GST_BUFFER_DURATION (aux_buf) =
             aux_header.frame_interval * 100 * GST_NSECOND;
@@ -650,7 +653,7 @@ gst_uvc_h264_mjpg_demux_chain (GstPad * pad,
       /* The APP4 markers must be before the SOS marker, so this is the end */
       GST_DEBUG_OBJECT (self, "Found SOS marker.");
 
-      m = gst_memory_copy (info.memory, last_offset, info.size - last_offset);
+      m = gst_memory_share (info.memory, last_offset, info.size - last_offset);
       gst_buffer_append_memory (jpeg_buf, m);
       last_offset = info.size;
       break;
@@ -174,6 +174,100 @@ gst_vdp_device_new (const gchar * display_name, GError ** error)
   return device;
 }
 
+/* Cache of released VdpVideoSurfaces, so that surfaces can be reused
+ * across all elements on the same device instead of being destroyed and
+ * recreated per decoder instance. */
+
+#define MAX_CACHED_SURFACES 16
+
+typedef struct
+{
+  VdpChromaType chroma_type;
+  guint32 width;
+  guint32 height;
+  VdpVideoSurface surface;
+} GstVdpCachedSurface;
+
+/* gst_vdp_device_acquire_surface:
+ *
+ * Takes a matching surface from the device cache, or creates a new one if
+ * the cache has none.
+ */
+VdpStatus
+gst_vdp_device_acquire_surface (GstVdpDevice * device,
+    VdpChromaType chroma_type, guint32 width, guint32 height,
+    VdpVideoSurface * surface)
+{
+  GList *l;
+
+  g_mutex_lock (&device->surface_cache_lock);
+  for (l = device->surface_cache.head; l; l = l->next) {
+    GstVdpCachedSurface *cached = l->data;
+
+    if (cached->chroma_type == chroma_type && cached->width == width &&
+        cached->height == height) {
+      *surface = cached->surface;
+      g_queue_delete_link (&device->surface_cache, l);
+      g_slice_free (GstVdpCachedSurface, cached);
+      g_mutex_unlock (&device->surface_cache_lock);
+
+      GST_DEBUG_OBJECT (device, "Reusing cached surface %u", *surface);
+      return VDP_STATUS_OK;
+    }
+  }
+  g_mutex_unlock (&device->surface_cache_lock);
+
+  return device->vdp_video_surface_create (device->device, chroma_type,
+      width, height, surface);
+}
+
+/* gst_vdp_device_release_surface:
+ *
+ * Returns a surface to the device cache for later reuse. The least
+ * recently released surface is destroyed when the cache is full.
+ */
+void
+gst_vdp_device_release_surface (GstVdpDevice * device,
+    VdpChromaType chroma_type, guint32 width, guint32 height,
+    VdpVideoSurface surface)
+{
+  GstVdpCachedSurface *cached;
+  VdpVideoSurface evicted = VDP_INVALID_HANDLE;
+
+  cached = g_slice_new (GstVdpCachedSurface);
+  cached->chroma_type = chroma_type;
+  cached->width = width;
+  cached->height = height;
+  cached->surface = surface;
+
+  g_mutex_lock (&device->surface_cache_lock);
+  g_queue_push_head (&device->surface_cache, cached);
+  if (device->surface_cache.length > MAX_CACHED_SURFACES) {
+    cached = g_queue_pop_tail (&device->surface_cache);
+    evicted = cached->surface;
+    g_slice_free (GstVdpCachedSurface, cached);
+  }
+  g_mutex_unlock (&device->surface_cache_lock);
+
+  if (evicted != VDP_INVALID_HANDLE) {
+    GST_DEBUG_OBJECT (device, "Evicting surface %u from the cache", evicted);
+    device->vdp_video_surface_destroy (evicted);
+  }
+}
+
+static void
+gst_vdp_device_clear_surface_cache (GstVdpDevice * device)
+{
+  GstVdpCachedSurface *cached;
+
+  g_mutex_lock (&device->surface_cache_lock);
+  while ((cached = g_queue_pop_head (&device->surface_cache))) {
+    device->vdp_video_surface_destroy (cached->surface);
+    g_slice_free (GstVdpCachedSurface, cached);
+  }
+  g_mutex_unlock (&device->surface_cache_lock);
+}
+
 static void
 gst_vdp_device_init (GstVdpDevice * device)
 {
@@ -181,6 +275,9 @@ gst_vdp_device_init (GstVdpDevice * device)
   device->display = NULL;
   device->device = VDP_INVALID_HANDLE;
   device->vdp_decoder_destroy = NULL;
+
+  g_mutex_init (&device->surface_cache_lock);
+  g_queue_init (&device->surface_cache);
 }
 
 static void
@@ -188,6 +285,10 @@ gst_vdp_device_finalize (GObject * object)
 {
   GstVdpDevice *device = (GstVdpDevice *) object;
 
+  if (device->device != VDP_INVALID_HANDLE && device->vdp_video_surface_destroy)
+    gst_vdp_device_clear_surface_cache (device);
+  g_mutex_clear (&device->surface_cache_lock);
+
   if (device->device != VDP_INVALID_HANDLE && device->vdp_decoder_destroy) {
     device->vdp_device_destroy (device->device);
     device->device = VDP_INVALID_HANDLE;
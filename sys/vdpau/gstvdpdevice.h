@@ -47,11 +47,15 @@ struct _GstVdpDeviceClass
 struct _GstVdpDevice
 {
   GObject object;
-  
+
   gchar *display_name;
   Display *display;
   VdpDevice device;
 
+  /* cache of released video surfaces, shared by all users of this device */
+  GMutex surface_cache_lock;
+  GQueue surface_cache;
+
   VdpDeviceDestroy                                *vdp_device_destroy;
   VdpGetProcAddress                               *vdp_get_proc_address;
   VdpGetErrorString                               *vdp_get_error_string;
@@ -96,6 +100,13 @@ GType gst_vdp_device_get_type (void);
 
 GstVdpDevice *gst_vdp_get_device (const gchar *display_name, GError **error);
 
+VdpStatus gst_vdp_device_acquire_surface (GstVdpDevice *device,
+    VdpChromaType chroma_type, guint32 width, guint32 height,
+    VdpVideoSurface *surface);
+void gst_vdp_device_release_surface (GstVdpDevice *device,
+    VdpChromaType chroma_type, guint32 width, guint32 height,
+    VdpVideoSurface surface);
+
 G_END_DECLS
 
 #endif /* _GST_VDP_DEVICE_H_ */
@@ -65,11 +65,11 @@ _vdp_video_mem_new (GstAllocator * allocator, GstMemory * parent,
   _vdp_video_mem_init (mem, allocator, parent, device, info);
 
   GST_TRACE
-      ("Calling VdpVideoSurfaceCreate(chroma_type:%d, width:%d, height:%d)",
+      ("Acquiring surface (chroma_type:%d, width:%d, height:%d)",
       mem->chroma_type, mem->info->width, mem->info->height);
 
-  status =
-      device->vdp_video_surface_create (device->device, mem->chroma_type,
+  /* reuses a cached surface from the device when one matches */
+  status = gst_vdp_device_acquire_surface (device, mem->chroma_type,
       mem->info->width, mem->info->height, &surface);
 
   if (status != VDP_STATUS_OK)
@@ -211,14 +211,12 @@ static void
 _vdp_video_mem_free (GstAllocator * allocator, GstMemory * mem)
 {
   GstVdpVideoMemory *vmem = (GstVdpVideoMemory *) mem;
-  VdpStatus status;
 
-  GST_DEBUG ("Destroying surface %d", vmem->surface);
+  GST_DEBUG ("Releasing surface %d", vmem->surface);
 
-  status = vmem->device->vdp_video_surface_destroy (vmem->surface);
-  if (status != VDP_STATUS_OK)
-    GST_ERROR ("Couldn't destroy the VdpVideoSurface: %s",
-        vmem->device->vdp_get_error_string (status));
+  /* hand the surface back to the device cache for reuse */
+  gst_vdp_device_release_surface (vmem->device, vmem->chroma_type,
+      vmem->info->width, vmem->info->height, vmem->surface);
 
   gst_object_unref (vmem->device);
 
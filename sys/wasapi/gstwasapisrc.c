@@ -190,6 +190,7 @@ gst_wasapi_src_init (GstWasapiSrc * self)
   self->try_audioclient3 = DEFAULT_AUDIOCLIENT3;
   self->event_handle = CreateEvent (NULL, FALSE, FALSE, NULL);
   self->client_needs_restart = FALSE;
+  self->adapter = gst_adapter_new ();
 
   CoInitialize (NULL);
 }
@@ -219,6 +220,8 @@ gst_wasapi_src_dispose (GObject * object)
     self->capture_client = NULL;
   }
 
+  g_clear_object (&self->adapter);
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -570,7 +573,21 @@ gst_wasapi_src_read (GstAudioSrc * asrc, gpointer data, guint length,
 
   while (wanted > 0) {
     DWORD dwWaitResult;
-    guint have_frames, n_frames, want_frames, read_len;
+    guint bpf = self->mix_format->nBlockAlign;
+    gsize avail;
+
+    /* Serve data captured on an earlier iteration before waiting for the
+     * device again */
+    avail = gst_adapter_available (self->adapter);
+    if (avail > 0) {
+      gsize read_len = MIN (avail, wanted);
+
+      gst_adapter_copy (self->adapter, (guint8 *) data + (length - wanted),
+          0, read_len);
+      gst_adapter_flush (self->adapter, read_len);
+      wanted -= read_len;
+      continue;
+    }
 
     /* Wait for data to become available */
     dwWaitResult = WaitForSingleObject (self->event_handle, INFINITE);
@@ -580,57 +597,75 @@ gst_wasapi_src_read (GstAudioSrc * asrc, gpointer data, guint length,
       goto err;
     }
 
-    hr = IAudioCaptureClient_GetBuffer (self->capture_client,
-        (BYTE **) & from, &have_frames, &flags, NULL, NULL);
-    if (hr != S_OK) {
-      if (hr == AUDCLNT_S_BUFFER_EMPTY) {
-        gchar *msg = gst_wasapi_util_hresult_to_string (hr);
-        GST_WARNING_OBJECT (self, "IAudioCaptureClient::GetBuffer failed: %s"
-            ", retrying", msg);
-        g_free (msg);
-        length = 0;
-        goto out;
+    /* More than one period can be pending per event, particularly with
+     * loopback capture, so drain every packet the device has buffered
+     * instead of paying one wakeup per packet */
+    while (wanted > 0) {
+      guint32 packet_frames = 0;
+      guint have_frames, n_frames, want_frames, read_len;
+
+      hr = IAudioCaptureClient_GetNextPacketSize (self->capture_client,
+          &packet_frames);
+      HR_FAILED_ELEMENT_ERROR_AND (hr, IAudioCaptureClient::GetNextPacketSize,
+          self, goto err);
+      if (packet_frames == 0)
+        break;
+
+      hr = IAudioCaptureClient_GetBuffer (self->capture_client,
+          (BYTE **) & from, &have_frames, &flags, NULL, NULL);
+      if (hr != S_OK) {
+        if (hr == AUDCLNT_S_BUFFER_EMPTY) {
+          gchar *msg = gst_wasapi_util_hresult_to_string (hr);
+          GST_WARNING_OBJECT (self, "IAudioCaptureClient::GetBuffer failed: %s"
+              ", retrying", msg);
+          g_free (msg);
+          length = 0;
+          goto out;
+        }
+        HR_FAILED_ELEMENT_ERROR_AND (hr, IAudioCaptureClient::GetBuffer, self,
+            goto err);
       }
-      HR_FAILED_ELEMENT_ERROR_AND (hr, IAudioCaptureClient::GetBuffer, self,
-          goto err);
-    }
 
-    if (flags != 0)
-      GST_INFO_OBJECT (self, "buffer flags=%#08x", (guint) flags);
+      if (flags != 0)
+        GST_INFO_OBJECT (self, "buffer flags=%#08x", (guint) flags);
 
-    /* XXX: How do we handle AUDCLNT_BUFFERFLAGS_SILENT? We're supposed to write
-     * out silence when that flag is set? See:
-     * https://msdn.microsoft.com/en-us/library/windows/desktop/dd370800(v=vs.85).aspx */
+      /* XXX: How do we handle AUDCLNT_BUFFERFLAGS_SILENT? We're supposed to
+       * write out silence when that flag is set? See:
+       * https://msdn.microsoft.com/en-us/library/windows/desktop/dd370800(v=vs.85).aspx */
 
-    if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY)
-      GST_WARNING_OBJECT (self, "WASAPI reported glitch in buffer");
+      if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY)
+        GST_WARNING_OBJECT (self, "WASAPI reported glitch in buffer");
 
-    want_frames = wanted / self->mix_format->nBlockAlign;
+      want_frames = wanted / bpf;
 
-    /* If GetBuffer is returning more frames than we can handle, all we can do is
-     * hope that this is temporary and that things will settle down later. */
-    if (G_UNLIKELY (have_frames > want_frames))
-      GST_WARNING_OBJECT (self, "captured too many frames: have %i, want %i",
-          have_frames, want_frames);
+      /* Only copy data that will fit into the allocated buffer of size
+       * @length, anything beyond that is kept for the next read */
+      n_frames = MIN (have_frames, want_frames);
+      read_len = n_frames * bpf;
 
-    /* Only copy data that will fit into the allocated buffer of size @length */
-    n_frames = MIN (have_frames, want_frames);
-    read_len = n_frames * self->mix_format->nBlockAlign;
-
-    {
-      guint bpf = self->mix_format->nBlockAlign;
       GST_DEBUG_OBJECT (self, "have: %i (%i bytes), can read: %i (%i bytes), "
           "will read: %i (%i bytes)", have_frames, have_frames * bpf,
           want_frames, wanted, n_frames, read_len);
-    }
 
-    memcpy (data, from, read_len);
-    wanted -= read_len;
+      memcpy ((guint8 *) data + (length - wanted), from, read_len);
+      wanted -= read_len;
+
+      if (have_frames > n_frames) {
+        gsize keep_len = (have_frames - n_frames) * bpf;
 
-    /* Always release all captured buffers if we've captured any at all */
-    hr = IAudioCaptureClient_ReleaseBuffer (self->capture_client, have_frames);
-    HR_FAILED_ELEMENT_ERROR_AND (hr, IAudioCaptureClient::ReleaseBuffer, self,
-        goto err);
+        GST_DEBUG_OBJECT (self, "keeping %" G_GSIZE_FORMAT " captured bytes "
+            "for the next read", keep_len);
+        gst_adapter_push (self->adapter,
+            gst_buffer_new_wrapped (g_memdup ((guint8 *) from + read_len,
+                    keep_len), keep_len));
+      }
+
+      /* Always release all captured buffers if we've captured any at all */
+      hr = IAudioCaptureClient_ReleaseBuffer (self->capture_client,
+          have_frames);
+      HR_FAILED_ELEMENT_ERROR_AND (hr, IAudioCaptureClient::ReleaseBuffer,
+          self, goto err);
+    }
   }
 
 
@@ -672,6 +707,7 @@ gst_wasapi_src_reset (GstAudioSrc * asrc)
   HR_FAILED_RET (hr, IAudioClock::Reset,);
 
   self->client_needs_restart = TRUE;
+  gst_adapter_clear (self->adapter);
   GST_OBJECT_UNLOCK (self);
 }
 
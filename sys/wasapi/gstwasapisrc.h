@@ -22,6 +22,8 @@
 
 #include "gstwasapiutil.h"
 
+#include <gst/base/gstadapter.h>
+
 G_BEGIN_DECLS
 #define GST_TYPE_WASAPI_SRC \
   (gst_wasapi_src_get_type ())
@@ -59,6 +61,10 @@ struct _GstWasapiSrc
    * we will pass this to GstAudioRingbuffer so it can
    * translate it to the native GStreamer channel layout. */
   GstAudioChannelPosition *positions;
+  /* Device data captured but not yet consumed by a read. More than one
+   * period can be pending per event, especially with loopback capture,
+   * and packets can be larger than the requested read. */
+  GstAdapter *adapter;
 
   /* properties */
   gint role;
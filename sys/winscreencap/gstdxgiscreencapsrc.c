@@ -0,0 +1,956 @@
+/* GStreamer
+ * Copyright (C) 2007 Haakon Sporsheim <hakon.sporsheim@tandberg.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:element-dxgiscreencapsrc
+ * @title: dxgiscreencapsrc
+ *
+ * This element uses the DXGI Desktop Duplication API to capture the desktop
+ * or a portion of it. Unlike dx9screencapsrc it only reads back the regions
+ * that actually changed since the previous frame, using the move and dirty
+ * rectangle metadata the API provides, so a mostly static desktop costs
+ * almost nothing to capture even at high resolutions.
+ * The default is capturing the whole desktop, but
+ * #GstDXGIScreenCapSrc:x, #GstDXGIScreenCapSrc:y,
+ * #GstDXGIScreenCapSrc:width and #GstDXGIScreenCapSrc:height can be used to
+ * select a particular region. Use #GstDXGIScreenCapSrc:monitor for changing
+ * which monitor to capture from.
+ *
+ * ## Example pipelines
+ * |[
+ * gst-launch-1.0 dxgiscreencapsrc ! videoconvert ! d3dvideosink
+ * ]| Capture the desktop and display it.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_DXGI_CAP
+
+#define COBJMACROS
+
+#include "gstdxgiscreencapsrc.h"
+#include <gst/video/video.h>
+
+GST_DEBUG_CATEGORY_STATIC (dxgiscreencapsrc_debug);
+#define GST_CAT_DEFAULT dxgiscreencapsrc_debug
+
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("BGRA"))
+    );
+
+#define gst_dxgiscreencapsrc_parent_class parent_class
+G_DEFINE_TYPE (GstDXGIScreenCapSrc, gst_dxgiscreencapsrc, GST_TYPE_PUSH_SRC);
+
+enum
+{
+  PROP_0,
+  PROP_MONITOR,
+  PROP_SHOW_CURSOR,
+  PROP_X_POS,
+  PROP_Y_POS,
+  PROP_WIDTH,
+  PROP_HEIGHT
+};
+
+/* Fwd. decl. */
+static void gst_dxgiscreencapsrc_dispose (GObject * object);
+static void gst_dxgiscreencapsrc_set_property (GObject * object,
+    guint prop_id, const GValue * value, GParamSpec * pspec);
+static void gst_dxgiscreencapsrc_get_property (GObject * object,
+    guint prop_id, GValue * value, GParamSpec * pspec);
+
+static GstCaps *gst_dxgiscreencapsrc_fixate (GstBaseSrc * bsrc,
+    GstCaps * caps);
+static gboolean gst_dxgiscreencapsrc_set_caps (GstBaseSrc * bsrc,
+    GstCaps * caps);
+static GstCaps *gst_dxgiscreencapsrc_get_caps (GstBaseSrc * bsrc,
+    GstCaps * filter);
+static gboolean gst_dxgiscreencapsrc_start (GstBaseSrc * bsrc);
+static gboolean gst_dxgiscreencapsrc_stop (GstBaseSrc * bsrc);
+
+static gboolean gst_dxgiscreencapsrc_unlock (GstBaseSrc * bsrc);
+
+static GstFlowReturn gst_dxgiscreencapsrc_create (GstPushSrc * src,
+    GstBuffer ** buf);
+
+/* Returns the IDXGIOutput1 for the given monitor index, counting outputs
+ * across all adapters, and optionally the adapter owning it */
+static gboolean
+gst_dxgiscreencapsrc_get_output (guint monitor, IDXGIAdapter1 ** out_adapter,
+    IDXGIOutput1 ** out_output)
+{
+  IDXGIFactory1 *factory = NULL;
+  IDXGIAdapter1 *adapter = NULL;
+  IDXGIOutput *output = NULL;
+  guint adapter_idx, output_idx, count = 0;
+  gboolean ret = FALSE;
+  HRESULT hr;
+
+  hr = CreateDXGIFactory1 (&IID_IDXGIFactory1, (void **) &factory);
+  if (FAILED (hr))
+    return FALSE;
+
+  for (adapter_idx = 0;
+      IDXGIFactory1_EnumAdapters1 (factory, adapter_idx,
+          &adapter) != DXGI_ERROR_NOT_FOUND; adapter_idx++) {
+    for (output_idx = 0;
+        IDXGIAdapter1_EnumOutputs (adapter, output_idx,
+            &output) != DXGI_ERROR_NOT_FOUND; output_idx++) {
+      if (count == monitor) {
+        hr = IDXGIOutput_QueryInterface (output, &IID_IDXGIOutput1,
+            (void **) out_output);
+        IDXGIOutput_Release (output);
+        if (FAILED (hr))
+          goto done;
+
+        if (out_adapter) {
+          *out_adapter = adapter;
+          adapter = NULL;
+        }
+        ret = TRUE;
+        goto done;
+      }
+      IDXGIOutput_Release (output);
+      count++;
+    }
+    IDXGIAdapter1_Release (adapter);
+    adapter = NULL;
+  }
+
+done:
+  if (adapter)
+    IDXGIAdapter1_Release (adapter);
+  IDXGIFactory1_Release (factory);
+  return ret;
+}
+
+/* Implementation. */
+static void
+gst_dxgiscreencapsrc_class_init (GstDXGIScreenCapSrcClass * klass)
+{
+  GObjectClass *go_class;
+  GstElementClass *e_class;
+  GstBaseSrcClass *bs_class;
+  GstPushSrcClass *ps_class;
+
+  go_class = (GObjectClass *) klass;
+  e_class = (GstElementClass *) klass;
+  bs_class = (GstBaseSrcClass *) klass;
+  ps_class = (GstPushSrcClass *) klass;
+
+  go_class->dispose = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_dispose);
+  go_class->set_property =
+      GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_set_property);
+  go_class->get_property =
+      GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_get_property);
+
+  bs_class->get_caps = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_get_caps);
+  bs_class->set_caps = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_set_caps);
+  bs_class->start = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_start);
+  bs_class->stop = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_stop);
+  bs_class->unlock = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_unlock);
+  bs_class->fixate = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_fixate);
+
+  ps_class->create = GST_DEBUG_FUNCPTR (gst_dxgiscreencapsrc_create);
+
+  g_object_class_install_property (go_class, PROP_MONITOR,
+      g_param_spec_int ("monitor", "Monitor",
+          "Which monitor to use (0 = 1st monitor and default)",
+          0, G_MAXINT, 0, G_PARAM_READWRITE));
+
+  g_object_class_install_property (go_class, PROP_SHOW_CURSOR,
+      g_param_spec_boolean ("cursor", "Show mouse cursor",
+          "Whether to show mouse cursor (default off)",
+          FALSE, G_PARAM_READWRITE));
+
+  g_object_class_install_property (go_class, PROP_X_POS,
+      g_param_spec_int ("x", "X",
+          "Horizontal coordinate of top left corner for the screen capture "
+          "area", 0, G_MAXINT, 0, G_PARAM_READWRITE));
+  g_object_class_install_property (go_class, PROP_Y_POS,
+      g_param_spec_int ("y", "Y",
+          "Vertical coordinate of top left corner for the screen capture "
+          "area", 0, G_MAXINT, 0, G_PARAM_READWRITE));
+
+  g_object_class_install_property (go_class, PROP_WIDTH,
+      g_param_spec_int ("width", "Width",
+          "Width of screen capture area (0 = maximum)",
+          0, G_MAXINT, 0, G_PARAM_READWRITE));
+  g_object_class_install_property (go_class, PROP_HEIGHT,
+      g_param_spec_int ("height", "Height",
+          "Height of screen capture area (0 = maximum)",
+          0, G_MAXINT, 0, G_PARAM_READWRITE));
+
+  gst_element_class_add_static_pad_template (e_class, &src_template);
+
+  gst_element_class_set_static_metadata (e_class,
+      "DXGI desktop duplication screen capture source", "Source/Video",
+      "Captures screen using the DXGI Desktop Duplication API",
+      "Haakon Sporsheim <hakon.sporsheim@tandberg.com>");
+
+  GST_DEBUG_CATEGORY_INIT (dxgiscreencapsrc_debug, "dxgiscreencapsrc", 0,
+      "DXGI desktop duplication screen capture source");
+}
+
+static void
+gst_dxgiscreencapsrc_init (GstDXGIScreenCapSrc * src)
+{
+  /* Set src element inital values... */
+  src->capture_x = 0;
+  src->capture_y = 0;
+  src->capture_w = 0;
+  src->capture_h = 0;
+
+  src->monitor = 0;
+  src->show_cursor = FALSE;
+
+  gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
+  gst_base_src_set_live (GST_BASE_SRC (src), TRUE);
+}
+
+static void
+gst_dxgiscreencapsrc_dispose (GObject * object)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (object);
+
+  if (src->duplication) {
+    GST_ERROR_OBJECT (object,
+        "Desktop duplication was not freed in _stop, freeing in _dispose!");
+    IDXGIOutputDuplication_Release (src->duplication);
+    src->duplication = NULL;
+  }
+
+  if (src->staging) {
+    ID3D11Texture2D_Release (src->staging);
+    src->staging = NULL;
+  }
+
+  if (src->d3d11_context) {
+    ID3D11DeviceContext_Release (src->d3d11_context);
+    src->d3d11_context = NULL;
+  }
+
+  if (src->d3d11_device) {
+    ID3D11Device_Release (src->d3d11_device);
+    src->d3d11_device = NULL;
+  }
+
+  g_free (src->last_frame);
+  src->last_frame = NULL;
+  g_free (src->metadata);
+  src->metadata = NULL;
+
+  G_OBJECT_CLASS (parent_class)->dispose (object);
+}
+
+static void
+gst_dxgiscreencapsrc_set_property (GObject * object,
+    guint prop_id, const GValue * value, GParamSpec * pspec)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (object);
+
+  switch (prop_id) {
+    case PROP_MONITOR:
+      src->monitor = g_value_get_int (value);
+      break;
+    case PROP_SHOW_CURSOR:
+      src->show_cursor = g_value_get_boolean (value);
+      break;
+    case PROP_X_POS:
+      src->capture_x = g_value_get_int (value);
+      break;
+    case PROP_Y_POS:
+      src->capture_y = g_value_get_int (value);
+      break;
+    case PROP_WIDTH:
+      src->capture_w = g_value_get_int (value);
+      break;
+    case PROP_HEIGHT:
+      src->capture_h = g_value_get_int (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  };
+}
+
+static void
+gst_dxgiscreencapsrc_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (object);
+
+  switch (prop_id) {
+    case PROP_MONITOR:
+      g_value_set_int (value, src->monitor);
+      break;
+    case PROP_SHOW_CURSOR:
+      g_value_set_boolean (value, src->show_cursor);
+      break;
+    case PROP_X_POS:
+      g_value_set_int (value, src->capture_x);
+      break;
+    case PROP_Y_POS:
+      g_value_set_int (value, src->capture_y);
+      break;
+    case PROP_WIDTH:
+      g_value_set_int (value, src->capture_w);
+      break;
+    case PROP_HEIGHT:
+      g_value_set_int (value, src->capture_h);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  };
+}
+
+static GstCaps *
+gst_dxgiscreencapsrc_fixate (GstBaseSrc * bsrc, GstCaps * caps)
+{
+  GstStructure *structure;
+
+  caps = gst_caps_make_writable (caps);
+
+  structure = gst_caps_get_structure (caps, 0);
+
+  gst_structure_fixate_field_nearest_int (structure, "width", 640);
+  gst_structure_fixate_field_nearest_int (structure, "height", 480);
+  gst_structure_fixate_field_nearest_fraction (structure, "framerate", 30, 1);
+
+  caps = GST_BASE_SRC_CLASS (parent_class)->fixate (bsrc, caps);
+
+  return caps;
+}
+
+static gboolean
+gst_dxgiscreencapsrc_set_caps (GstBaseSrc * bsrc, GstCaps * caps)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (bsrc);
+  GstStructure *structure;
+  const GValue *framerate;
+
+  structure = gst_caps_get_structure (caps, 0);
+
+  src->src_rect = src->screen_rect;
+  if (src->capture_w && src->capture_h) {
+    src->src_rect.left += src->capture_x;
+    src->src_rect.top += src->capture_y;
+    src->src_rect.right = src->src_rect.left + src->capture_w;
+    src->src_rect.bottom = src->src_rect.top + src->capture_h;
+  }
+
+  framerate = gst_structure_get_value (structure, "framerate");
+  if (framerate) {
+    src->rate_numerator = gst_value_get_fraction_numerator (framerate);
+    src->rate_denominator = gst_value_get_fraction_denominator (framerate);
+  }
+
+  GST_DEBUG_OBJECT (src, "size %dx%d, %d/%d fps",
+      (gint) (src->src_rect.right - src->src_rect.left),
+      (gint) (src->src_rect.bottom - src->src_rect.top),
+      src->rate_numerator, src->rate_denominator);
+
+  return TRUE;
+}
+
+static GstCaps *
+gst_dxgiscreencapsrc_get_caps (GstBaseSrc * bsrc, GstCaps * filter)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (bsrc);
+  IDXGIOutput1 *output = NULL;
+  DXGI_OUTPUT_DESC output_desc;
+  RECT rect_dst;
+  GstCaps *caps;
+
+  if (!gst_dxgiscreencapsrc_get_output (src->monitor, NULL, &output)) {
+    GST_ELEMENT_ERROR (src, RESOURCE, NOT_FOUND,
+        ("Specified monitor with index %d not found", src->monitor), (NULL));
+    return NULL;
+  }
+
+  if (FAILED (IDXGIOutput1_GetDesc (output, &output_desc))) {
+    IDXGIOutput1_Release (output);
+    return NULL;
+  }
+  IDXGIOutput1_Release (output);
+
+  SetRect (&rect_dst, 0, 0,
+      output_desc.DesktopCoordinates.right -
+      output_desc.DesktopCoordinates.left,
+      output_desc.DesktopCoordinates.bottom -
+      output_desc.DesktopCoordinates.top);
+  src->screen_rect = rect_dst;
+  src->desktop_rect = output_desc.DesktopCoordinates;
+  src->width = rect_dst.right;
+  src->height = rect_dst.bottom;
+
+  if (src->capture_w && src->capture_h &&
+      src->capture_x + src->capture_w < rect_dst.right - rect_dst.left &&
+      src->capture_y + src->capture_h < rect_dst.bottom - rect_dst.top) {
+    rect_dst.left = src->capture_x;
+    rect_dst.top = src->capture_y;
+    rect_dst.right = src->capture_x + src->capture_w;
+    rect_dst.bottom = src->capture_y + src->capture_h;
+  } else {
+    /* Default values */
+    src->capture_x = src->capture_y = 0;
+    src->capture_w = src->capture_h = 0;
+  }
+
+  caps = gst_caps_new_simple ("video/x-raw",
+      "format", G_TYPE_STRING, "BGRA",
+      "width", G_TYPE_INT, rect_dst.right - rect_dst.left,
+      "height", G_TYPE_INT, rect_dst.bottom - rect_dst.top,
+      "framerate", GST_TYPE_FRACTION_RANGE, 1, 1, G_MAXINT, 1,
+      "pixel-aspect-ratio", GST_TYPE_FRACTION, 1, 1, NULL);
+
+  if (filter) {
+    GstCaps *tmp =
+        gst_caps_intersect_full (filter, caps, GST_CAPS_INTERSECT_FIRST);
+    gst_caps_unref (caps);
+    caps = tmp;
+  }
+
+  return caps;
+}
+
+static gboolean
+gst_dxgiscreencapsrc_create_duplication (GstDXGIScreenCapSrc * src)
+{
+  IDXGIOutput1 *output = NULL;
+  HRESULT hr;
+
+  if (!gst_dxgiscreencapsrc_get_output (src->monitor, NULL, &output)) {
+    GST_ELEMENT_ERROR (src, RESOURCE, NOT_FOUND,
+        ("Specified monitor with index %d not found", src->monitor), (NULL));
+    return FALSE;
+  }
+
+  hr = IDXGIOutput1_DuplicateOutput (output, (IUnknown *) src->d3d11_device,
+      &src->duplication);
+  IDXGIOutput1_Release (output);
+  if (FAILED (hr)) {
+    GST_ERROR_OBJECT (src, "IDXGIOutput1::DuplicateOutput failed (0x%x)",
+        (guint) hr);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static gboolean
+gst_dxgiscreencapsrc_start (GstBaseSrc * bsrc)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (bsrc);
+  IDXGIAdapter1 *adapter = NULL;
+  IDXGIOutput1 *output = NULL;
+  DXGI_OUTPUT_DESC output_desc;
+  D3D11_TEXTURE2D_DESC staging_desc;
+  HRESULT hr;
+
+  src->frame_number = -1;
+
+  if (!gst_dxgiscreencapsrc_get_output (src->monitor, &adapter, &output)) {
+    GST_ELEMENT_ERROR (src, RESOURCE, NOT_FOUND,
+        ("Specified monitor with index %d not found", src->monitor), (NULL));
+    return FALSE;
+  }
+
+  /* get_caps sets these too, but negotiation might not have run yet */
+  hr = IDXGIOutput1_GetDesc (output, &output_desc);
+  IDXGIOutput1_Release (output);
+  if (FAILED (hr)) {
+    IDXGIAdapter1_Release (adapter);
+    return FALSE;
+  }
+  src->desktop_rect = output_desc.DesktopCoordinates;
+  src->width = output_desc.DesktopCoordinates.right -
+      output_desc.DesktopCoordinates.left;
+  src->height = output_desc.DesktopCoordinates.bottom -
+      output_desc.DesktopCoordinates.top;
+
+  hr = D3D11CreateDevice ((IDXGIAdapter *) adapter, D3D_DRIVER_TYPE_UNKNOWN,
+      NULL, 0, NULL, 0, D3D11_SDK_VERSION, &src->d3d11_device, NULL,
+      &src->d3d11_context);
+  IDXGIAdapter1_Release (adapter);
+  if (FAILED (hr)) {
+    GST_ERROR_OBJECT (src, "D3D11CreateDevice failed (0x%x)", (guint) hr);
+    return FALSE;
+  }
+
+  if (!gst_dxgiscreencapsrc_create_duplication (src))
+    return FALSE;
+
+  memset (&staging_desc, 0, sizeof (staging_desc));
+  staging_desc.Width = src->width;
+  staging_desc.Height = src->height;
+  staging_desc.MipLevels = 1;
+  staging_desc.ArraySize = 1;
+  staging_desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+  staging_desc.SampleDesc.Count = 1;
+  staging_desc.Usage = D3D11_USAGE_STAGING;
+  staging_desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+  hr = ID3D11Device_CreateTexture2D (src->d3d11_device, &staging_desc, NULL,
+      &src->staging);
+  if (FAILED (hr)) {
+    GST_ERROR_OBJECT (src, "Failed to create staging texture (0x%x)",
+        (guint) hr);
+    return FALSE;
+  }
+
+  src->last_frame = g_malloc0 ((gsize) src->width * src->height * 4);
+
+  return TRUE;
+}
+
+static gboolean
+gst_dxgiscreencapsrc_stop (GstBaseSrc * bsrc)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (bsrc);
+
+  if (src->duplication) {
+    IDXGIOutputDuplication_Release (src->duplication);
+    src->duplication = NULL;
+  }
+
+  if (src->staging) {
+    ID3D11Texture2D_Release (src->staging);
+    src->staging = NULL;
+  }
+
+  if (src->d3d11_context) {
+    ID3D11DeviceContext_Release (src->d3d11_context);
+    src->d3d11_context = NULL;
+  }
+
+  if (src->d3d11_device) {
+    ID3D11Device_Release (src->d3d11_device);
+    src->d3d11_device = NULL;
+  }
+
+  g_free (src->last_frame);
+  src->last_frame = NULL;
+  g_free (src->metadata);
+  src->metadata = NULL;
+  src->metadata_size = 0;
+
+  return TRUE;
+}
+
+static gboolean
+gst_dxgiscreencapsrc_unlock (GstBaseSrc * bsrc)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (bsrc);
+
+  GST_OBJECT_LOCK (src);
+  if (src->clock_id) {
+    GST_DEBUG_OBJECT (src, "Waking up waiting clock");
+    gst_clock_id_unschedule (src->clock_id);
+  }
+  GST_OBJECT_UNLOCK (src);
+
+  return TRUE;
+}
+
+/* Applies the move rects of the acquired frame to the persistent frame.
+ * Per the API contract these have to be applied before the dirty rects. */
+static void
+gst_dxgiscreencapsrc_apply_move_rects (GstDXGIScreenCapSrc * src,
+    const DXGI_OUTDUPL_MOVE_RECT * moves, guint n_moves)
+{
+  guint stride = src->width * 4;
+  guint i;
+  gint j;
+
+  for (i = 0; i < n_moves; i++) {
+    const DXGI_OUTDUPL_MOVE_RECT *move = &moves[i];
+    gint w = move->DestinationRect.right - move->DestinationRect.left;
+    gint h = move->DestinationRect.bottom - move->DestinationRect.top;
+
+    if (w <= 0 || h <= 0)
+      continue;
+
+    /* Source and destination can overlap vertically, so pick the row
+     * order that does not overwrite still-needed source rows */
+    if (move->DestinationRect.top <= move->SourcePoint.y) {
+      for (j = 0; j < h; j++)
+        memmove (src->last_frame +
+            (move->DestinationRect.top + j) * stride +
+            move->DestinationRect.left * 4,
+            src->last_frame +
+            (move->SourcePoint.y + j) * stride + move->SourcePoint.x * 4,
+            w * 4);
+    } else {
+      for (j = h - 1; j >= 0; j--)
+        memmove (src->last_frame +
+            (move->DestinationRect.top + j) * stride +
+            move->DestinationRect.left * 4,
+            src->last_frame +
+            (move->SourcePoint.y + j) * stride + move->SourcePoint.x * 4,
+            w * 4);
+    }
+  }
+}
+
+/* Acquires the next frame from the duplication interface, if any, and
+ * updates the persistent frame from its move/dirty rect metadata. When the
+ * desktop did not change since the last call the persistent frame is simply
+ * left as-is. */
+static gboolean
+gst_dxgiscreencapsrc_capture (GstDXGIScreenCapSrc * src)
+{
+  DXGI_OUTDUPL_FRAME_INFO frame_info;
+  IDXGIResource *resource = NULL;
+  ID3D11Texture2D *desktop = NULL;
+  D3D11_MAPPED_SUBRESOURCE mapped;
+  guint stride = src->width * 4;
+  RECT *dirty;
+  guint n_moves = 0, n_dirty = 0, i;
+  UINT size;
+  HRESULT hr;
+
+  hr = IDXGIOutputDuplication_AcquireNextFrame (src->duplication, 0,
+      &frame_info, &resource);
+  if (hr == DXGI_ERROR_WAIT_TIMEOUT) {
+    GST_LOG_OBJECT (src, "Desktop unchanged, reusing last frame");
+    return TRUE;
+  }
+  if (hr == DXGI_ERROR_ACCESS_LOST) {
+    /* Happens on mode switches, full-screen transitions and the like.
+     * Recreate the duplication and hand out the last frame this cycle. */
+    GST_WARNING_OBJECT (src, "Desktop duplication access lost, recreating");
+    IDXGIOutputDuplication_Release (src->duplication);
+    src->duplication = NULL;
+    return gst_dxgiscreencapsrc_create_duplication (src);
+  }
+  if (FAILED (hr)) {
+    GST_ERROR_OBJECT (src, "AcquireNextFrame failed (0x%x)", (guint) hr);
+    return FALSE;
+  }
+
+  if (frame_info.TotalMetadataBufferSize > 0) {
+    if (src->metadata_size < frame_info.TotalMetadataBufferSize) {
+      src->metadata_size = frame_info.TotalMetadataBufferSize;
+      src->metadata = g_realloc (src->metadata, src->metadata_size);
+    }
+
+    hr = IDXGIOutputDuplication_GetFrameMoveRects (src->duplication,
+        src->metadata_size, (DXGI_OUTDUPL_MOVE_RECT *) src->metadata, &size);
+    if (FAILED (hr))
+      goto frame_error;
+    n_moves = size / sizeof (DXGI_OUTDUPL_MOVE_RECT);
+
+    gst_dxgiscreencapsrc_apply_move_rects (src,
+        (const DXGI_OUTDUPL_MOVE_RECT *) src->metadata, n_moves);
+
+    hr = IDXGIOutputDuplication_GetFrameDirtyRects (src->duplication,
+        src->metadata_size, (RECT *) src->metadata, &size);
+    if (FAILED (hr))
+      goto frame_error;
+    n_dirty = size / sizeof (RECT);
+  }
+
+  GST_LOG_OBJECT (src, "Acquired frame with %u move and %u dirty rects",
+      n_moves, n_dirty);
+
+  if (n_dirty > 0) {
+    hr = IDXGIResource_QueryInterface (resource, &IID_ID3D11Texture2D,
+        (void **) &desktop);
+    if (FAILED (hr))
+      goto frame_error;
+
+    /* Read back only the regions that changed instead of the whole
+     * desktop texture */
+    dirty = (RECT *) src->metadata;
+    for (i = 0; i < n_dirty; i++) {
+      D3D11_BOX box;
+
+      box.left = dirty[i].left;
+      box.top = dirty[i].top;
+      box.front = 0;
+      box.right = dirty[i].right;
+      box.bottom = dirty[i].bottom;
+      box.back = 1;
+
+      ID3D11DeviceContext_CopySubresourceRegion (src->d3d11_context,
+          (ID3D11Resource *) src->staging, 0, box.left, box.top, 0,
+          (ID3D11Resource *) desktop, 0, &box);
+    }
+
+    hr = ID3D11DeviceContext_Map (src->d3d11_context,
+        (ID3D11Resource *) src->staging, 0, D3D11_MAP_READ, 0, &mapped);
+    if (FAILED (hr))
+      goto frame_error;
+
+    for (i = 0; i < n_dirty; i++) {
+      gint w = dirty[i].right - dirty[i].left;
+      gint h = dirty[i].bottom - dirty[i].top;
+      const guint8 *p_src = (const guint8 *) mapped.pData +
+          dirty[i].top * mapped.RowPitch + dirty[i].left * 4;
+      guint8 *p_dst = src->last_frame + dirty[i].top * stride +
+          dirty[i].left * 4;
+      gint j;
+
+      for (j = 0; j < h; j++) {
+        memcpy (p_dst, p_src, w * 4);
+        p_src += mapped.RowPitch;
+        p_dst += stride;
+      }
+    }
+
+    ID3D11DeviceContext_Unmap (src->d3d11_context,
+        (ID3D11Resource *) src->staging, 0);
+    ID3D11Texture2D_Release (desktop);
+    desktop = NULL;
+  }
+
+  IDXGIResource_Release (resource);
+  IDXGIOutputDuplication_ReleaseFrame (src->duplication);
+
+  return TRUE;
+
+frame_error:
+  GST_ERROR_OBJECT (src, "Failed to process acquired frame (0x%x)",
+      (guint) hr);
+  if (desktop)
+    ID3D11Texture2D_Release (desktop);
+  IDXGIResource_Release (resource);
+  IDXGIOutputDuplication_ReleaseFrame (src->duplication);
+  return FALSE;
+}
+
+/* Draws the cursor into the output image by round-tripping the pixels
+ * under it through a GDI DIB section, like dx9screencapsrc does with the
+ * surface HDC */
+static void
+gst_dxgiscreencapsrc_draw_cursor (GstDXGIScreenCapSrc * src, guint8 * frame,
+    gint frame_w, gint frame_h)
+{
+  CURSORINFO ci;
+  ICONINFO ii;
+  BITMAPINFO bmi;
+  HDC mem_dc;
+  HBITMAP dib;
+  void *dib_data = NULL;
+  gint cursor_w, cursor_h, x, y, i, copy_w, copy_h, src_x, src_y;
+  guint frame_stride = frame_w * 4;
+
+  ci.cbSize = sizeof (CURSORINFO);
+  GetCursorInfo (&ci);
+  if (!(ci.flags & CURSOR_SHOWING))
+    return;
+
+  GetIconInfo (ci.hCursor, &ii);
+
+  cursor_w = GetSystemMetrics (SM_CXCURSOR);
+  cursor_h = GetSystemMetrics (SM_CYCURSOR);
+
+  x = ci.ptScreenPos.x - ii.xHotspot - src->desktop_rect.left -
+      src->src_rect.left;
+  y = ci.ptScreenPos.y - ii.yHotspot - src->desktop_rect.top -
+      src->src_rect.top;
+
+  /* Portion of the cursor rectangle that is inside the frame */
+  src_x = x < 0 ? -x : 0;
+  src_y = y < 0 ? -y : 0;
+  copy_w = MIN (cursor_w - src_x, frame_w - MAX (x, 0));
+  copy_h = MIN (cursor_h - src_y, frame_h - MAX (y, 0));
+  if (copy_w <= 0 || copy_h <= 0)
+    goto out;
+
+  memset (&bmi, 0, sizeof (bmi));
+  bmi.bmiHeader.biSize = sizeof (BITMAPINFOHEADER);
+  bmi.bmiHeader.biWidth = cursor_w;
+  /* Negative height for a top-down DIB */
+  bmi.bmiHeader.biHeight = -cursor_h;
+  bmi.bmiHeader.biPlanes = 1;
+  bmi.bmiHeader.biBitCount = 32;
+  bmi.bmiHeader.biCompression = BI_RGB;
+
+  mem_dc = CreateCompatibleDC (NULL);
+  dib = CreateDIBSection (mem_dc, &bmi, DIB_RGB_COLORS, &dib_data, NULL, 0);
+  if (dib) {
+    HGDIOBJ old = SelectObject (mem_dc, dib);
+
+    /* Copy the pixels under the cursor so the AND/XOR masks blend with
+     * the proper background */
+    for (i = 0; i < copy_h; i++)
+      memcpy ((guint8 *) dib_data + (src_y + i) * cursor_w * 4 + src_x * 4,
+          frame + (MAX (y, 0) + i) * frame_stride + MAX (x, 0) * 4,
+          copy_w * 4);
+
+    DrawIcon (mem_dc, 0, 0, ci.hCursor);
+    GdiFlush ();
+
+    for (i = 0; i < copy_h; i++)
+      memcpy (frame + (MAX (y, 0) + i) * frame_stride + MAX (x, 0) * 4,
+          (guint8 *) dib_data + (src_y + i) * cursor_w * 4 + src_x * 4,
+          copy_w * 4);
+
+    SelectObject (mem_dc, old);
+    DeleteObject (dib);
+  }
+  DeleteDC (mem_dc);
+
+out:
+  DeleteObject (ii.hbmColor);
+  DeleteObject (ii.hbmMask);
+}
+
+static GstFlowReturn
+gst_dxgiscreencapsrc_create (GstPushSrc * push_src, GstBuffer ** buf)
+{
+  GstDXGIScreenCapSrc *src = GST_DXGISCREENCAPSRC (push_src);
+  GstBuffer *new_buf;
+  gint new_buf_size, i;
+  gint width, height, stride;
+  GstClock *clock;
+  GstClockTime buf_time, buf_dur;
+  LPBYTE p_dst, p_src;
+  GstMapInfo map;
+  guint64 frame_number;
+
+  if (G_UNLIKELY (!src->duplication)) {
+    GST_ELEMENT_ERROR (src, CORE, NEGOTIATION, (NULL),
+        ("format wasn't negotiated before create function"));
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+
+  clock = gst_element_get_clock (GST_ELEMENT (src));
+  if (clock != NULL) {
+    GstClockTime time, base_time;
+
+    /* Calculate sync time. */
+
+    time = gst_clock_get_time (clock);
+    base_time = gst_element_get_base_time (GST_ELEMENT (src));
+    buf_time = time - base_time;
+
+    if (src->rate_numerator) {
+      frame_number = gst_util_uint64_scale (buf_time,
+          src->rate_numerator, GST_SECOND * src->rate_denominator);
+    } else {
+      frame_number = -1;
+    }
+  } else {
+    buf_time = GST_CLOCK_TIME_NONE;
+    frame_number = -1;
+  }
+
+  if (frame_number != -1 && frame_number == src->frame_number) {
+    GstClockID id;
+    GstClockReturn ret;
+
+    /* Need to wait for the next frame */
+    frame_number += 1;
+
+    /* Figure out what the next frame time is */
+    buf_time = gst_util_uint64_scale (frame_number,
+        src->rate_denominator * GST_SECOND, src->rate_numerator);
+
+    id = gst_clock_new_single_shot_id (clock,
+        buf_time + gst_element_get_base_time (GST_ELEMENT (src)));
+    GST_OBJECT_LOCK (src);
+    src->clock_id = id;
+    GST_OBJECT_UNLOCK (src);
+
+    GST_DEBUG_OBJECT (src, "Waiting for next frame time %" G_GUINT64_FORMAT,
+        buf_time);
+    ret = gst_clock_id_wait (id, NULL);
+
+    GST_OBJECT_LOCK (src);
+    gst_clock_id_unref (id);
+    src->clock_id = NULL;
+    GST_OBJECT_UNLOCK (src);
+
+    if (ret == GST_CLOCK_UNSCHEDULED) {
+      /* Got woken up by the unlock function */
+      gst_object_unref (clock);
+      return GST_FLOW_FLUSHING;
+    }
+
+    /* Duration is a complete 1/fps frame duration */
+    buf_dur =
+        gst_util_uint64_scale_int (GST_SECOND, src->rate_denominator,
+        src->rate_numerator);
+  } else if (frame_number != -1) {
+    GstClockTime next_buf_time;
+
+    GST_DEBUG_OBJECT (src, "No need to wait for next frame time %"
+        G_GUINT64_FORMAT " next frame = %" G_GINT64_FORMAT " prev = %"
+        G_GINT64_FORMAT, buf_time, frame_number, src->frame_number);
+    next_buf_time = gst_util_uint64_scale (frame_number + 1,
+        src->rate_denominator * GST_SECOND, src->rate_numerator);
+    /* Frame duration is from now until the next expected capture time */
+    buf_dur = next_buf_time - buf_time;
+  } else {
+    buf_dur = GST_CLOCK_TIME_NONE;
+  }
+  src->frame_number = frame_number;
+
+  if (!gst_dxgiscreencapsrc_capture (src)) {
+    if (clock != NULL)
+      gst_object_unref (clock);
+    return GST_FLOW_ERROR;
+  }
+
+  height = (src->src_rect.bottom - src->src_rect.top);
+  width = (src->src_rect.right - src->src_rect.left);
+  new_buf_size = width * 4 * height;
+
+  GST_LOG_OBJECT (src,
+      "creating buffer of %d bytes with %dx%d image",
+      new_buf_size, width, height);
+
+  new_buf = gst_buffer_new_and_alloc (new_buf_size);
+  gst_buffer_map (new_buf, &map, GST_MAP_WRITE);
+  p_dst = (LPBYTE) map.data;
+  p_src = (LPBYTE) src->last_frame +
+      src->src_rect.top * src->width * 4 + src->src_rect.left * 4;
+  stride = width * 4;
+  for (i = 0; i < height; ++i) {
+    memcpy (p_dst, p_src, stride);
+    p_dst += stride;
+    p_src += src->width * 4;
+  }
+
+  if (src->show_cursor)
+    gst_dxgiscreencapsrc_draw_cursor (src, (guint8 *) map.data, width,
+        height);
+
+  gst_buffer_unmap (new_buf, &map);
+
+  GST_BUFFER_TIMESTAMP (new_buf) = buf_time;
+  GST_BUFFER_DURATION (new_buf) = buf_dur;
+
+  if (clock != NULL)
+    gst_object_unref (clock);
+
+  *buf = new_buf;
+  return GST_FLOW_OK;
+}
+
+#endif /* HAVE_DXGI_CAP */
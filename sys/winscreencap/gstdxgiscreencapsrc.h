@@ -0,0 +1,99 @@
+/* GStreamer
+ * Copyright (C) 2007 Haakon Sporsheim <hakon.sporsheim@tandberg.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_DXGISCREENCAPSRC_H__
+#define __GST_DXGISCREENCAPSRC_H__
+
+#include <d3d11.h>
+#include <dxgi1_2.h>
+
+#include <gst/gst.h>
+#include <gst/base/gstpushsrc.h>
+
+#include "gstwinscreencap.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_DXGISCREENCAPSRC  (gst_dxgiscreencapsrc_get_type())
+#define GST_DXGISCREENCAPSRC(obj)                                     \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),                                  \
+  GST_TYPE_DXGISCREENCAPSRC,GstDXGIScreenCapSrc))
+#define GST_DXGISCREENCAPSRC_CLASS(klass)                             \
+  (G_TYPE_CHECK_CLASS_CAST((klass),                                   \
+  GST_TYPE_DXGISCREENCAPSRC,GstDXGIScreenCapSrcClass))
+#define GST_IS_DXGISCREENCAPSRC(obj)                                  \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_DXGISCREENCAPSRC))
+#define GST_IS_DXGISCREENCAPSRC_CLASS(klass)                          \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_DXGISCREENCAPSRC))
+
+typedef struct _GstDXGIScreenCapSrc GstDXGIScreenCapSrc;
+typedef struct _GstDXGIScreenCapSrcClass GstDXGIScreenCapSrcClass;
+
+struct _GstDXGIScreenCapSrc
+{
+  /* Parent */
+  GstPushSrc src;
+
+  /* Properties */
+  gint capture_x;
+  gint capture_y;
+  gint capture_w;
+  gint capture_h;
+  guint monitor;
+  gboolean show_cursor;
+
+  /* Source pad frame rate */
+  gint rate_numerator;
+  gint rate_denominator;
+
+  /* Runtime variables */
+  RECT screen_rect;
+  RECT src_rect;
+  /* Position of the captured output in the virtual desktop, needed to
+   * translate the cursor position into frame coordinates */
+  RECT desktop_rect;
+  guint64 frame_number;
+  GstClockID clock_id;
+
+  ID3D11Device *d3d11_device;
+  ID3D11DeviceContext *d3d11_context;
+  IDXGIOutputDuplication *duplication;
+  ID3D11Texture2D *staging;
+
+  /* Full output size in pixels */
+  guint width;
+  guint height;
+  /* Persistent BGRA image of the whole output, updated from the
+   * move/dirty rect metadata of each acquired frame */
+  guint8 *last_frame;
+  /* Scratch buffer for the frame metadata, grown on demand */
+  guint8 *metadata;
+  guint metadata_size;
+};
+
+struct _GstDXGIScreenCapSrcClass
+{
+  GstPushSrcClass parent_class;
+};
+
+GType gst_dxgiscreencapsrc_get_type (void);
+
+G_END_DECLS
+
+#endif /* __GST_DXGISCREENCAPSRC_H__ */
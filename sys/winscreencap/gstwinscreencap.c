@@ -24,6 +24,9 @@
 #include "gstwinscreencap.h"
 #include "gstgdiscreencapsrc.h"
 #include "gstdx9screencapsrc.h"
+#ifdef HAVE_DXGI_CAP
+#include "gstdxgiscreencapsrc.h"
+#endif
 
 static BOOL CALLBACK
 _diplay_monitor_enum (HMONITOR hMon, HDC hdc, LPRECT rect, LPARAM param)
@@ -66,6 +69,12 @@ plugin_init (GstPlugin * plugin)
           GST_RANK_NONE, GST_TYPE_DX9SCREENCAPSRC)) {
     return FALSE;
   }
+#ifdef HAVE_DXGI_CAP
+  if (!gst_element_register (plugin, "dxgiscreencapsrc",
+          GST_RANK_NONE, GST_TYPE_DXGISCREENCAPSRC)) {
+    return FALSE;
+  }
+#endif
 
   return TRUE;
 }
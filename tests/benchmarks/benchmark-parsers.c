@@ -0,0 +1,247 @@
+/* GStreamer codec parser benchmarks
+ *
+ * Copyright (C) 2019 GStreamer developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Corpus-driven throughput benchmark for the codecparsers library.
+ *
+ *   benchmark-parsers [--json] <h264|h265|vc1> <elementary stream> [iterations]
+ *
+ * Feeds the given byte-stream file through the respective parser the
+ * requested number of times and reports throughput (MB/s) and the average
+ * time per parsed unit. With --json a single machine-readable line is
+ * printed instead, for tracking results across commits in CI.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <gst/gst.h>
+#include <gst/codecparsers/gsth264parser.h>
+#include <gst/codecparsers/gsth265parser.h>
+#include <gst/codecparsers/gstvc1parser.h>
+
+static guint64
+benchmark_h264 (const guint8 * data, gsize size, guint iterations)
+{
+  GstH264NalParser *parser = gst_h264_nal_parser_new ();
+  guint64 units = 0;
+  guint i;
+
+  for (i = 0; i < iterations; i++) {
+    GstH264NalUnit nalu;
+    GstH264ParserResult res;
+    guint offset = 0;
+
+    while (TRUE) {
+      res = gst_h264_parser_identify_nalu (parser, data, offset, size, &nalu);
+      if (res == GST_H264_PARSER_NO_NAL_END && nalu.size > 0)
+        res = GST_H264_PARSER_OK;
+      if (res != GST_H264_PARSER_OK)
+        break;
+
+      switch (nalu.type) {
+        case GST_H264_NAL_SLICE:
+        case GST_H264_NAL_SLICE_DPA:
+        case GST_H264_NAL_SLICE_DPB:
+        case GST_H264_NAL_SLICE_DPC:
+        case GST_H264_NAL_SLICE_IDR:{
+          GstH264SliceHdr slice;
+
+          gst_h264_parser_parse_slice_hdr (parser, &nalu, &slice, TRUE, TRUE);
+          break;
+        }
+        default:
+          gst_h264_parser_parse_nal (parser, &nalu);
+          break;
+      }
+
+      units++;
+      offset = nalu.offset + nalu.size;
+    }
+  }
+
+  gst_h264_nal_parser_free (parser);
+
+  return units;
+}
+
+static guint64
+benchmark_h265 (const guint8 * data, gsize size, guint iterations)
+{
+  GstH265Parser *parser = gst_h265_parser_new ();
+  guint64 units = 0;
+  guint i;
+
+  for (i = 0; i < iterations; i++) {
+    GstH265NalUnit nalu;
+    GstH265ParserResult res;
+    guint offset = 0;
+
+    while (TRUE) {
+      res = gst_h265_parser_identify_nalu (parser, data, offset, size, &nalu);
+      if (res == GST_H265_PARSER_NO_NAL_END && nalu.size > 0)
+        res = GST_H265_PARSER_OK;
+      if (res != GST_H265_PARSER_OK)
+        break;
+
+      if (nalu.type <= GST_H265_NAL_SLICE_CRA_NUT) {
+        GstH265SliceHdr slice;
+
+        if (gst_h265_parser_parse_slice_hdr (parser, &nalu,
+                &slice) == GST_H265_PARSER_OK)
+          gst_h265_slice_hdr_free (&slice);
+      } else {
+        gst_h265_parser_parse_nal (parser, &nalu);
+      }
+
+      units++;
+      offset = nalu.offset + nalu.size;
+    }
+  }
+
+  gst_h265_parser_free (parser);
+
+  return units;
+}
+
+static guint64
+benchmark_vc1 (const guint8 * data, gsize size, guint iterations)
+{
+  guint64 units = 0;
+  guint i;
+
+  for (i = 0; i < iterations; i++) {
+    GstVC1BDU bdu;
+    GstVC1SeqHdr seqhdr;
+    gboolean have_seqhdr = FALSE;
+    guint offset = 0;
+
+    while (offset + 4 <= size) {
+      GstVC1ParserResult res =
+          gst_vc1_identify_next_bdu (data + offset, size - offset, &bdu);
+
+      /* the last BDU in the file has no terminating start code */
+      if (res == GST_VC1_PARSER_NO_BDU_END) {
+        bdu.size = (size - offset) - bdu.offset;
+        res = GST_VC1_PARSER_OK;
+      }
+      if (res != GST_VC1_PARSER_OK)
+        break;
+
+      if (bdu.type == GST_VC1_SEQUENCE) {
+        if (gst_vc1_parse_sequence_header (bdu.data + bdu.offset, bdu.size,
+                &seqhdr) == GST_VC1_PARSER_OK)
+          have_seqhdr = TRUE;
+      } else if (bdu.type == GST_VC1_FRAME && have_seqhdr) {
+        GstVC1FrameHdr framehdr;
+
+        gst_vc1_parse_frame_header (bdu.data + bdu.offset, bdu.size,
+            &framehdr, &seqhdr, NULL);
+      }
+
+      units++;
+      offset += bdu.offset + bdu.size;
+    }
+  }
+
+  return units;
+}
+
+gint
+main (gint argc, gchar ** argv)
+{
+  const gchar *codec, *filename;
+  gchar *data = NULL;
+  gsize size = 0;
+  gboolean json = FALSE;
+  guint iterations = 10;
+  guint64 units;
+  gint64 start, elapsed;
+  gdouble seconds, mb_per_sec, ns_per_unit;
+  GError *error = NULL;
+  gint arg = 1;
+
+  gst_init (&argc, &argv);
+
+  if (arg < argc && strcmp (argv[arg], "--json") == 0) {
+    json = TRUE;
+    arg++;
+  }
+
+  if (argc - arg < 2) {
+    g_printerr
+        ("Usage: %s [--json] <h264|h265|vc1> <elementary stream> [iterations]\n",
+        argv[0]);
+    return 1;
+  }
+
+  codec = argv[arg++];
+  filename = argv[arg++];
+  if (arg < argc)
+    iterations = MAX (1, atoi (argv[arg]));
+
+  if (!g_file_get_contents (filename, &data, &size, &error)) {
+    g_printerr ("Failed to read '%s': %s\n", filename, error->message);
+    g_error_free (error);
+    return 1;
+  }
+
+  start = g_get_monotonic_time ();
+  if (strcmp (codec, "h264") == 0)
+    units = benchmark_h264 ((const guint8 *) data, size, iterations);
+  else if (strcmp (codec, "h265") == 0)
+    units = benchmark_h265 ((const guint8 *) data, size, iterations);
+  else if (strcmp (codec, "vc1") == 0)
+    units = benchmark_vc1 ((const guint8 *) data, size, iterations);
+  else {
+    g_printerr ("Unknown codec '%s'\n", codec);
+    g_free (data);
+    return 1;
+  }
+  elapsed = g_get_monotonic_time () - start;
+
+  if (units == 0) {
+    g_printerr ("No parseable units found in '%s'\n", filename);
+    g_free (data);
+    return 1;
+  }
+
+  seconds = elapsed / (gdouble) G_USEC_PER_SEC;
+  mb_per_sec = (iterations * (gdouble) size) / (1024.0 * 1024.0) / seconds;
+  ns_per_unit = (elapsed * 1000.0) / units;
+
+  if (json) {
+    g_print ("{\"codec\":\"%s\",\"file\":\"%s\",\"bytes\":%" G_GSIZE_FORMAT
+        ",\"iterations\":%u,\"units\":%" G_GUINT64_FORMAT
+        ",\"seconds\":%.6f,\"mb_per_sec\":%.2f,\"ns_per_unit\":%.1f}\n",
+        codec, filename, size, iterations, units, seconds, mb_per_sec,
+        ns_per_unit);
+  } else {
+    g_print ("%s: %" G_GUINT64_FORMAT " units, %u x %" G_GSIZE_FORMAT
+        " bytes in %.3fs\n", codec, units, iterations, size, seconds);
+    g_print ("  %.2f MB/s, %.1f ns/unit\n", mb_per_sec, ns_per_unit);
+  }
+
+  g_free (data);
+
+  return 0;
+}
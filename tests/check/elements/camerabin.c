@@ -1109,6 +1109,53 @@ GST_START_TEST (test_multiple_image_captures)
 
 GST_END_TEST;
 
+/* Emit all the start-captures up front without waiting for the previous
+ * capture to finish; the extra ones should be queued behind the ongoing
+ * one and still produce one image each */
+GST_START_TEST (test_image_capture_burst)
+{
+  gboolean idle;
+  gint i;
+
+  if (!camera)
+    return;
+
+  /* set still image mode */
+  g_object_set (camera, "mode", 1, "location", image_filename, NULL);
+
+  if (gst_element_set_state (GST_ELEMENT (camera), GST_STATE_PLAYING) ==
+      GST_STATE_CHANGE_FAILURE) {
+    GST_WARNING ("setting camerabin to PLAYING failed");
+    gst_element_set_state (GST_ELEMENT (camera), GST_STATE_NULL);
+    gst_object_unref (camera);
+    camera = NULL;
+  }
+  fail_unless (camera != NULL);
+  g_object_get (camera, "idle", &idle, NULL);
+  fail_unless (idle);
+  GST_INFO ("starting capture");
+
+  for (i = 0; i < 3; i++)
+    g_signal_emit_by_name (camera, "start-capture", NULL);
+
+  for (i = 0; i < 3; i++) {
+    GstMessage *msg;
+
+    msg = wait_for_element_message (camera, "image-done", GST_CLOCK_TIME_NONE);
+    fail_unless (msg != NULL);
+    gst_message_unref (msg);
+  }
+
+  wait_for_idle_state ();
+  gst_element_set_state (GST_ELEMENT (camera), GST_STATE_NULL);
+  for (i = 0; i < 3; i++) {
+    check_file_validity (image_filename, i, NULL, 0, 0, NO_AUDIO);
+    remove_file (image_filename, i);
+  }
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_single_video_recording)
 {
   GstMessage *msg;
@@ -1953,6 +2000,7 @@ camerabin_suite (void)
     tcase_add_test (tc_basic, test_single_video_recording);
     tcase_add_test (tc_basic, test_image_video_cycle);
     tcase_add_test (tc_basic, test_multiple_image_captures);
+    tcase_add_test (tc_basic, test_image_capture_burst);
     tcase_add_test (tc_basic, test_multiple_video_recordings);
 
     tcase_add_test (tc_basic, test_image_capture_previews);